@@ -80,7 +80,9 @@ def get_models_from_file(model_file):
     The majority of neuron, device, and connection models are classes
     derived from a specific base class (like Node, ArchivingNode, or
     Connection) or from another model. The latter can only be detected
-    if the base model has the same name as the file.
+    if the base model has the same name as the file. The same holds for
+    models that are typedefs or alias templates for a specialization of
+    the model class template with the same name as the file.
 
     The rate and binary neurons are typedefs for specialized template
     classes and multiple of such typedefs may be present in a file.
@@ -140,7 +142,18 @@ def get_models_from_file(model_file):
                     types.append(types[names.index(model_file)])
                 except (ValueError, KeyError) as e:
                     types.append("node")
-            if line.startswith("typedef "):
+            if line.startswith(f"typedef {model_file}< ") or (
+                line.startswith("using ") and f" = {model_file}< " in line
+            ):
+                if line.startswith("typedef "):
+                    names.append(line.rsplit(" ", 1)[-1].strip()[:-1])
+                else:
+                    names.append(line.split(" ", 2)[1])
+                try:
+                    types.append(types[names.index(model_file)])
+                except (ValueError, KeyError) as e:
+                    types.append("node")
+            elif line.startswith("typedef "):
                 for pattern, mtype in model_patterns.items():
                     if pattern in line:
                         names.append(line.rsplit(" ", 1)[-1].strip()[:-1])
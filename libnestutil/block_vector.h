@@ -244,6 +244,14 @@ public:
    */
   void push_back( value_type_&& value );
 
+  /**
+   * @brief Allocate blocks for at least n elements.
+   * @param n Number of elements the BlockVector can hold without allocating further blocks.
+   *
+   * Iterators into the BlockVector are invalidated if new blocks are allocated.
+   */
+  void reserve( const size_t n );
+
   /**
    * Erases all the elements.
    */
@@ -407,8 +415,8 @@ template < typename value_type_ >
 void
 BlockVector< value_type_ >::push_back( const value_type_& value )
 {
-  // If this is the last element in the current block, add another block
-  if ( finish_.block_it_ == finish_.current_block_end_ - 1 )
+  // If this is the last element in the current block, add another block unless it has been reserved
+  if ( finish_.block_it_ == finish_.current_block_end_ - 1 and finish_.block_vector_it_ + 1 == blockmap_.end() )
   {
     // Need to get the current position here, then recreate the iterator after we extend the blockmap,
     // because after the blockmap is changed the iterator becomes invalid.
@@ -424,8 +432,8 @@ template < typename value_type_ >
 void
 BlockVector< value_type_ >::push_back( value_type_&& value )
 {
-  // If this is the last element in the current block, add another block
-  if ( finish_.block_it_ == finish_.current_block_end_ - 1 )
+  // If this is the last element in the current block, add another block unless it has been reserved
+  if ( finish_.block_it_ == finish_.current_block_end_ - 1 and finish_.block_vector_it_ + 1 == blockmap_.end() )
   {
     // Need to get the current position here, then recreate the iterator after we extend the blockmap,
     // because after the blockmap is changed the iterator becomes invalid.
@@ -437,6 +445,26 @@ BlockVector< value_type_ >::push_back( value_type_&& value )
   ++finish_;
 }
 
+template < typename value_type_ >
+void
+BlockVector< value_type_ >::reserve( const size_t n )
+{
+  // push_back() expects the block following a full block to exist, hence the additional block
+  const size_t num_blocks_needed = n / max_block_size + 1;
+  if ( num_blocks_needed <= blockmap_.size() )
+  {
+    return;
+  }
+
+  const auto current_block = finish_.block_vector_it_ - finish_.block_vector_->blockmap_.begin();
+  blockmap_.reserve( num_blocks_needed );
+  while ( blockmap_.size() < num_blocks_needed )
+  {
+    blockmap_.emplace_back( max_block_size );
+  }
+  finish_.block_vector_it_ = finish_.block_vector_->blockmap_.begin() + current_block;
+}
+
 template < typename value_type_ >
 void
 BlockVector< value_type_ >::clear()
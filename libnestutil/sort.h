@@ -24,13 +24,19 @@
 #define SORT_H
 
 #include <algorithm>
+#include <cassert>
 #include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 // Generated includes:
 #include "config.h"
 
 #include "block_vector.h"
+#include "source.h"
 
 #ifdef HAVE_BOOST
 #include "iterator_pair.h"
@@ -38,6 +44,7 @@
 #endif
 
 #define INSERTION_SORT_CUTOFF 10 // use insertion sort for smaller arrays
+#define RADIX_SORT_DIGIT_BITS 11 // number of key bits sorted per pass of radix sort
 
 namespace nest
 {
@@ -185,6 +192,131 @@ sort( BlockVector< T1 >& vec_sort, BlockVector< T2 >& vec_perm )
 #endif
 }
 
+/**
+ * Buffers for radix sorting of sources.
+ *
+ * Only positions are sorted, the keys are read from the sources in each
+ * pass, so the buffers need 8 B per element. The buffers keep their
+ * capacity between calls, so that sorting many vectors in a row does not
+ * allocate memory for each of them.
+ */
+struct RadixSortBuffers
+{
+  //! Largest number of elements that can be sorted with 32-bit positions.
+  static constexpr size_t max_num_elements = std::numeric_limits< uint32_t >::max();
+
+  std::vector< uint32_t > permutation;     //!< original position of each element in sorted order
+  std::vector< uint32_t > permutation_tmp; //!< target of each radix sort pass
+  std::vector< size_t > counts;            //!< number of keys per digit value
+};
+
+/**
+ * Computes the permutation that stably sorts sources by node ID.
+ *
+ * Uses a least-significant-digit radix sort with as many passes as the
+ * largest node ID requires. Disabled sources are sorted to the end.
+ * Afterwards, buffers.permutation[ i ] holds the original position of the
+ * source that belongs at position i. At most
+ * RadixSortBuffers::max_num_elements sources can be sorted.
+ */
+inline void
+radix_sort_permutation( const BlockVector< Source >& sources, RadixSortBuffers& buffers )
+{
+  const size_t n = sources.size();
+  assert( n <= RadixSortBuffers::max_num_elements );
+
+  uint64_t max_key = 0;
+  for ( const Source& source : sources )
+  {
+    if ( not source.is_disabled() )
+    {
+      max_key = std::max( max_key, source.get_node_id() );
+    }
+  }
+  // Disabled sources have the largest node ID, use the smallest key that sorts them last instead
+  const uint64_t disabled_key = max_key + 1;
+  const auto key = [ &sources, disabled_key ]( const uint32_t pos )
+  { return sources[ pos ].is_disabled() ? disabled_key : sources[ pos ].get_node_id(); };
+
+  buffers.permutation.resize( n );
+  buffers.permutation_tmp.resize( n );
+  for ( size_t i = 0; i < n; ++i )
+  {
+    buffers.permutation[ i ] = i;
+  }
+
+  const uint64_t digit_mask = ( uint64_t( 1 ) << RADIX_SORT_DIGIT_BITS ) - 1;
+  buffers.counts.resize( digit_mask + 1 );
+  for ( size_t shift = 0; ( disabled_key >> shift ) > 0; shift += RADIX_SORT_DIGIT_BITS )
+  {
+    std::fill( buffers.counts.begin(), buffers.counts.end(), 0 );
+    for ( const uint32_t pos : buffers.permutation )
+    {
+      ++buffers.counts[ ( key( pos ) >> shift ) & digit_mask ];
+    }
+
+    // Exclusive prefix sum yields the first position of each digit value
+    size_t position = 0;
+    for ( size_t& count : buffers.counts )
+    {
+      const size_t num_keys = count;
+      count = position;
+      position += num_keys;
+    }
+
+    for ( const uint32_t pos : buffers.permutation )
+    {
+      buffers.permutation_tmp[ buffers.counts[ ( key( pos ) >> shift ) & digit_mask ]++ ] = pos;
+    }
+    buffers.permutation.swap( buffers.permutation_tmp );
+  }
+}
+
+/**
+ * Reorders vectors in place such that element i becomes the element
+ * previously at position permutation[ i ].
+ *
+ * The elements of all vectors are moved along the cycles of the permutation
+ * in a single pass, so no copies of the vectors are needed. Resets
+ * permutation, a vector or BlockVector of uint32_t, to the identity.
+ */
+template < typename PermutationT, typename... Ts >
+void
+apply_permutation( PermutationT& permutation, BlockVector< Ts >&... vecs )
+{
+  for ( size_t start = 0; start < permutation.size(); ++start )
+  {
+    if ( permutation[ start ] == start )
+    {
+      continue;
+    }
+
+    std::tuple< Ts... > start_elements( std::move( vecs[ start ] )... );
+    size_t pos = start;
+    while ( permutation[ pos ] != start )
+    {
+      const uint32_t next = permutation[ pos ];
+      ( ( vecs[ pos ] = std::move( vecs[ next ] ) ), ... );
+      permutation[ pos ] = pos;
+      pos = next;
+    }
+    std::apply( [ & ]( Ts&... elements ) { ( ( vecs[ pos ] = std::move( elements ) ), ... ); }, start_elements );
+    permutation[ pos ] = pos;
+  }
+}
+
+/**
+ * Sorts sources by node ID with a radix sort and applies the same
+ * permutation to all vecs_perm.
+ */
+template < typename... Ts >
+void
+radix_sort( RadixSortBuffers& buffers, BlockVector< Source >& sources, BlockVector< Ts >&... vecs_perm )
+{
+  radix_sort_permutation( sources, buffers );
+  apply_permutation( buffers.permutation, sources, vecs_perm... );
+}
+
 } // namespace sort
 
 #endif /* #ifndef SORT_H */
@@ -47,6 +47,63 @@ grow( std::vector< T >& v )
   }
 }
 
+/**
+ * Read-only view of a contiguous range of elements.
+ *
+ * Provides the subset of C++20 std::span needed to iterate over parts of
+ * flat vectors without copying them.
+ */
+template < typename T >
+class ConstSpan
+{
+public:
+  ConstSpan()
+    : begin_( nullptr )
+    , end_( nullptr )
+  {
+  }
+
+  ConstSpan( const T* begin, const T* end )
+    : begin_( begin )
+    , end_( end )
+  {
+  }
+
+  const T*
+  begin() const
+  {
+    return begin_;
+  }
+
+  const T*
+  end() const
+  {
+    return end_;
+  }
+
+  size_t
+  size() const
+  {
+    return end_ - begin_;
+  }
+
+  bool
+  empty() const
+  {
+    return begin_ == end_;
+  }
+
+  const T&
+  operator[]( const size_t i ) const
+  {
+    return begin_[ i ];
+  }
+
+private:
+  const T* begin_;
+  const T* end_;
+};
+
 } // namespace vector_util
 
 #endif // VECTOR_UTIL_H
@@ -534,6 +534,12 @@ nest::aeif_cond_alpha::update( Time const& origin, const long from, const long t
   }
 }
 
+bool
+nest::aeif_cond_alpha::supports_update_stealing() const
+{
+  return true;
+}
+
 void
 nest::aeif_cond_alpha::handle( SpikeEvent& e )
 {
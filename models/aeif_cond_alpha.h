@@ -235,6 +235,8 @@ private:
   void pre_run_hook() override;
   void update( Time const&, const long, const long ) override;
 
+  bool supports_update_stealing() const override;
+
   // END Boilerplate function declarations ----------------------------
 
   // Friends --------------------------------------------------------
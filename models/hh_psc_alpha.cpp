@@ -451,6 +451,12 @@ nest::hh_psc_alpha::update( Time const& origin, const long from, const long to )
   }
 }
 
+bool
+nest::hh_psc_alpha::supports_update_stealing() const
+{
+  return true;
+}
+
 void
 nest::hh_psc_alpha::handle( SpikeEvent& e )
 {
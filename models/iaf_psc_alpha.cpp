@@ -23,6 +23,7 @@
 #include "iaf_psc_alpha.h"
 
 // C++ includes:
+#include <algorithm>
 #include <limits>
 
 // Includes from libnestutil:
@@ -306,69 +307,218 @@ iaf_psc_alpha::pre_run_hook()
 void
 iaf_psc_alpha::update( Time const& origin, const long from, const long to )
 {
-  for ( long lag = from; lag < to; ++lag )
-  {
-    if ( S_.r_ == 0 )
-    {
-      // neuron not refractory
-      S_.y3_ = V_.P30_ * ( S_.y0_ + P_.I_e_ ) + V_.P31_ex_ * S_.dI_ex_ + V_.P32_ex_ * S_.I_ex_ + V_.P31_in_ * S_.dI_in_
-        + V_.P32_in_ * S_.I_in_ + V_.expm1_tau_m_ * S_.y3_ + S_.y3_;
+  iaf_psc_alpha* const self = this;
+  update_block_< 1 >( &self, 1, origin, from, to );
+}
 
-      // lower bound of membrane potential
-      S_.y3_ = ( S_.y3_ < P_.LowerBound_ ? P_.LowerBound_ : S_.y3_ );
-    }
-    else
+bool
+iaf_psc_alpha::supports_population_update() const
+{
+  return true;
+}
+
+void
+iaf_psc_alpha::update_population( const std::vector< Node* >& nodes,
+  Time const& origin,
+  const long from,
+  const long to )
+{
+  iaf_psc_alpha* neurons[ population_update_block_size ];
+
+  for ( size_t block_begin = 0; block_begin < nodes.size(); block_begin += population_update_block_size )
+  {
+    const size_t n = std::min( population_update_block_size, nodes.size() - block_begin );
+    for ( size_t i = 0; i < n; ++i )
     {
-      // neuron is absolute refractory
-      --S_.r_;
+      neurons[ i ] = static_cast< iaf_psc_alpha* >( nodes[ block_begin + i ] );
     }
+    update_block_< population_update_block_size >( neurons, n, origin, from, to );
+  }
+}
 
-    // alpha shape EPSCs
-    S_.I_ex_ = V_.P21_ex_ * S_.dI_ex_ + V_.P22_ex_ * S_.I_ex_;
-    S_.dI_ex_ *= V_.P11_ex_;
+template < size_t block_size >
+void
+iaf_psc_alpha::update_block_( iaf_psc_alpha* const* neurons,
+  const size_t num_neurons,
+  Time const& origin,
+  const long from,
+  const long to )
+{
+  assert( 0 < num_neurons and num_neurons <= block_size );
 
-    // get read access to the correct input-buffer slot
-    const size_t input_buffer_slot = kernel().event_delivery_manager.get_modulo( lag );
-    auto& input = B_.input_buffer_.get_values_all_channels( input_buffer_slot );
+  // a constant number of neurons lets the compiler remove the loops for a single neuron
+  const size_t n = block_size == 1 ? 1 : num_neurons;
 
-    // Apply spikes delivered in this step; spikes arriving at T+1 have
-    // an immediate effect on the state of the neuron
-    V_.weighted_spikes_ex_ = input[ Buffers_::SYN_EX ];
-    S_.dI_ex_ += V_.EPSCInitialValue_ * V_.weighted_spikes_ex_;
+  // Parameters and propagators
+  double I_e[ block_size ], LowerBound[ block_size ], Theta[ block_size ], V_reset[ block_size ];
+  double RefractoryCounts[ block_size ], EPSCInitialValue[ block_size ], IPSCInitialValue[ block_size ];
+  double P11_ex[ block_size ], P21_ex[ block_size ], P22_ex[ block_size ], P31_ex[ block_size ], P32_ex[ block_size ];
+  double P11_in[ block_size ], P21_in[ block_size ], P22_in[ block_size ], P31_in[ block_size ], P32_in[ block_size ];
+  double P30[ block_size ], expm1_tau_m[ block_size ];
 
-    // alpha shape EPSCs
-    S_.I_in_ = V_.P21_in_ * S_.dI_in_ + V_.P22_in_ * S_.I_in_;
-    S_.dI_in_ *= V_.P11_in_;
+  // State; the refractory counter is held as double so that all arrays in the loop have the same width
+  double y0[ block_size ], dI_ex[ block_size ], I_ex[ block_size ], dI_in[ block_size ], I_in[ block_size ];
+  double y3[ block_size ], r[ block_size ];
 
-    // Apply spikes delivered in this step; spikes arriving at T+1 have
-    // an immediate effect on the state of the neuron
-    V_.weighted_spikes_in_ = input[ Buffers_::SYN_IN ];
-    S_.dI_in_ += V_.IPSCInitialValue_ * V_.weighted_spikes_in_;
+  // Input and results of one step
+  double spikes_ex[ block_size ], spikes_in[ block_size ], I0[ block_size ];
+  double spiked[ block_size ];
 
-    // threshold crossing
-    if ( S_.y3_ >= P_.Theta_ )
+  bool recorded[ block_size ];
+  bool any_recorded = false;
+
+  for ( size_t i = 0; i < n; ++i )
+  {
+    const iaf_psc_alpha& neuron = *neurons[ i ];
+    recorded[ i ] = neuron.B_.logger_.is_recording();
+    any_recorded = any_recorded or recorded[ i ];
+
+    I_e[ i ] = neuron.P_.I_e_;
+    LowerBound[ i ] = neuron.P_.LowerBound_;
+    Theta[ i ] = neuron.P_.Theta_;
+    V_reset[ i ] = neuron.P_.V_reset_;
+    RefractoryCounts[ i ] = neuron.V_.RefractoryCounts_;
+    EPSCInitialValue[ i ] = neuron.V_.EPSCInitialValue_;
+    IPSCInitialValue[ i ] = neuron.V_.IPSCInitialValue_;
+    P11_ex[ i ] = neuron.V_.P11_ex_;
+    P21_ex[ i ] = neuron.V_.P21_ex_;
+    P22_ex[ i ] = neuron.V_.P22_ex_;
+    P31_ex[ i ] = neuron.V_.P31_ex_;
+    P32_ex[ i ] = neuron.V_.P32_ex_;
+    P11_in[ i ] = neuron.V_.P11_in_;
+    P21_in[ i ] = neuron.V_.P21_in_;
+    P22_in[ i ] = neuron.V_.P22_in_;
+    P31_in[ i ] = neuron.V_.P31_in_;
+    P32_in[ i ] = neuron.V_.P32_in_;
+    P30[ i ] = neuron.V_.P30_;
+    expm1_tau_m[ i ] = neuron.V_.expm1_tau_m_;
+
+    y0[ i ] = neuron.S_.y0_;
+    dI_ex[ i ] = neuron.S_.dI_ex_;
+    I_ex[ i ] = neuron.S_.I_ex_;
+    dI_in[ i ] = neuron.S_.dI_in_;
+    I_in[ i ] = neuron.S_.I_in_;
+    y3[ i ] = neuron.S_.y3_;
+    r[ i ] = neuron.S_.r_;
+
+    spikes_ex[ i ] = neuron.V_.weighted_spikes_ex_;
+    spikes_in[ i ] = neuron.V_.weighted_spikes_in_;
+  }
+
+  for ( long lag = from; lag < to; ++lag )
+  {
+    // get read access to the correct input-buffer slot of all neurons
+    const size_t input_buffer_slot = kernel().event_delivery_manager.get_modulo( lag );
+    for ( size_t i = 0; i < n; ++i )
     {
-      S_.r_ = V_.RefractoryCounts_;
-      S_.y3_ = P_.V_reset_;
-      // A supra-threshold membrane potential should never be observable.
-      // The reset at the time of threshold crossing enables accurate
-      // integration independent of the computation step size, see [2,3] for
-      // details.
-
-      set_spiketime( Time::step( origin.get_steps() + lag + 1 ) );
-      SpikeEvent se;
-      kernel().event_delivery_manager.send( *this, se, lag );
+      auto& input = neurons[ i ]->B_.input_buffer_.get_values_all_channels( input_buffer_slot );
+      spikes_ex[ i ] = input[ Buffers_::SYN_EX ];
+      spikes_in[ i ] = input[ Buffers_::SYN_IN ];
+      I0[ i ] = input[ Buffers_::I0 ];
+
+      // reset all values in the currently processed input-buffer slot
+      neurons[ i ]->B_.input_buffer_.reset_values_all_channels( input_buffer_slot );
     }
 
-    // set new input current
-    S_.y0_ = input[ Buffers_::I0 ];
+    // Branches are replaced by selects so that the loop can be vectorised. The membrane potential
+    // is propagated for all neurons, since GCC does not vectorise floating point operations that
+    // are only executed for some of them.
+    double num_spikes = 0.0;
+#pragma omp simd reduction( + : num_spikes )
+    for ( size_t i = 0; i < n; ++i )
+    {
+      double y3_new = P30[ i ] * ( y0[ i ] + I_e[ i ] ) + P31_ex[ i ] * dI_ex[ i ] + P32_ex[ i ] * I_ex[ i ]
+        + P31_in[ i ] * dI_in[ i ] + P32_in[ i ] * I_in[ i ] + expm1_tau_m[ i ] * y3[ i ] + y3[ i ];
+
+      // lower bound of membrane potential
+      y3_new = ( y3_new < LowerBound[ i ] ? LowerBound[ i ] : y3_new );
+
+      // refractory neurons keep their membrane potential
+      const double y3_i = ( r[ i ] > 0.0 ? y3[ i ] : y3_new );
+      const double r_i = std::max( r[ i ] - 1.0, 0.0 );
+
+      // alpha shape PSCs; spikes arriving at T+1 have an immediate effect on the state of the neuron
+      I_ex[ i ] = P21_ex[ i ] * dI_ex[ i ] + P22_ex[ i ] * I_ex[ i ];
+      dI_ex[ i ] *= P11_ex[ i ];
+      dI_ex[ i ] += EPSCInitialValue[ i ] * spikes_ex[ i ];
+
+      I_in[ i ] = P21_in[ i ] * dI_in[ i ] + P22_in[ i ] * I_in[ i ];
+      dI_in[ i ] *= P11_in[ i ];
+      dI_in[ i ] += IPSCInitialValue[ i ] * spikes_in[ i ];
+
+      // threshold crossing; a supra-threshold membrane potential should never be observable.
+      // The reset at the time of threshold crossing enables accurate integration independent
+      // of the computation step size, see [2,3] for details.
+      spiked[ i ] = ( y3_i >= Theta[ i ] ? 1.0 : 0.0 );
+      y3[ i ] = ( y3_i >= Theta[ i ] ? V_reset[ i ] : y3_i );
+      r[ i ] = ( y3_i >= Theta[ i ] ? RefractoryCounts[ i ] : r_i );
+      num_spikes += spiked[ i ];
+
+      // set new input current
+      y0[ i ] = I0[ i ];
+    }
 
-    // reset all values in the currently processed input-buffer slot
-    B_.input_buffer_.reset_values_all_channels( input_buffer_slot );
+    if ( num_spikes == 0.0 and not any_recorded )
+    {
+      continue;
+    }
 
-    // log state data
-    B_.logger_.record_data( origin.get_steps() + lag );
+    for ( size_t i = 0; i < n; ++i )
+    {
+      if ( spiked[ i ] > 0.0 )
+      {
+        neurons[ i ]->set_spiketime( Time::step( origin.get_steps() + lag + 1 ) );
+        SpikeEvent se;
+        kernel().event_delivery_manager.send( *neurons[ i ], se, lag );
+      }
+
+      if ( recorded[ i ] )
+      {
+        // the logger reads the state of the neuron
+        State_& S = neurons[ i ]->S_;
+        S.y0_ = y0[ i ];
+        S.dI_ex_ = dI_ex[ i ];
+        S.I_ex_ = I_ex[ i ];
+        S.dI_in_ = dI_in[ i ];
+        S.I_in_ = I_in[ i ];
+        S.y3_ = y3[ i ];
+        S.r_ = static_cast< int >( r[ i ] );
+        neurons[ i ]->B_.logger_.record_data( origin.get_steps() + lag );
+      }
+    }
   }
+
+  for ( size_t i = 0; i < n; ++i )
+  {
+    iaf_psc_alpha& neuron = *neurons[ i ];
+    neuron.S_.y0_ = y0[ i ];
+    neuron.S_.dI_ex_ = dI_ex[ i ];
+    neuron.S_.I_ex_ = I_ex[ i ];
+    neuron.S_.dI_in_ = dI_in[ i ];
+    neuron.S_.I_in_ = I_in[ i ];
+    neuron.S_.y3_ = y3[ i ];
+    neuron.S_.r_ = static_cast< int >( r[ i ] );
+    neuron.V_.weighted_spikes_ex_ = spikes_ex[ i ];
+    neuron.V_.weighted_spikes_in_ = spikes_in[ i ];
+  }
+}
+
+bool
+iaf_psc_alpha::supports_update_stealing() const
+{
+  return true;
+}
+
+size_t
+iaf_psc_alpha::get_input_buffer_pool_channels() const
+{
+  return Buffers_::NUM_INPUT_CHANNELS;
+}
+
+void
+iaf_psc_alpha::set_input_buffer_pool( double* first, const size_t stride )
+{
+  B_.input_buffer_.use_external_storage( first, stride );
 }
 
 void
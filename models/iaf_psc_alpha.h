@@ -244,6 +244,24 @@ private:
 
   void update( Time const&, const long, const long ) override;
 
+  bool supports_population_update() const override;
+  void update_population( const std::vector< Node* >&, Time const&, const long, const long ) override;
+
+  /**
+   * Advance n <= block_size neurons from step from to step to.
+   *
+   * Holds the state of the neurons in arrays and advances it with one vectorisable loop per step.
+   * update() calls it for a single neuron, update_population() for blocks of neurons, so that both
+   * share the same arithmetic.
+   */
+  template < size_t block_size >
+  static void update_block_( iaf_psc_alpha* const*, const size_t, Time const&, const long, const long );
+
+  bool supports_update_stealing() const override;
+
+  size_t get_input_buffer_pool_channels() const override;
+  void set_input_buffer_pool( double*, const size_t ) override;
+
   // The next two classes need to be friends to access the State_ class/member
   friend class RecordablesMap< iaf_psc_alpha >;
   friend class UniversalDataLogger< iaf_psc_alpha >;
@@ -25,6 +25,7 @@
 #include "iaf_psc_delta.h"
 
 // C++ includes:
+#include <algorithm>
 #include <limits>
 
 // Includes from libnestutil:
@@ -274,63 +275,176 @@ nest::iaf_psc_delta::pre_run_hook()
 void
 nest::iaf_psc_delta::update( Time const& origin, const long from, const long to )
 {
+  iaf_psc_delta* const self = this;
+  update_block_< 1 >( &self, 1, origin, from, to );
+}
+
+bool
+nest::iaf_psc_delta::supports_population_update() const
+{
+  return true;
+}
+
+void
+nest::iaf_psc_delta::update_population( const std::vector< Node* >& nodes,
+  Time const& origin,
+  const long from,
+  const long to )
+{
+  iaf_psc_delta* neurons[ population_update_block_size ];
+
+  for ( size_t block_begin = 0; block_begin < nodes.size(); block_begin += population_update_block_size )
+  {
+    const size_t n = std::min( population_update_block_size, nodes.size() - block_begin );
+    for ( size_t i = 0; i < n; ++i )
+    {
+      neurons[ i ] = static_cast< iaf_psc_delta* >( nodes[ block_begin + i ] );
+    }
+    update_block_< population_update_block_size >( neurons, n, origin, from, to );
+  }
+}
+
+template < size_t block_size >
+void
+nest::iaf_psc_delta::update_block_( iaf_psc_delta* const* neurons,
+  const size_t num_neurons,
+  Time const& origin,
+  const long from,
+  const long to )
+{
+  assert( 0 < num_neurons and num_neurons <= block_size );
+
+  // a constant number of neurons lets the compiler remove the loops for a single neuron
+  const size_t n = block_size == 1 ? 1 : num_neurons;
   const double h = Time::get_resolution().get_ms();
+
+  // Parameters and propagators
+  double I_e[ block_size ], V_min[ block_size ], V_th[ block_size ], V_reset[ block_size ];
+  double RefractoryCounts[ block_size ], P30[ block_size ], P33[ block_size ];
+
+  // State; the refractory counter is held as double so that all arrays in the loop have the same width
+  double y0[ block_size ], y3[ block_size ], r[ block_size ];
+
+  // Input and results of one step
+  double spikes[ block_size ], refr_spikes[ block_size ], currents[ block_size ];
+  double spiked[ block_size ];
+
+  bool recorded[ block_size ];
+  bool any_recorded = false;
+
+  for ( size_t i = 0; i < n; ++i )
+  {
+    const iaf_psc_delta& neuron = *neurons[ i ];
+    recorded[ i ] = neuron.B_.logger_.is_recording();
+    any_recorded = any_recorded or recorded[ i ];
+
+    I_e[ i ] = neuron.P_.I_e_;
+    V_min[ i ] = neuron.P_.V_min_;
+    V_th[ i ] = neuron.P_.V_th_;
+    V_reset[ i ] = neuron.P_.V_reset_;
+    RefractoryCounts[ i ] = neuron.V_.RefractoryCounts_;
+    P30[ i ] = neuron.V_.P30_;
+    P33[ i ] = neuron.V_.P33_;
+
+    y0[ i ] = neuron.S_.y0_;
+    y3[ i ] = neuron.S_.y3_;
+    r[ i ] = neuron.S_.r_;
+  }
+
   for ( long lag = from; lag < to; ++lag )
   {
-    if ( S_.r_ == 0 )
+    for ( size_t i = 0; i < n; ++i )
     {
-      // neuron not refractory
-      S_.y3_ = V_.P30_ * ( S_.y0_ + P_.I_e_ ) + V_.P33_ * S_.y3_ + B_.spikes_.get_value( lag );
+      iaf_psc_delta& neuron = *neurons[ i ];
+      spikes[ i ] = neuron.B_.spikes_.get_value( lag );
+      currents[ i ] = neuron.B_.currents_.get_value( lag );
+      refr_spikes[ i ] = 0.0;
 
-      // if we have accumulated spikes from refractory period,
-      // add and reset accumulator
-      if ( P_.with_refr_input_ and S_.refr_spikes_buffer_ != 0.0 )
+      if ( neuron.P_.with_refr_input_ )
       {
-        S_.y3_ += S_.refr_spikes_buffer_;
-        S_.refr_spikes_buffer_ = 0.0;
+        if ( r[ i ] > 0.0 )
+        {
+          // accumulate spikes arriving during the refractory period, discounting
+          // for decay until end of refractory period
+          neuron.S_.refr_spikes_buffer_ += spikes[ i ] * std::exp( -r[ i ] * h / neuron.P_.tau_m_ );
+        }
+        else
+        {
+          // add accumulated spikes from the refractory period and reset accumulator
+          refr_spikes[ i ] = neuron.S_.refr_spikes_buffer_;
+          neuron.S_.refr_spikes_buffer_ = 0.0;
+        }
       }
-
-      // lower bound of membrane potential
-      S_.y3_ = ( S_.y3_ < P_.V_min_ ? P_.V_min_ : S_.y3_ );
     }
-    else // neuron is absolute refractory
+
+    // Branches are replaced by selects so that the loop can be vectorised. The membrane potential
+    // is propagated for all neurons, since GCC does not vectorise floating point operations that
+    // are only executed for some of them.
+    double num_spikes = 0.0;
+#pragma omp simd reduction( + : num_spikes )
+    for ( size_t i = 0; i < n; ++i )
     {
-      // read spikes from buffer and accumulate them, discounting
-      // for decay until end of refractory period
-      if ( P_.with_refr_input_ )
-      {
-        S_.refr_spikes_buffer_ += B_.spikes_.get_value( lag ) * std::exp( -S_.r_ * h / P_.tau_m_ );
-      }
-      else
-      {
-        // clear buffer entry, ignore spike
-        B_.spikes_.get_value( lag );
-      }
+      double y3_new = P30[ i ] * ( y0[ i ] + I_e[ i ] ) + P33[ i ] * y3[ i ] + spikes[ i ] + refr_spikes[ i ];
+
+      // lower bound of membrane potential
+      y3_new = ( y3_new < V_min[ i ] ? V_min[ i ] : y3_new );
+
+      // refractory neurons keep their membrane potential and ignore input
+      const double y3_i = ( r[ i ] > 0.0 ? y3[ i ] : y3_new );
+      const double r_i = std::max( r[ i ] - 1.0, 0.0 );
+
+      // threshold crossing
+      spiked[ i ] = ( y3_i >= V_th[ i ] ? 1.0 : 0.0 );
+      y3[ i ] = ( y3_i >= V_th[ i ] ? V_reset[ i ] : y3_i );
+      r[ i ] = ( y3_i >= V_th[ i ] ? RefractoryCounts[ i ] : r_i );
+      num_spikes += spiked[ i ];
 
-      --S_.r_;
+      // set new input current
+      y0[ i ] = currents[ i ];
     }
 
-    // threshold crossing
-    if ( S_.y3_ >= P_.V_th_ )
+    if ( num_spikes == 0.0 and not any_recorded )
     {
-      S_.r_ = V_.RefractoryCounts_;
-      S_.y3_ = P_.V_reset_;
+      continue;
+    }
 
-      // EX: must compute spike time
-      set_spiketime( Time::step( origin.get_steps() + lag + 1 ) );
+    for ( size_t i = 0; i < n; ++i )
+    {
+      if ( spiked[ i ] > 0.0 )
+      {
+        // EX: must compute spike time
+        neurons[ i ]->set_spiketime( Time::step( origin.get_steps() + lag + 1 ) );
+        SpikeEvent se;
+        kernel().event_delivery_manager.send( *neurons[ i ], se, lag );
+      }
 
-      SpikeEvent se;
-      kernel().event_delivery_manager.send( *this, se, lag );
+      if ( recorded[ i ] )
+      {
+        // the logger reads the state of the neuron
+        State_& S = neurons[ i ]->S_;
+        S.y0_ = y0[ i ];
+        S.y3_ = y3[ i ];
+        S.r_ = static_cast< int >( r[ i ] );
+        neurons[ i ]->B_.logger_.record_data( origin.get_steps() + lag );
+      }
     }
+  }
 
-    // set new input current
-    S_.y0_ = B_.currents_.get_value( lag );
-
-    // voltage logging
-    B_.logger_.record_data( origin.get_steps() + lag );
+  for ( size_t i = 0; i < n; ++i )
+  {
+    iaf_psc_delta& neuron = *neurons[ i ];
+    neuron.S_.y0_ = y0[ i ];
+    neuron.S_.y3_ = y3[ i ];
+    neuron.S_.r_ = static_cast< int >( r[ i ] );
   }
 }
 
+bool
+nest::iaf_psc_delta::supports_update_stealing() const
+{
+  return true;
+}
+
 void
 nest::iaf_psc_delta::handle( SpikeEvent& e )
 {
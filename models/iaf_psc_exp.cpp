@@ -22,6 +22,10 @@
 
 #include "iaf_psc_exp.h"
 
+// C++ includes:
+#include <algorithm>
+#include <limits>
+#include <type_traits>
 
 // Includes from libnestutil:
 #include "dict_util.h"
@@ -44,26 +48,43 @@
  * Recordables map
  * ---------------------------------------------------------------- */
 
-nest::RecordablesMap< nest::iaf_psc_exp > nest::iaf_psc_exp::recordablesMap_;
+template < typename TBufferValue >
+nest::RecordablesMap< nest::iaf_psc_exp< TBufferValue > > nest::iaf_psc_exp< TBufferValue >::recordablesMap_;
 
 namespace nest
 {
 void
 register_iaf_psc_exp( const std::string& name )
 {
-  register_node_model< iaf_psc_exp >( name );
+  register_node_model< iaf_psc_exp<> >( name );
+}
+
+void
+register_iaf_psc_exp_f32( const std::string& name )
+{
+  register_node_model< iaf_psc_exp_f32 >( name );
 }
 
 // Override the create() method with one call to RecordablesMap::insert_()
 // for each quantity to be recorded.
 template <>
 void
-RecordablesMap< iaf_psc_exp >::create()
+RecordablesMap< iaf_psc_exp<> >::create()
+{
+  // use standard names wherever you can for consistency!
+  insert_( names::V_m, &iaf_psc_exp<>::get_V_m_ );
+  insert_( names::I_syn_ex, &iaf_psc_exp<>::get_I_syn_ex_ );
+  insert_( names::I_syn_in, &iaf_psc_exp<>::get_I_syn_in_ );
+}
+
+template <>
+void
+RecordablesMap< iaf_psc_exp_f32 >::create()
 {
   // use standard names wherever you can for consistency!
-  insert_( names::V_m, &iaf_psc_exp::get_V_m_ );
-  insert_( names::I_syn_ex, &iaf_psc_exp::get_I_syn_ex_ );
-  insert_( names::I_syn_in, &iaf_psc_exp::get_I_syn_in_ );
+  insert_( names::V_m, &iaf_psc_exp_f32::get_V_m_ );
+  insert_( names::I_syn_ex, &iaf_psc_exp_f32::get_I_syn_ex_ );
+  insert_( names::I_syn_in, &iaf_psc_exp_f32::get_I_syn_in_ );
 }
 }
 
@@ -71,7 +92,8 @@ RecordablesMap< iaf_psc_exp >::create()
  * Default constructors defining default parameters and state
  * ---------------------------------------------------------------- */
 
-nest::iaf_psc_exp::Parameters_::Parameters_()
+template < typename TBufferValue >
+nest::iaf_psc_exp< TBufferValue >::Parameters_::Parameters_()
   : Tau_( 10.0 )             // in ms
   , C_( 250.0 )              // in pF
   , t_ref_( 2.0 )            // in ms
@@ -86,7 +108,8 @@ nest::iaf_psc_exp::Parameters_::Parameters_()
 {
 }
 
-nest::iaf_psc_exp::State_::State_()
+template < typename TBufferValue >
+nest::iaf_psc_exp< TBufferValue >::State_::State_()
   : i_0_( 0.0 )
   , i_1_( 0.0 )
   , i_syn_ex_( 0.0 )
@@ -100,8 +123,9 @@ nest::iaf_psc_exp::State_::State_()
  * Parameter and state extractions and manipulation functions
  * ---------------------------------------------------------------- */
 
+template < typename TBufferValue >
 void
-nest::iaf_psc_exp::Parameters_::get( DictionaryDatum& d ) const
+nest::iaf_psc_exp< TBufferValue >::Parameters_::get( DictionaryDatum& d ) const
 {
   def< double >( d, names::E_L, E_L_ ); // resting potential
   def< double >( d, names::I_e, I_e_ );
@@ -116,8 +140,9 @@ nest::iaf_psc_exp::Parameters_::get( DictionaryDatum& d ) const
   def< double >( d, names::delta, delta_ );
 }
 
+template < typename TBufferValue >
 double
-nest::iaf_psc_exp::Parameters_::set( const DictionaryDatum& d, Node* node )
+nest::iaf_psc_exp< TBufferValue >::Parameters_::set( const DictionaryDatum& d, Node* node )
 {
   // if E_L_ is changed, we need to adjust all variables defined relative to
   // E_L_
@@ -181,14 +206,19 @@ nest::iaf_psc_exp::Parameters_::set( const DictionaryDatum& d, Node* node )
   return delta_EL;
 }
 
+template < typename TBufferValue >
 void
-nest::iaf_psc_exp::State_::get( DictionaryDatum& d, const Parameters_& p ) const
+nest::iaf_psc_exp< TBufferValue >::State_::get( DictionaryDatum& d, const Parameters_& p ) const
 {
   def< double >( d, names::V_m, V_m_ + p.E_L_ ); // Membrane potential
 }
 
+template < typename TBufferValue >
 void
-nest::iaf_psc_exp::State_::set( const DictionaryDatum& d, const Parameters_& p, double delta_EL, Node* node )
+nest::iaf_psc_exp< TBufferValue >::State_::set( const DictionaryDatum& d,
+  const Parameters_& p,
+  double delta_EL,
+  Node* node )
 {
   if ( updateValueParam< double >( d, names::V_m, V_m_, node ) )
   {
@@ -200,12 +230,14 @@ nest::iaf_psc_exp::State_::set( const DictionaryDatum& d, const Parameters_& p,
   }
 }
 
-nest::iaf_psc_exp::Buffers_::Buffers_( iaf_psc_exp& n )
+template < typename TBufferValue >
+nest::iaf_psc_exp< TBufferValue >::Buffers_::Buffers_( iaf_psc_exp& n )
   : logger_( n )
 {
 }
 
-nest::iaf_psc_exp::Buffers_::Buffers_( const Buffers_&, iaf_psc_exp& n )
+template < typename TBufferValue >
+nest::iaf_psc_exp< TBufferValue >::Buffers_::Buffers_( const Buffers_&, iaf_psc_exp& n )
   : logger_( n )
 {
 }
@@ -214,7 +246,8 @@ nest::iaf_psc_exp::Buffers_::Buffers_( const Buffers_&, iaf_psc_exp& n )
  * Default and copy constructor for node
  * ---------------------------------------------------------------- */
 
-nest::iaf_psc_exp::iaf_psc_exp()
+template < typename TBufferValue >
+nest::iaf_psc_exp< TBufferValue >::iaf_psc_exp()
   : ArchivingNode()
   , P_()
   , S_()
@@ -223,7 +256,8 @@ nest::iaf_psc_exp::iaf_psc_exp()
   recordablesMap_.create();
 }
 
-nest::iaf_psc_exp::iaf_psc_exp( const iaf_psc_exp& n )
+template < typename TBufferValue >
+nest::iaf_psc_exp< TBufferValue >::iaf_psc_exp( const iaf_psc_exp& n )
   : ArchivingNode( n )
   , P_( n.P_ )
   , S_( n.S_ )
@@ -235,16 +269,18 @@ nest::iaf_psc_exp::iaf_psc_exp( const iaf_psc_exp& n )
  * Node initialization functions
  * ---------------------------------------------------------------- */
 
+template < typename TBufferValue >
 void
-nest::iaf_psc_exp::init_buffers_()
+nest::iaf_psc_exp< TBufferValue >::init_buffers_()
 {
   B_.input_buffer_.clear(); // includes resize
   B_.logger_.reset();
   ArchivingNode::clear_history();
 }
 
+template < typename TBufferValue >
 void
-nest::iaf_psc_exp::pre_run_hook()
+nest::iaf_psc_exp< TBufferValue >::pre_run_hook()
 {
   // ensures initialization in case mm connected after Simulate
   B_.logger_.init();
@@ -287,71 +323,262 @@ nest::iaf_psc_exp::pre_run_hook()
   V_.rng_ = get_vp_specific_rng( get_thread() );
 }
 
+template < typename TBufferValue >
 void
-nest::iaf_psc_exp::update( const Time& origin, const long from, const long to )
+nest::iaf_psc_exp< TBufferValue >::update( const Time& origin, const long from, const long to )
 {
-  const double h = Time::get_resolution().get_ms();
+  iaf_psc_exp* const self = this;
+  update_block_< 1 >( &self, 1, origin, from, to );
+}
 
-  // evolve from timestep 'from' to timestep 'to' with steps of h each
-  for ( long lag = from; lag < to; ++lag )
+template < typename TBufferValue >
+bool
+nest::iaf_psc_exp< TBufferValue >::supports_population_update() const
+{
+  // the stochastic threshold draws from the random number generator of the thread in node order
+  return P_.delta_ < 1e-10;
+}
+
+template < typename TBufferValue >
+void
+nest::iaf_psc_exp< TBufferValue >::update_population( const std::vector< Node* >& nodes,
+  Time const& origin,
+  const long from,
+  const long to )
+{
+  iaf_psc_exp* neurons[ population_update_block_size ];
+
+  for ( size_t block_begin = 0; block_begin < nodes.size(); block_begin += population_update_block_size )
   {
-    if ( S_.r_ref_ == 0 ) // neuron not refractory, so evolve V
-    {
-      S_.V_m_ =
-        S_.V_m_ * V_.P22_ + S_.i_syn_ex_ * V_.P21ex_ + S_.i_syn_in_ * V_.P21in_ + ( P_.I_e_ + S_.i_0_ ) * V_.P20_;
-    }
-    else
+    const size_t n = std::min( population_update_block_size, nodes.size() - block_begin );
+    for ( size_t i = 0; i < n; ++i )
     {
-      // neuron is absolute refractory
-      --S_.r_ref_;
+      neurons[ i ] = static_cast< iaf_psc_exp* >( nodes[ block_begin + i ] );
     }
+    update_block_< population_update_block_size >( neurons, n, origin, from, to );
+  }
+}
 
-    // exponential decaying PSCs
-    S_.i_syn_ex_ *= V_.P11ex_;
-    S_.i_syn_in_ *= V_.P11in_;
+template < typename TBufferValue >
+template < size_t block_size >
+void
+nest::iaf_psc_exp< TBufferValue >::update_block_( iaf_psc_exp* const* neurons,
+  const size_t num_neurons,
+  Time const& origin,
+  const long from,
+  const long to )
+{
+  assert( 0 < num_neurons and num_neurons <= block_size );
+
+  // a constant number of neurons lets the compiler remove the loops for a single neuron
+  const size_t n = block_size == 1 ? 1 : num_neurons;
+  const double h = Time::get_resolution().get_ms();
 
-    // add evolution of presynaptic input current
-    S_.i_syn_ex_ += ( 1. - V_.P11ex_ ) * S_.i_1_;
+  // Parameters and propagators
+  double I_e[ block_size ], Theta[ block_size ], V_reset[ block_size ], RefractoryCounts[ block_size ];
+  double P11ex[ block_size ], P11in[ block_size ], P21ex[ block_size ], P21in[ block_size ];
+  double P22[ block_size ], P20[ block_size ];
 
-    // get read access to the correct input-buffer slot
-    const size_t input_buffer_slot = kernel().event_delivery_manager.get_modulo( lag );
-    auto& input = B_.input_buffer_.get_values_all_channels( input_buffer_slot );
+  // State; the refractory counter is held as double so that all arrays in the loop have the same width
+  double V_m[ block_size ], i_syn_ex[ block_size ], i_syn_in[ block_size ], i_0[ block_size ], i_1[ block_size ];
+  double r_ref[ block_size ];
+
+  // Input and results of one step
+  double spikes_ex[ block_size ], spikes_in[ block_size ], I0[ block_size ], I1[ block_size ];
+  double V_m_next[ block_size ], spiked[ block_size ];
+
+  bool recorded[ block_size ];
+  bool any_recorded = false;
+  bool stochastic[ block_size ];
+  bool any_stochastic = false;
+
+  for ( size_t i = 0; i < n; ++i )
+  {
+    const iaf_psc_exp& neuron = *neurons[ i ];
+    recorded[ i ] = neuron.B_.logger_.is_recording();
+    any_recorded = any_recorded or recorded[ i ];
+    stochastic[ i ] = neuron.P_.delta_ > 1e-10;
+    any_stochastic = any_stochastic or stochastic[ i ];
+
+    I_e[ i ] = neuron.P_.I_e_;
+    V_reset[ i ] = neuron.P_.V_reset_;
+    RefractoryCounts[ i ] = neuron.V_.RefractoryCounts_;
+    P11ex[ i ] = neuron.V_.P11ex_;
+    P11in[ i ] = neuron.V_.P11in_;
+    P21ex[ i ] = neuron.V_.P21ex_;
+    P21in[ i ] = neuron.V_.P21in_;
+    P22[ i ] = neuron.V_.P22_;
+    P20[ i ] = neuron.V_.P20_;
+
+    // only neurons with a deterministic threshold cross it in the vectorised loop
+    Theta[ i ] = neuron.P_.delta_ < 1e-10 ? neuron.P_.Theta_ : std::numeric_limits< double >::infinity();
+
+    V_m[ i ] = neuron.S_.V_m_;
+    i_syn_ex[ i ] = neuron.S_.i_syn_ex_;
+    i_syn_in[ i ] = neuron.S_.i_syn_in_;
+    i_0[ i ] = neuron.S_.i_0_;
+    i_1[ i ] = neuron.S_.i_1_;
+    r_ref[ i ] = neuron.S_.r_ref_;
+
+    spikes_ex[ i ] = neuron.V_.weighted_spikes_ex_;
+    spikes_in[ i ] = neuron.V_.weighted_spikes_in_;
+  }
 
-    // the spikes arriving at T+1 have an immediate effect on the state of the
-    // neuron
+  for ( long lag = from; lag < to; ++lag )
+  {
+    // get read access to the correct input-buffer slot of all neurons
+    const size_t input_buffer_slot = kernel().event_delivery_manager.get_modulo( lag );
+    for ( size_t i = 0; i < n; ++i )
+    {
+      auto& input = neurons[ i ]->B_.input_buffer_.get_values_all_channels( input_buffer_slot );
+      spikes_ex[ i ] = input[ Buffers_::SYN_EX ];
+      spikes_in[ i ] = input[ Buffers_::SYN_IN ];
+      I0[ i ] = input[ Buffers_::I0 ];
+      I1[ i ] = input[ Buffers_::I1 ];
+
+      // reset all values in the currently processed input-buffer slot
+      neurons[ i ]->B_.input_buffer_.reset_values_all_channels( input_buffer_slot );
+    }
 
-    V_.weighted_spikes_ex_ = input[ Buffers_::SYN_EX ];
-    V_.weighted_spikes_in_ = input[ Buffers_::SYN_IN ];
+    // Branches are replaced by selects so that the loops can be vectorised. The membrane potential
+    // is propagated for all neurons in a separate loop, since GCC does not vectorise floating point
+    // operations that are only executed for some of them.
+#pragma omp simd
+    for ( size_t i = 0; i < n; ++i )
+    {
+      V_m_next[ i ] = V_m[ i ] * P22[ i ] + i_syn_ex[ i ] * P21ex[ i ] + i_syn_in[ i ] * P21in[ i ]
+        + ( I_e[ i ] + i_0[ i ] ) * P20[ i ];
+    }
 
-    S_.i_syn_ex_ += V_.weighted_spikes_ex_;
-    S_.i_syn_in_ += V_.weighted_spikes_in_;
+    double num_spikes = 0.0;
+#pragma omp simd reduction( + : num_spikes )
+    for ( size_t i = 0; i < n; ++i )
+    {
+      // refractory neurons keep their membrane potential
+      const double V_m_i = ( r_ref[ i ] > 0.0 ? V_m[ i ] : V_m_next[ i ] );
+      const double r_ref_i = std::max( r_ref[ i ] - 1.0, 0.0 );
+
+      // exponential decaying PSCs
+      i_syn_ex[ i ] *= P11ex[ i ];
+      i_syn_in[ i ] *= P11in[ i ];
+
+      // add evolution of presynaptic input current
+      i_syn_ex[ i ] += ( 1. - P11ex[ i ] ) * i_1[ i ];
+
+      // the spikes arriving at T+1 have an immediate effect on the state of the neuron
+      i_syn_ex[ i ] += spikes_ex[ i ];
+      i_syn_in[ i ] += spikes_in[ i ];
+
+      // deterministic threshold crossing
+      spiked[ i ] = ( V_m_i >= Theta[ i ] ? 1.0 : 0.0 );
+      V_m[ i ] = ( V_m_i >= Theta[ i ] ? V_reset[ i ] : V_m_i );
+      r_ref[ i ] = ( V_m_i >= Theta[ i ] ? RefractoryCounts[ i ] : r_ref_i );
+      num_spikes += spiked[ i ];
+
+      // set new input current
+      i_0[ i ] = I0[ i ];
+      i_1[ i ] = I1[ i ];
+    }
 
-    if ( ( P_.delta_ < 1e-10 and S_.V_m_ >= P_.Theta_ )                   // deterministic threshold crossing
-      or ( P_.delta_ > 1e-10 and V_.rng_->drand() < phi_() * h * 1e-3 ) ) // stochastic threshold crossing
+    if ( any_stochastic )
     {
-      S_.r_ref_ = V_.RefractoryCounts_;
-      S_.V_m_ = P_.V_reset_;
+      for ( size_t i = 0; i < n; ++i )
+      {
+        if ( not stochastic[ i ] )
+        {
+          continue;
+        }
+
+        // phi_() reads the membrane potential of the neuron
+        iaf_psc_exp& neuron = *neurons[ i ];
+        neuron.S_.V_m_ = V_m[ i ];
+        if ( neuron.V_.rng_->drand() < neuron.phi_() * h * 1e-3 )
+        {
+          // stochastic threshold crossing
+          spiked[ i ] = 1.0;
+          V_m[ i ] = V_reset[ i ];
+          r_ref[ i ] = RefractoryCounts[ i ];
+          num_spikes += 1.0;
+        }
+      }
+    }
 
-      set_spiketime( Time::step( origin.get_steps() + lag + 1 ) );
+    if ( num_spikes == 0.0 and not any_recorded )
+    {
+      continue;
+    }
 
-      SpikeEvent se;
-      kernel().event_delivery_manager.send( *this, se, lag );
+    for ( size_t i = 0; i < n; ++i )
+    {
+      if ( spiked[ i ] > 0.0 )
+      {
+        neurons[ i ]->set_spiketime( Time::step( origin.get_steps() + lag + 1 ) );
+        SpikeEvent se;
+        kernel().event_delivery_manager.send( *neurons[ i ], se, lag );
+      }
+
+      if ( recorded[ i ] )
+      {
+        // the logger reads the state of the neuron
+        State_& S = neurons[ i ]->S_;
+        S.V_m_ = V_m[ i ];
+        S.i_syn_ex_ = i_syn_ex[ i ];
+        S.i_syn_in_ = i_syn_in[ i ];
+        S.i_0_ = i_0[ i ];
+        S.i_1_ = i_1[ i ];
+        S.r_ref_ = static_cast< int >( r_ref[ i ] );
+        neurons[ i ]->B_.logger_.record_data( origin.get_steps() + lag );
+      }
     }
+  }
 
-    // set new input current
-    S_.i_0_ = input[ Buffers_::I0 ];
-    S_.i_1_ = input[ Buffers_::I1 ];
+  for ( size_t i = 0; i < n; ++i )
+  {
+    iaf_psc_exp& neuron = *neurons[ i ];
+    neuron.S_.V_m_ = V_m[ i ];
+    neuron.S_.i_syn_ex_ = i_syn_ex[ i ];
+    neuron.S_.i_syn_in_ = i_syn_in[ i ];
+    neuron.S_.i_0_ = i_0[ i ];
+    neuron.S_.i_1_ = i_1[ i ];
+    neuron.S_.r_ref_ = static_cast< int >( r_ref[ i ] );
+    neuron.V_.weighted_spikes_ex_ = spikes_ex[ i ];
+    neuron.V_.weighted_spikes_in_ = spikes_in[ i ];
+  }
+}
+
+template < typename TBufferValue >
+bool
+nest::iaf_psc_exp< TBufferValue >::supports_update_stealing() const
+{
+  // the stochastic threshold draws from the random number generator of the thread
+  return P_.delta_ < 1e-10;
+}
 
-    // reset all values in the currently processed input-buffer slot
-    B_.input_buffer_.reset_values_all_channels( input_buffer_slot );
+template < typename TBufferValue >
+size_t
+nest::iaf_psc_exp< TBufferValue >::get_input_buffer_pool_channels() const
+{
+  // input buffer pools hold values of type double
+  return std::is_same< TBufferValue, double >::value ? Buffers_::NUM_INPUT_CHANNELS : 0;
+}
 
-    // log state data
-    B_.logger_.record_data( origin.get_steps() + lag );
+template < typename TBufferValue >
+void
+nest::iaf_psc_exp< TBufferValue >::set_input_buffer_pool( double* first, const size_t stride )
+{
+  if constexpr ( std::is_same< TBufferValue, double >::value )
+  {
+    B_.input_buffer_.use_external_storage( first, stride );
+  }
+  else
+  {
+    ArchivingNode::set_input_buffer_pool( first, stride );
   }
 }
 
+template < typename TBufferValue >
 void
-nest::iaf_psc_exp::handle( SpikeEvent& e )
+nest::iaf_psc_exp< TBufferValue >::handle( SpikeEvent& e )
 {
   assert( e.get_delay_steps() > 0 );
 
@@ -364,8 +591,9 @@ nest::iaf_psc_exp::handle( SpikeEvent& e )
   B_.input_buffer_.add_value( input_buffer_slot, s > 0 ? Buffers_::SYN_EX : Buffers_::SYN_IN, s );
 }
 
+template < typename TBufferValue >
 void
-nest::iaf_psc_exp::handle( CurrentEvent& e )
+nest::iaf_psc_exp< TBufferValue >::handle( CurrentEvent& e )
 {
   assert( e.get_delay_steps() > 0 );
 
@@ -385,8 +613,13 @@ nest::iaf_psc_exp::handle( CurrentEvent& e )
   }
 }
 
+template < typename TBufferValue >
 void
-nest::iaf_psc_exp::handle( DataLoggingRequest& e )
+nest::iaf_psc_exp< TBufferValue >::handle( DataLoggingRequest& e )
 {
   B_.logger_.handle( e );
 }
+
+// Instantiate the model for input buffers in double and single precision
+template class nest::iaf_psc_exp< double >;
+template class nest::iaf_psc_exp< float >;
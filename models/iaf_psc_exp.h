@@ -162,6 +162,21 @@ For conversion between postsynaptic potentials (PSPs) and PSCs,
 please refer to the ``postsynaptic_potential_to_current`` function in
 :doc:`PyNEST Microcircuit: Helper Functions <../auto_examples/Potjans_2014/helpers>`.
 
+Single-precision input buffer
+.............................
+
+``iaf_psc_exp_f32`` is ``iaf_psc_exp`` with the input arriving with spike and
+current events stored in single precision. This halves the memory occupied by
+the input buffers and thus the memory traffic of spike delivery. The membrane
+potential and the synaptic currents are still integrated in double precision,
+so results differ from ``iaf_psc_exp`` only by the rounding of the buffered
+input. They are identical if all partial sums of the input are exactly
+representable in single precision, e.g., for small integer weights. Combine it
+with ``static_synapse_f32`` to store the synaptic weights in single precision as
+well. ``iaf_psc_exp_f32`` does not support input buffer pools, as the pools hold
+double-precision values: if ``use_input_buffer_pools`` is set, its neurons keep
+their input buffers and only the neurons of other models are pooled.
+
 Parameters
 ++++++++++
 
@@ -248,10 +263,15 @@ EndUserDocs */
  * optimization levels. A future version of iaf_psc_exp will probably
  * address the problem of efficient usage of appropriate vector and
  * matrix objects.
+ *
+ * The template parameter is the value type of the input buffer. The model
+ * iaf_psc_exp_f32 keeps its input buffer in single precision.
  */
 
 void register_iaf_psc_exp( const std::string& name );
+void register_iaf_psc_exp_f32( const std::string& name );
 
+template < typename TBufferValue = double >
 class iaf_psc_exp : public ArchivingNode
 {
 
@@ -286,6 +306,24 @@ private:
 
   void update( const Time&, const long, const long ) override;
 
+  bool supports_population_update() const override;
+  void update_population( const std::vector< Node* >&, Time const&, const long, const long ) override;
+
+  /**
+   * Advance n <= block_size neurons from step from to step to.
+   *
+   * Holds the state of the neurons in arrays and advances it with one vectorisable loop per step.
+   * update() calls it for a single neuron, update_population() for blocks of neurons, so that both
+   * share the same arithmetic.
+   */
+  template < size_t block_size >
+  static void update_block_( iaf_psc_exp* const*, const size_t, Time const&, const long, const long );
+
+  bool supports_update_stealing() const override;
+
+  size_t get_input_buffer_pool_channels() const override;
+  void set_input_buffer_pool( double*, const size_t ) override;
+
   // intensity function
   double phi_() const;
 
@@ -393,7 +431,7 @@ private:
     };
 
     /** buffers and sums up incoming spikes/currents */
-    MultiChannelInputBuffer< NUM_INPUT_CHANNELS > input_buffer_;
+    MultiChannelInputBuffer< NUM_INPUT_CHANNELS, TBufferValue > input_buffer_;
 
     //! Logger for all analog data
     UniversalDataLogger< iaf_psc_exp > logger_;
@@ -468,17 +506,21 @@ private:
   static RecordablesMap< iaf_psc_exp > recordablesMap_;
 };
 
+typedef iaf_psc_exp< float > iaf_psc_exp_f32;
+
 
+template < typename TBufferValue >
 inline size_t
-nest::iaf_psc_exp::send_test_event( Node& target, size_t receptor_type, synindex, bool )
+iaf_psc_exp< TBufferValue >::send_test_event( Node& target, size_t receptor_type, synindex, bool )
 {
   SpikeEvent e;
   e.set_sender( *this );
   return target.handles_test_event( e, receptor_type );
 }
 
+template < typename TBufferValue >
 inline size_t
-iaf_psc_exp::handles_test_event( SpikeEvent&, size_t receptor_type )
+iaf_psc_exp< TBufferValue >::handles_test_event( SpikeEvent&, size_t receptor_type )
 {
   if ( receptor_type != 0 )
   {
@@ -487,8 +529,9 @@ iaf_psc_exp::handles_test_event( SpikeEvent&, size_t receptor_type )
   return 0;
 }
 
+template < typename TBufferValue >
 inline size_t
-iaf_psc_exp::handles_test_event( CurrentEvent&, size_t receptor_type )
+iaf_psc_exp< TBufferValue >::handles_test_event( CurrentEvent&, size_t receptor_type )
 {
   if ( receptor_type == 0 )
   {
@@ -504,8 +547,9 @@ iaf_psc_exp::handles_test_event( CurrentEvent&, size_t receptor_type )
   }
 }
 
+template < typename TBufferValue >
 inline size_t
-iaf_psc_exp::handles_test_event( DataLoggingRequest& dlr, size_t receptor_type )
+iaf_psc_exp< TBufferValue >::handles_test_event( DataLoggingRequest& dlr, size_t receptor_type )
 {
   if ( receptor_type != 0 )
   {
@@ -514,8 +558,9 @@ iaf_psc_exp::handles_test_event( DataLoggingRequest& dlr, size_t receptor_type )
   return B_.logger_.connect_logging_device( dlr, recordablesMap_ );
 }
 
+template < typename TBufferValue >
 inline void
-iaf_psc_exp::get_status( DictionaryDatum& d ) const
+iaf_psc_exp< TBufferValue >::get_status( DictionaryDatum& d ) const
 {
   P_.get( d );
   S_.get( d, P_ );
@@ -524,8 +569,9 @@ iaf_psc_exp::get_status( DictionaryDatum& d ) const
   ( *d )[ names::recordables ] = recordablesMap_.get_list();
 }
 
+template < typename TBufferValue >
 inline void
-iaf_psc_exp::set_status( const DictionaryDatum& d )
+iaf_psc_exp< TBufferValue >::set_status( const DictionaryDatum& d )
 {
   Parameters_ ptmp = P_;                       // temporary copy in case of errors
   const double delta_EL = ptmp.set( d, this ); // throws if BadProperty
@@ -543,8 +589,9 @@ iaf_psc_exp::set_status( const DictionaryDatum& d )
   S_ = stmp;
 }
 
+template < typename TBufferValue >
 inline double
-iaf_psc_exp::phi_() const
+iaf_psc_exp< TBufferValue >::phi_() const
 {
   assert( P_.delta_ > 0. );
   return P_.rho_ * std::exp( 1. / P_.delta_ * ( S_.V_m_ - P_.Theta_ ) );
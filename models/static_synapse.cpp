@@ -25,8 +25,21 @@
 // Includes from nestkernel:
 #include "nest_impl.h"
 
+namespace
+{
+// Connection model templates are registered by their target identifier parameter only
+template < typename targetidentifierT >
+using static_synapse_f64 = nest::static_synapse< targetidentifierT, double >;
+}
+
 void
 nest::register_static_synapse( const std::string& name )
 {
-  register_connection_model< static_synapse >( name );
+  register_connection_model< static_synapse_f64 >( name );
+}
+
+void
+nest::register_static_synapse_f32( const std::string& name )
+{
+  register_connection_model< static_synapse_f32 >( name );
 }
@@ -23,8 +23,16 @@
 #ifndef STATICSYNAPSE_H
 #define STATICSYNAPSE_H
 
+// C++ includes:
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <vector>
+
 // Includes from nestkernel:
 #include "connection.h"
+#include "connector_base.h"
 
 namespace nest
 {
@@ -42,6 +50,14 @@ Description
 ``static_synapse`` does not support any kind of plasticity. It simply stores
 the parameters target, weight, delay and receiver port for each connection.
 
+``static_synapse_f32`` stores the weight in single precision. This reduces the
+memory needed per connection and the memory traffic during spike delivery.
+Weights set on the synapse are rounded to the nearest single-precision value;
+weights read from the synapse and transmitted with events are converted back to
+double precision. Use it together with neuron models that buffer their input in
+single precision, such as ``iaf_psc_exp_f32``, when the precision of the weights
+is not critical for the results.
+
 Transmits
 +++++++++
 
@@ -51,7 +67,7 @@ DoubleDataEvent, DataLoggingRequest
 See also
 ++++++++
 
-tsodyks_synapse, stdp_synapse
+tsodyks_synapse, stdp_synapse, iaf_psc_exp
 
 Examples using this model
 +++++++++++++++++++++++++
@@ -61,11 +77,26 @@ Examples using this model
 EndUserDocs */
 
 void register_static_synapse( const std::string& name );
+void register_static_synapse_f32( const std::string& name );
 
-template < typename targetidentifierT >
+template < typename targetidentifierT, typename weightT = double >
+class static_synapse;
+
+template < typename ConnectionT, typename weightT >
+class StaticConnector;
+
+template < typename targetidentifierT, typename weightT >
+class Connector< static_synapse< targetidentifierT, weightT > >;
+
+/**
+ * Static synapse, templated on the type in which the weight is stored.
+ */
+template < typename targetidentifierT, typename weightT >
 class static_synapse : public Connection< targetidentifierT >
 {
-  double weight_;
+  friend class StaticConnector< static_synapse< targetidentifierT, weightT >, weightT >;
+
+  weightT weight_;
 
 public:
   // this line determines which common properties to use
@@ -175,16 +206,19 @@ public:
   void
   set_weight( double w )
   {
-    weight_ = w;
+    weight_ = static_cast< weightT >( w );
   }
 };
 
 template < typename targetidentifierT >
-constexpr ConnectionModelProperties static_synapse< targetidentifierT >::properties;
+using static_synapse_f32 = static_synapse< targetidentifierT, float >;
 
-template < typename targetidentifierT >
+template < typename targetidentifierT, typename weightT >
+constexpr ConnectionModelProperties static_synapse< targetidentifierT, weightT >::properties;
+
+template < typename targetidentifierT, typename weightT >
 void
-static_synapse< targetidentifierT >::get_status( DictionaryDatum& d ) const
+static_synapse< targetidentifierT, weightT >::get_status( DictionaryDatum& d ) const
 {
 
   ConnectionBase::get_status( d );
@@ -192,14 +226,467 @@ static_synapse< targetidentifierT >::get_status( DictionaryDatum& d ) const
   def< long >( d, names::size_of, sizeof( *this ) );
 }
 
-template < typename targetidentifierT >
+template < typename targetidentifierT, typename weightT >
 void
-static_synapse< targetidentifierT >::set_status( const DictionaryDatum& d, ConnectorModel& cm )
+static_synapse< targetidentifierT, weightT >::set_status( const DictionaryDatum& d, ConnectorModel& cm )
 {
   ConnectionBase::set_status( d, cm );
-  updateValue< double >( d, names::weight, weight_ );
+
+  double weight = weight_;
+  if ( updateValue< double >( d, names::weight, weight ) )
+  {
+    set_weight( weight );
+  }
 }
 
+/**
+ * Base class of the connectors for static synapses, which store connection properties in arrays.
+ *
+ * Static synapses have no state that changes during simulation. Their connectors keep the
+ * properties of the connections in arrays instead of storing full connection objects, and
+ * assemble connection objects on demand for the infrequent access to synapse status. This
+ * class implements all queries of connections and the disabling and removal of connections.
+ * The derived ConnectorT defines the layout of the arrays by providing
+ *
+ * - size(),
+ * - target_( lcid ), the target identifier of a connection,
+ * - is_disabled_( lcid ) and source_has_more_targets_( lcid ), the flags of a connection,
+ * - get_connection_( lcid ), which assembles the connection object,
+ * - disable_( lcid ), which sets the disabled flag of a connection, and
+ * - truncate_( n ), which removes all connections from position n on.
+ */
+template < typename ConnectorT, typename ConnectionT >
+class StaticConnectorBase : public ConnectorBase
+{
+protected:
+  const synindex syn_id_;
+
+  explicit StaticConnectorBase( const synindex syn_id )
+    : syn_id_( syn_id )
+  {
+  }
+
+  const ConnectorT&
+  connector_() const
+  {
+    return static_cast< const ConnectorT& >( *this );
+  }
+
+  ConnectorT&
+  connector_()
+  {
+    return static_cast< ConnectorT& >( *this );
+  }
+
+  size_t
+  target_node_id_( const size_t tid, const size_t lcid ) const
+  {
+    return connector_().target_( lcid ).get_target_ptr( tid )->get_node_id();
+  }
+
+public:
+  synindex
+  get_syn_id() const override
+  {
+    return syn_id_;
+  }
+
+  void
+  get_synapse_status( const size_t tid, const size_t lcid, DictionaryDatum& dict ) const override
+  {
+    assert( lcid < connector_().size() );
+
+    connector_().get_connection_( lcid ).get_status( dict );
+
+    // get target node ID here, where tid is available
+    // necessary for hpc synapses using TargetIdentifierIndex
+    def< long >( dict, names::target, target_node_id_( tid, lcid ) );
+  }
+
+  void
+  get_connection( const size_t source_node_id,
+    const size_t target_node_id,
+    const size_t tid,
+    const size_t lcid,
+    const long synapse_label,
+    std::deque< ConnectionID >& conns ) const override
+  {
+    // static synapses are unlabeled, see Connection::get_label()
+    if ( not connector_().is_disabled_( lcid ) and synapse_label == UNLABELED_CONNECTION )
+    {
+      const size_t current_target_node_id = target_node_id_( tid, lcid );
+      if ( current_target_node_id == target_node_id or target_node_id == 0 )
+      {
+        conns.push_back(
+          ConnectionDatum( ConnectionID( source_node_id, current_target_node_id, tid, syn_id_, lcid ) ) );
+      }
+    }
+  }
+
+  void
+  get_connection_with_specified_targets( const size_t source_node_id,
+    const std::vector< size_t >& target_neuron_node_ids,
+    const size_t tid,
+    const size_t lcid,
+    const long synapse_label,
+    std::deque< ConnectionID >& conns ) const override
+  {
+    if ( not connector_().is_disabled_( lcid ) and synapse_label == UNLABELED_CONNECTION )
+    {
+      const size_t current_target_node_id = target_node_id_( tid, lcid );
+      if ( std::find( target_neuron_node_ids.begin(), target_neuron_node_ids.end(), current_target_node_id )
+        != target_neuron_node_ids.end() )
+      {
+        conns.push_back(
+          ConnectionDatum( ConnectionID( source_node_id, current_target_node_id, tid, syn_id_, lcid ) ) );
+      }
+    }
+  }
+
+  void
+  get_all_connections( const size_t source_node_id,
+    const size_t target_node_id,
+    const size_t tid,
+    const long synapse_label,
+    std::deque< ConnectionID >& conns ) const override
+  {
+    for ( size_t lcid = 0; lcid < connector_().size(); ++lcid )
+    {
+      get_connection( source_node_id, target_node_id, tid, lcid, synapse_label, conns );
+    }
+  }
+
+  void
+  get_source_lcids( const size_t tid, const size_t target_node_id, std::vector< size_t >& source_lcids ) const override
+  {
+    for ( size_t lcid = 0; lcid < connector_().size(); ++lcid )
+    {
+      if ( target_node_id_( tid, lcid ) == target_node_id and not connector_().is_disabled_( lcid ) )
+      {
+        source_lcids.push_back( lcid );
+      }
+    }
+  }
+
+  void
+  get_target_node_ids( const size_t tid,
+    const size_t start_lcid,
+    const std::string& post_synaptic_element,
+    std::vector< size_t >& target_node_ids ) const override
+  {
+    size_t lcid = start_lcid;
+    while ( true )
+    {
+      Node* target = connector_().target_( lcid ).get_target_ptr( tid );
+      if ( target->get_synaptic_elements( post_synaptic_element ) != 0.0 and not connector_().is_disabled_( lcid ) )
+      {
+        target_node_ids.push_back( target->get_node_id() );
+      }
+
+      if ( not connector_().source_has_more_targets_( lcid ) )
+      {
+        break;
+      }
+
+      ++lcid;
+    }
+  }
+
+  size_t
+  get_target_node_id( const size_t tid, const unsigned int lcid ) const override
+  {
+    return target_node_id_( tid, lcid );
+  }
+
+  void
+  send_weight_event( const size_t tid, const unsigned int lcid, Event& e, const CommonSynapseProperties& cp ) override
+  {
+    record_weight_( tid, syn_id_, lcid, e, cp );
+  }
+
+  void
+  trigger_update_weight( const long vt_node_id,
+    const size_t tid,
+    const std::vector< spikecounter >& dopa_spikes,
+    const double t_trig,
+    const std::vector< ConnectorModel* >& cm ) override
+  {
+    const auto& cp = static_cast< GenericConnectorModel< ConnectionT >* >( cm[ syn_id_ ] )->get_common_properties();
+    if ( connector_().size() > 0 and cp.get_vt_node_id() == vt_node_id )
+    {
+      // throws, as static synapses do not support updates triggered by a volume transmitter
+      connector_().get_connection_( 0 ).trigger_update_weight( tid, dopa_spikes, t_trig, cp );
+    }
+  }
+
+  size_t
+  find_first_target( const size_t tid, const size_t start_lcid, const size_t target_node_id ) const override
+  {
+    size_t lcid = start_lcid;
+    while ( true )
+    {
+      if ( target_node_id_( tid, lcid ) == target_node_id and not connector_().is_disabled_( lcid ) )
+      {
+        return lcid;
+      }
+
+      if ( not connector_().source_has_more_targets_( lcid ) )
+      {
+        return invalid_index;
+      }
+
+      ++lcid;
+    }
+  }
+
+  size_t
+  find_matching_target( const size_t tid,
+    const std::vector< size_t >& matching_lcids,
+    const size_t target_node_id ) const override
+  {
+    for ( size_t i = 0; i < matching_lcids.size(); ++i )
+    {
+      if ( target_node_id_( tid, matching_lcids[ i ] ) == target_node_id )
+      {
+        return matching_lcids[ i ];
+      }
+    }
+
+    return invalid_index;
+  }
+
+  void
+  disable_connection( const size_t lcid ) override
+  {
+    assert( not connector_().is_disabled_( lcid ) );
+    connector_().disable_( lcid );
+  }
+
+  void
+  remove_disabled_connections( const size_t first_disabled_index ) override
+  {
+    assert( connector_().is_disabled_( first_disabled_index ) );
+    connector_().truncate_( first_disabled_index );
+  }
+};
+
+/**
+ * Connector for static synapses, storing each connection property in a separate array.
+ *
+ * The connector keeps one array of target identifiers, one of weights and one of SynIdDelay
+ * entries, which hold the delay and the flags. Delivery thus only reads the bytes it needs from
+ * densely packed arrays.
+ *
+ * The connection type must provide the members target_, syn_id_delay_ and weight_, the
+ * latter of type weightT.
+ */
+template < typename ConnectionT, typename weightT >
+class StaticConnector : public StaticConnectorBase< StaticConnector< ConnectionT, weightT >, ConnectionT >
+{
+  friend class StaticConnectorBase< StaticConnector< ConnectionT, weightT >, ConnectionT >;
+
+private:
+  typedef StaticConnectorBase< StaticConnector< ConnectionT, weightT >, ConnectionT > Base;
+  typedef decltype( ConnectionT::target_ ) targetidentifierT;
+
+  using Base::syn_id_;
+
+  BlockVector< targetidentifierT > targets_;
+  BlockVector< weightT > weights_;
+  BlockVector< SynIdDelay > syn_id_delays_; //!< delays and flags
+
+  const targetidentifierT&
+  target_( const size_t lcid ) const
+  {
+    return targets_[ lcid ];
+  }
+
+  bool
+  is_disabled_( const size_t lcid ) const
+  {
+    return syn_id_delays_[ lcid ].is_disabled();
+  }
+
+  bool
+  source_has_more_targets_( const size_t lcid ) const
+  {
+    return syn_id_delays_[ lcid ].source_has_more_targets();
+  }
+
+  /**
+   * Assemble the connection at position lcid from the arrays.
+   */
+  ConnectionT
+  get_connection_( const size_t lcid ) const
+  {
+    ConnectionT c;
+    c.target_ = targets_[ lcid ];
+    c.syn_id_delay_ = syn_id_delays_[ lcid ];
+    c.weight_ = weights_[ lcid ];
+    return c;
+  }
+
+  /**
+   * Store the properties of connection c at position lcid in the arrays.
+   */
+  void
+  set_connection_( const size_t lcid, const ConnectionT& c )
+  {
+    targets_[ lcid ] = c.target_;
+    syn_id_delays_[ lcid ] = c.syn_id_delay_;
+    weights_[ lcid ] = c.weight_;
+  }
+
+  void
+  disable_( const size_t lcid )
+  {
+    syn_id_delays_[ lcid ].disable();
+  }
+
+  void
+  truncate_( const size_t n )
+  {
+    targets_.erase( targets_.begin() + n, targets_.end() );
+    weights_.erase( weights_.begin() + n, weights_.end() );
+    syn_id_delays_.erase( syn_id_delays_.begin() + n, syn_id_delays_.end() );
+  }
+
+public:
+  explicit StaticConnector( const synindex syn_id )
+    : Base( syn_id )
+  {
+  }
+
+  ~StaticConnector() override
+  {
+    targets_.clear();
+    weights_.clear();
+    syn_id_delays_.clear();
+  }
+
+  size_t
+  size() const override
+  {
+    return targets_.size();
+  }
+
+  void
+  set_synapse_status( const size_t lcid, const DictionaryDatum& dict, ConnectorModel& cm ) override
+  {
+    assert( lcid < size() );
+
+    ConnectionT c = get_connection_( lcid );
+    c.set_status( dict, static_cast< GenericConnectorModel< ConnectionT >& >( cm ) );
+    set_connection_( lcid, c );
+  }
+
+  void
+  push_back( const ConnectionT& c )
+  {
+    targets_.push_back( c.target_ );
+    weights_.push_back( c.weight_ );
+    syn_id_delays_.push_back( c.syn_id_delay_ );
+  }
+
+  void
+  reserve( const size_t n )
+  {
+    targets_.reserve( n );
+    weights_.reserve( n );
+    syn_id_delays_.reserve( n );
+  }
+
+  void
+  send_to_all( const size_t tid, const std::vector< ConnectorModel* >&, Event& e ) override
+  {
+    for ( size_t lcid = 0; lcid < size(); ++lcid )
+    {
+      assert( not syn_id_delays_[ lcid ].is_disabled() );
+      e.set_port( lcid );
+      e.set_weight( weights_[ lcid ] );
+      e.set_delay_steps( syn_id_delays_[ lcid ].delay );
+      e.set_receiver( *targets_[ lcid ].get_target_ptr( tid ) );
+      e.set_rport( targets_[ lcid ].get_rport() );
+      e();
+    }
+  }
+
+  size_t
+  send( const size_t tid, const size_t lcid, const std::vector< ConnectorModel* >& cm, Event& e ) override
+  {
+    const CommonSynapseProperties& cp =
+      static_cast< GenericConnectorModel< ConnectionT >* >( cm[ syn_id_ ] )->get_common_properties();
+
+    size_t current_lcid = lcid;
+    while ( true )
+    {
+      assert( current_lcid < size() );
+      const SynIdDelay syn_id_delay = syn_id_delays_[ current_lcid ];
+
+      e.set_port( current_lcid );
+      if ( not syn_id_delay.is_disabled() )
+      {
+        e.set_weight( weights_[ current_lcid ] );
+        e.set_delay_steps( syn_id_delay.delay );
+        e.set_receiver( *targets_[ current_lcid ].get_target_ptr( tid ) );
+        e.set_rport( targets_[ current_lcid ].get_rport() );
+        e();
+        this->send_weight_event( tid, current_lcid, e, cp );
+      }
+      if ( not syn_id_delay.source_has_more_targets() )
+      {
+        break;
+      }
+      ++current_lcid;
+    }
+
+    return 1 + current_lcid - lcid; // event was delivered to at least one target
+  }
+
+  void
+  prefetch( const size_t lcid ) const override
+  {
+    assert( lcid < size() );
+    __builtin_prefetch( &targets_[ lcid ] );
+    __builtin_prefetch( &weights_[ lcid ] );
+    __builtin_prefetch( &syn_id_delays_[ lcid ] );
+  }
+
+  void
+  sort_connections( BlockVector< Source >& sources ) override
+  {
+    // Sort a permutation along with the sources and apply it to all arrays in place
+    assert( size() <= std::numeric_limits< uint32_t >::max() );
+    BlockVector< uint32_t > permutation;
+    for ( size_t lcid = 0; lcid < size(); ++lcid )
+    {
+      permutation.push_back( lcid );
+    }
+    nest::sort( sources, permutation );
+    nest::apply_permutation( permutation, targets_, weights_, syn_id_delays_ );
+  }
+
+  void
+  radix_sort_connections( BlockVector< Source >& sources, RadixSortBuffers& buffers ) override
+  {
+    nest::radix_sort( buffers, sources, targets_, weights_, syn_id_delays_ );
+  }
+
+  void
+  set_source_has_more_targets( const size_t lcid, const bool has_more_targets ) override
+  {
+    syn_id_delays_[ lcid ].set_source_has_more_targets( has_more_targets );
+  }
+};
+
+template < typename targetidentifierT, typename weightT >
+class Connector< static_synapse< targetidentifierT, weightT > >
+  : public StaticConnector< static_synapse< targetidentifierT, weightT >, weightT >
+{
+public:
+  using StaticConnector< static_synapse< targetidentifierT, weightT >, weightT >::StaticConnector;
+};
+
 } // namespace
 
 #endif /* #ifndef STATICSYNAPSE_H */
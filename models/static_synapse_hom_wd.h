@@ -0,0 +1,462 @@
+/*
+ *  static_synapse_hom_wd.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef STATICSYNAPSE_HOM_WD_H
+#define STATICSYNAPSE_HOM_WD_H
+
+// C++ includes:
+#include <algorithm>
+#include <deque>
+#include <vector>
+
+// Includes from nestkernel:
+#include "common_properties_hom_w.h"
+#include "connection.h"
+#include "connector_base.h"
+
+// Includes from models:
+#include "static_synapse.h"
+
+namespace nest
+{
+
+/* BeginUserDocs: synapse, static
+
+Short description
++++++++++++++++++
+
+Synapse type for static connections with homogeneous weight and delay
+
+Description
++++++++++++
+
+``static_synapse_hom_wd`` does not support any kind of plasticity. It uses
+a common weight and a common delay for all connections and only stores the
+target and receiver port for each connection.
+
+The common weight must be set by ``SetDefaults`` on the model. The common
+delay is the default delay of the model; individual delays cannot be given
+when connecting. If you create copies of this model using ``CopyModel``,
+each derived model can have a different weight and delay.
+
+Using ``static_synapse_hom_wd_hpc``, each connection occupies 4 bytes.
+
+Transmits
++++++++++
+
+SpikeEvent, RateEvent, CurrentEvent, ConductanceEvent,
+DataLoggingRequest, DoubleDataEvent
+
+See also
+++++++++
+
+static_synapse, static_synapse_hom_w
+
+Examples using this model
++++++++++++++++++++++++++
+
+.. listexamples:: static_synapse_hom_wd
+
+EndUserDocs */
+
+void register_static_synapse_hom_wd( const std::string& name );
+
+template < typename targetidentifierT >
+class static_synapse_hom_wd;
+
+template < typename targetidentifierT >
+class Connector< static_synapse_hom_wd< targetidentifierT > >;
+
+template < typename targetidentifierT >
+class static_synapse_hom_wd : public Connection< targetidentifierT >
+{
+  friend class Connector< static_synapse_hom_wd< targetidentifierT > >;
+
+public:
+  // this line determines which common properties to use
+  typedef CommonPropertiesHomW CommonPropertiesType;
+  typedef Connection< targetidentifierT > ConnectionBase;
+
+  // Explicitly declare all methods inherited from the dependent base
+  // ConnectionBase. This avoids explicit name prefixes in all places these
+  // functions are used. Since ConnectionBase depends on the template parameter,
+  // they are not automatically found in the base class.
+  using ConnectionBase::get_delay_steps;
+  using ConnectionBase::get_rport;
+  using ConnectionBase::get_target;
+
+  static constexpr ConnectionModelProperties properties = ConnectionModelProperties::HAS_DELAY
+    | ConnectionModelProperties::IS_PRIMARY | ConnectionModelProperties::SUPPORTS_HPC
+    | ConnectionModelProperties::SUPPORTS_LBL;
+
+  class ConnTestDummyNode : public ConnTestDummyNodeBase
+  {
+  public:
+    // Ensure proper overriding of overloaded virtual functions.
+    // Return values from functions are ignored.
+    using ConnTestDummyNodeBase::handles_test_event;
+    size_t
+    handles_test_event( SpikeEvent&, size_t ) override
+    {
+      return invalid_port;
+    }
+    size_t
+    handles_test_event( RateEvent&, size_t ) override
+    {
+      return invalid_port;
+    }
+    size_t
+    handles_test_event( DataLoggingRequest&, size_t ) override
+    {
+      return invalid_port;
+    }
+    size_t
+    handles_test_event( CurrentEvent&, size_t ) override
+    {
+      return invalid_port;
+    }
+    size_t
+    handles_test_event( ConductanceEvent&, size_t ) override
+    {
+      return invalid_port;
+    }
+    size_t
+    handles_test_event( DoubleDataEvent&, size_t ) override
+    {
+      return invalid_port;
+    }
+    size_t
+    handles_test_event( DSSpikeEvent&, size_t ) override
+    {
+      return invalid_port;
+    }
+    size_t
+    handles_test_event( DSCurrentEvent&, size_t ) override
+    {
+      return invalid_port;
+    }
+  };
+
+  void get_status( DictionaryDatum& d ) const;
+
+  void
+  check_connection( Node& s, Node& t, size_t receptor_type, const CommonPropertiesType& )
+  {
+    ConnTestDummyNode dummy_target;
+    ConnectionBase::check_connection_( dummy_target, s, t, receptor_type );
+  }
+
+  /**
+   * Checks to see if weight or delay is given in syn_spec.
+   */
+  void
+  check_synapse_params( const DictionaryDatum& syn_spec ) const
+  {
+    if ( syn_spec->known( names::weight ) or syn_spec->known( names::delay ) )
+    {
+      throw BadProperty(
+        "Weight and delay cannot be specified since they need to be equal "
+        "for all connections when static_synapse_hom_wd is used." );
+    }
+  }
+
+  /**
+   * Send an event to the receiver of this connection.
+   * \param e The event to send
+   * \param tid Thread ID of the target
+   * \param cp Common properties-object of the synapse
+   */
+  bool
+  send( Event& e, const size_t tid, const CommonPropertiesHomW& cp )
+  {
+    e.set_weight( cp.get_weight() );
+    e.set_delay_steps( get_delay_steps() );
+    e.set_receiver( *get_target( tid ) );
+    e.set_rport( get_rport() );
+    e();
+
+    return true;
+  }
+
+  void
+  set_weight( double )
+  {
+    throw BadProperty(
+      "Setting of individual weights is not possible! The common weights can "
+      "be changed via CopyModel()." );
+  }
+
+  void
+  set_delay( double )
+  {
+    throw BadProperty(
+      "Setting of individual delays is not possible! The common delay can "
+      "be changed via SetDefaults() or CopyModel()." );
+  }
+};
+
+template < typename targetidentifierT >
+constexpr ConnectionModelProperties static_synapse_hom_wd< targetidentifierT >::properties;
+
+template < typename targetidentifierT >
+void
+static_synapse_hom_wd< targetidentifierT >::get_status( DictionaryDatum& d ) const
+{
+  ConnectionBase::get_status( d );
+  def< long >( d, names::size_of, sizeof( *this ) );
+}
+
+/**
+ * Connector for static synapses with homogeneous weight and delay.
+ *
+ * Weight and delay are the same for all connections of the connector. The
+ * weight is taken from the common properties, the delay from the first
+ * connection added. Each connection thus only stores its target identifier
+ * and flags, which occupy 4 bytes with TargetIdentifierIndex. Delivery sets
+ * weight and delay of the event once for all targets of a source. All other
+ * functions are shared with the connector of static_synapse.
+ */
+template < typename targetidentifierT >
+class Connector< static_synapse_hom_wd< targetidentifierT > >
+  : public StaticConnectorBase< Connector< static_synapse_hom_wd< targetidentifierT > >,
+      static_synapse_hom_wd< targetidentifierT > >
+{
+  friend class StaticConnectorBase< Connector< static_synapse_hom_wd< targetidentifierT > >,
+    static_synapse_hom_wd< targetidentifierT > >;
+
+private:
+  typedef static_synapse_hom_wd< targetidentifierT > ConnectionT;
+  typedef StaticConnectorBase< Connector< ConnectionT >, ConnectionT > Base;
+
+  using Base::syn_id_;
+
+  /**
+   * Target identifier and flags of a connection.
+   */
+  struct TargetEntry
+  {
+    targetidentifierT target;
+    bool source_has_more_targets;
+    bool disabled;
+  };
+
+  BlockVector< TargetEntry > targets_;
+  long delay_steps_; //!< delay of all connections in steps
+
+  const targetidentifierT&
+  target_( const size_t lcid ) const
+  {
+    return targets_[ lcid ].target;
+  }
+
+  bool
+  is_disabled_( const size_t lcid ) const
+  {
+    return targets_[ lcid ].disabled;
+  }
+
+  bool
+  source_has_more_targets_( const size_t lcid ) const
+  {
+    return targets_[ lcid ].source_has_more_targets;
+  }
+
+  /**
+   * Assemble the connection at position lcid.
+   */
+  ConnectionT
+  get_connection_( const size_t lcid ) const
+  {
+    ConnectionT c;
+    c.target_ = targets_[ lcid ].target;
+    c.syn_id_delay_.syn_id = syn_id_;
+    c.syn_id_delay_.delay = delay_steps_;
+    c.syn_id_delay_.set_source_has_more_targets( targets_[ lcid ].source_has_more_targets );
+    if ( targets_[ lcid ].disabled )
+    {
+      c.syn_id_delay_.disable();
+    }
+    return c;
+  }
+
+  void
+  disable_( const size_t lcid )
+  {
+    targets_[ lcid ].disabled = true;
+  }
+
+  void
+  truncate_( const size_t n )
+  {
+    targets_.erase( targets_.begin() + n, targets_.end() );
+  }
+
+  /**
+   * Throw if the delay of connection c differs from the delay of the connector.
+   */
+  void
+  check_delay_( const ConnectionT& c ) const
+  {
+    if ( c.get_delay_steps() != delay_steps_ )
+    {
+      throw BadProperty(
+        "All connections of static_synapse_hom_wd must have the same delay. "
+        "Use CopyModel() to create a model with a different delay." );
+    }
+  }
+
+public:
+  explicit Connector( const synindex syn_id )
+    : Base( syn_id )
+    , delay_steps_( 0 )
+  {
+  }
+
+  ~Connector() override
+  {
+    targets_.clear();
+  }
+
+  size_t
+  size() const override
+  {
+    return targets_.size();
+  }
+
+  void
+  get_synapse_status( const size_t tid, const size_t lcid, DictionaryDatum& dict ) const override
+  {
+    Base::get_synapse_status( tid, lcid, dict );
+
+    // report the memory actually used per connection
+    def< long >( dict, names::size_of, sizeof( TargetEntry ) );
+  }
+
+  void
+  set_synapse_status( const size_t lcid, const DictionaryDatum& dict, ConnectorModel& cm ) override
+  {
+    assert( lcid < size() );
+
+    ConnectionT c = get_connection_( lcid );
+    c.set_status( dict, static_cast< GenericConnectorModel< ConnectionT >& >( cm ) );
+    check_delay_( c );
+    targets_[ lcid ].target = c.target_;
+  }
+
+  void
+  push_back( const ConnectionT& c )
+  {
+    if ( targets_.size() == 0 )
+    {
+      delay_steps_ = c.get_delay_steps();
+    }
+    check_delay_( c );
+    targets_.push_back( TargetEntry { c.target_, c.source_has_more_targets(), c.is_disabled() } );
+  }
+
+  void
+  reserve( const size_t n )
+  {
+    targets_.reserve( n );
+  }
+
+  void
+  send_to_all( const size_t tid, const std::vector< ConnectorModel* >& cm, Event& e ) override
+  {
+    const CommonPropertiesHomW& cp =
+      static_cast< GenericConnectorModel< ConnectionT >* >( cm[ syn_id_ ] )->get_common_properties();
+
+    e.set_weight( cp.get_weight() );
+    e.set_delay_steps( delay_steps_ );
+    for ( size_t lcid = 0; lcid < size(); ++lcid )
+    {
+      assert( not targets_[ lcid ].disabled );
+      e.set_port( lcid );
+      e.set_receiver( *targets_[ lcid ].target.get_target_ptr( tid ) );
+      e.set_rport( targets_[ lcid ].target.get_rport() );
+      e();
+    }
+  }
+
+  size_t
+  send( const size_t tid, const size_t lcid, const std::vector< ConnectorModel* >& cm, Event& e ) override
+  {
+    const CommonPropertiesHomW& cp =
+      static_cast< GenericConnectorModel< ConnectionT >* >( cm[ syn_id_ ] )->get_common_properties();
+
+    // weight and delay are the same for all targets of the source
+    e.set_weight( cp.get_weight() );
+    e.set_delay_steps( delay_steps_ );
+
+    size_t current_lcid = lcid;
+    while ( true )
+    {
+      assert( current_lcid < size() );
+      const TargetEntry& entry = targets_[ current_lcid ];
+
+      e.set_port( current_lcid );
+      if ( not entry.disabled )
+      {
+        e.set_receiver( *entry.target.get_target_ptr( tid ) );
+        e.set_rport( entry.target.get_rport() );
+        e();
+        this->send_weight_event( tid, current_lcid, e, cp );
+      }
+      if ( not entry.source_has_more_targets )
+      {
+        break;
+      }
+      ++current_lcid;
+    }
+
+    return 1 + current_lcid - lcid; // event was delivered to at least one target
+  }
+
+  void
+  prefetch( const size_t lcid ) const override
+  {
+    assert( lcid < size() );
+    __builtin_prefetch( &targets_[ lcid ] );
+  }
+
+  void
+  sort_connections( BlockVector< Source >& sources ) override
+  {
+    nest::sort( sources, targets_ );
+  }
+
+  void
+  radix_sort_connections( BlockVector< Source >& sources, RadixSortBuffers& buffers ) override
+  {
+    nest::radix_sort( buffers, sources, targets_ );
+  }
+
+  void
+  set_source_has_more_targets( const size_t lcid, const bool has_more_targets ) override
+  {
+    targets_[ lcid ].source_has_more_targets = has_more_targets;
+  }
+};
+
+} // namespace
+
+#endif /* #ifndef STATICSYNAPSE_HOM_WD_H */
@@ -76,9 +76,14 @@ nest::ConnectionManager::ConnectionManager()
   , min_delay_( 1 )
   , max_delay_( 1 )
   , keep_source_table_( true )
+  , compress_source_table_( false )
   , connections_have_changed_( false )
   , get_connections_has_been_called_( false )
   , use_compressed_spikes_( true )
+  , radix_sort_connections_( false )
+  , incremental_connection_update_( false )
+  , full_connection_update_( true )
+  , has_compressed_spike_data_map_( false )
   , has_primary_connections_( false )
   , check_primary_connections_()
   , secondary_connections_exist_( false )
@@ -117,9 +122,12 @@ nest::ConnectionManager::initialize( const bool adjust_number_of_threads_or_rng_
 #endif
 
     keep_source_table_ = true;
+    compress_source_table_ = false;
     connections_have_changed_ = false;
     get_connections_has_been_called_ = false;
     use_compressed_spikes_ = true;
+    radix_sort_connections_ = false;
+    incremental_connection_update_ = false;
     stdp_eps_ = 1.0e-6;
     min_delay_ = max_delay_ = 1;
     sw_construction_connect.reset();
@@ -128,6 +136,7 @@ nest::ConnectionManager::initialize( const bool adjust_number_of_threads_or_rng_
   const size_t num_threads = kernel().vp_manager.get_num_threads();
   connections_.resize( num_threads );
   secondary_recv_buffer_pos_.resize( num_threads );
+  radix_sort_buffers_.resize( num_threads );
   compressed_spike_data_.resize( 0 );
 
   has_primary_connections_ = false;
@@ -155,6 +164,14 @@ nest::ConnectionManager::initialize( const bool adjust_number_of_threads_or_rng_
 
   std::vector< std::vector< size_t > > tmp2( kernel().vp_manager.get_num_threads(), std::vector< size_t >() );
   num_connections_.swap( tmp2 );
+
+  // the first update of the connection infrastructure is always a full update
+  full_connection_update_ = true;
+  rebuild_connections_.clear();
+  update_compressed_spike_data_.clear();
+  has_compressed_spike_data_map_ = false;
+  num_connections_at_update_.clear();
+  connections_removed_.assign( num_threads, std::vector< bool >() );
 }
 
 void
@@ -166,6 +183,7 @@ nest::ConnectionManager::finalize( const bool adjust_number_of_threads_or_rng_on
   delete_connections_();
   std::vector< std::vector< ConnectorBase* > >().swap( connections_ );
   std::vector< std::vector< std::vector< size_t > > >().swap( secondary_recv_buffer_pos_ );
+  std::vector< RadixSortBuffers >().swap( radix_sort_buffers_ );
   compressed_spike_data_.clear();
 
   if ( not adjust_number_of_threads_or_rng_only )
@@ -201,8 +219,11 @@ nest::ConnectionManager::set_status( const DictionaryDatum& d )
       "If structural plasticity is enabled, keep_source_table can not be set "
       "to false." );
   }
+  updateValue< bool >( d, names::compress_source_table, compress_source_table_ );
 
   updateValue< bool >( d, names::use_compressed_spikes, use_compressed_spikes_ );
+  updateValue< bool >( d, names::radix_sort_connections, radix_sort_connections_ );
+  updateValue< bool >( d, names::incremental_connection_update, incremental_connection_update_ );
 
   //  Need to update the saved values if we have changed the delay bounds.
   if ( d->known( names::min_delay ) or d->known( names::max_delay ) )
@@ -227,7 +248,10 @@ nest::ConnectionManager::get_status( DictionaryDatum& dict )
   const size_t n = get_num_connections();
   def< long >( dict, names::num_connections, n );
   def< bool >( dict, names::keep_source_table, keep_source_table_ );
+  def< bool >( dict, names::compress_source_table, compress_source_table_ );
   def< bool >( dict, names::use_compressed_spikes, use_compressed_spikes_ );
+  def< bool >( dict, names::radix_sort_connections, radix_sort_connections_ );
+  def< bool >( dict, names::incremental_connection_update, incremental_connection_update_ );
 
   sw_construction_connect.get_status( dict, names::time_construction_connect, names::time_construction_connect_cpu );
 
@@ -645,6 +669,8 @@ nest::ConnectionManager::connect_arrays( long* sources,
   // only place, where stopwatch sw_construction_connect is needed in addition to nestmodule.cpp
   sw_construction_connect.start();
 
+  const size_t num_threads = kernel().vp_manager.get_num_threads();
+
   // Mapping pointers to the first parameter value of each parameter to their respective names.
   // The bool indicates whether the value is an integer or not, and is determined at a later point.
   std::map< Name, std::pair< double*, bool > > param_pointers;
@@ -662,10 +688,11 @@ nest::ConnectionManager::connect_arrays( long* sources,
   const auto synapse_model_id = kernel().model_manager.get_synapse_model_id( syn_model );
   const auto syn_model_defaults = kernel().model_manager.get_connector_defaults( synapse_model_id );
 
-  // Dictionary holding additional synapse parameters, passed to the connect call.
+  // Dictionary holding additional synapse parameters, passed to the connect call. Without
+  // additional parameters, the dictionaries stay empty and are not touched per connection.
   std::vector< DictionaryDatum > param_dicts;
-  param_dicts.reserve( kernel().vp_manager.get_num_threads() );
-  for ( size_t i = 0; i < kernel().vp_manager.get_num_threads(); ++i )
+  param_dicts.reserve( num_threads );
+  for ( size_t i = 0; i < num_threads; ++i )
   {
     param_dicts.emplace_back( new Dictionary );
     for ( auto& param_key : p_keys )
@@ -691,52 +718,168 @@ nest::ConnectionManager::connect_arrays( long* sources,
     }
   }
 
-  // Increments pointers to weight and delay, if they are specified.
-  auto increment_wd = [ weights, delays ]( decltype( weights ) & w, decltype( delays ) & d )
+  // Returns the thread creating the connection to the given target, invalid_thread for targets
+  // on other ranks, and num_threads for targets without proxies, which are replicated on all threads.
+  auto has_proxies = []( const size_t node_id )
   {
-    if ( weights )
-    {
-      ++w;
-    }
-    if ( delays )
+    return kernel().modelrange_manager.get_model_of_node_id( node_id )->has_proxies();
+  };
+  auto get_target_thread = [ num_threads, &has_proxies ]( const size_t tnode_id )
+  {
+    if ( not has_proxies( tnode_id ) )
     {
-      ++d;
+      return num_threads;
     }
+    const size_t vp = kernel().vp_manager.node_id_to_vp( tnode_id );
+    return kernel().vp_manager.is_local_vp( vp ) ? kernel().vp_manager.vp_to_thread( vp ) : invalid_thread;
   };
 
   // Set flag before entering parallel section in case we have fewer connections than ranks.
   set_connections_have_changed();
 
   // Vector for storing exceptions raised by threads.
-  std::vector< std::shared_ptr< WrappedThreadException > > exceptions_raised( kernel().vp_manager.get_num_threads() );
+  std::vector< std::shared_ptr< WrappedThreadException > > exceptions_raised( num_threads );
+  auto rethrow_exceptions = [ &exceptions_raised ]()
+  {
+    for ( auto& exception : exceptions_raised )
+    {
+      if ( exception.get() )
+      {
+        throw WrappedThreadException( *exception );
+      }
+    }
+  };
+
+  // The input is split into one chunk per thread. Each thread validates its chunk and counts the
+  // connections it contains for each target thread, so that the input can be partitioned by target
+  // thread in parallel without every thread having to scan all connections.
+  std::vector< std::vector< size_t > > chunk_counts( num_threads, std::vector< size_t >( num_threads, 0 ) );
 
 #pragma omp parallel
   {
-    const auto tid = kernel().vp_manager.get_thread_id();
+    const size_t tid = kernel().vp_manager.get_thread_id();
     try
     {
-      auto s = sources;
-      auto t = targets;
-      auto w = weights;
-      auto d = delays;
-      double weight_buffer = numerics::nan;
-      double delay_buffer = numerics::nan;
-      int index_counter = 0; // Index of the current connection, for connection parameters
+      const size_t chunk_begin = n * tid / num_threads;
+      const size_t chunk_end = n * ( tid + 1 ) / num_threads;
+      auto& counts = chunk_counts[ tid ];
+
+      for ( size_t i = chunk_begin; i < chunk_end; ++i )
+      {
+        if ( 0 >= sources[ i ] or static_cast< size_t >( sources[ i ] ) > kernel().node_manager.size() )
+        {
+          throw UnknownNode( sources[ i ] );
+        }
+        if ( 0 >= targets[ i ] or static_cast< size_t >( targets[ i ] ) > kernel().node_manager.size() )
+        {
+          throw UnknownNode( targets[ i ] );
+        }
+
+        const size_t target_thread = get_target_thread( targets[ i ] );
+        if ( target_thread == num_threads )
+        {
+          for ( auto& count : counts )
+          {
+            ++count;
+          }
+        }
+        else if ( target_thread != invalid_thread )
+        {
+          ++counts[ target_thread ];
+        }
+      }
+    }
+    catch ( std::exception& err )
+    {
+      // We must create a new exception here, err's lifetime ends at the end of the catch block.
+      exceptions_raised.at( tid ) = std::shared_ptr< WrappedThreadException >( new WrappedThreadException( err ) );
+    }
+  }
+  rethrow_exceptions();
+
+  // Turn counts into the position of each chunk in the index arrays of the target threads, so that
+  // every target thread sees its connections in the order in which they appear in the input.
+  std::vector< size_t > num_thread_connections( num_threads, 0 );
+  for ( size_t target_thread = 0; target_thread < num_threads; ++target_thread )
+  {
+    for ( auto& counts : chunk_counts )
+    {
+      const size_t count = counts[ target_thread ];
+      counts[ target_thread ] = num_thread_connections[ target_thread ];
+      num_thread_connections[ target_thread ] += count;
+    }
+  }
+
+  // Indices of the connections created by each thread, in input order.
+  std::vector< std::vector< size_t > > thread_indices( num_threads );
 
-      for ( ; s != sources + n; ++s, ++t, ++index_counter )
+#pragma omp parallel
+  {
+    const size_t tid = kernel().vp_manager.get_thread_id();
+    try
+    {
+      thread_indices[ tid ].resize( num_thread_connections[ tid ] );
+    }
+    catch ( std::exception& err )
+    {
+      exceptions_raised.at( tid ) = std::shared_ptr< WrappedThreadException >( new WrappedThreadException( err ) );
+    }
+  }
+  rethrow_exceptions();
+
+  // Each thread distributes its chunk of the input to the index arrays of the target threads.
+#pragma omp parallel
+  {
+    const size_t tid = kernel().vp_manager.get_thread_id();
+    const size_t chunk_begin = n * tid / num_threads;
+    const size_t chunk_end = n * ( tid + 1 ) / num_threads;
+    auto& positions = chunk_counts[ tid ];
+
+    for ( size_t i = chunk_begin; i < chunk_end; ++i )
+    {
+      const size_t target_thread = get_target_thread( targets[ i ] );
+      if ( target_thread == num_threads )
       {
-        if ( 0 >= *s or static_cast< size_t >( *s ) > kernel().node_manager.size() )
+        for ( size_t t = 0; t < num_threads; ++t )
         {
-          throw UnknownNode( *s );
+          thread_indices[ t ][ positions[ t ]++ ] = i;
         }
-        if ( 0 >= *t or static_cast< size_t >( *t ) > kernel().node_manager.size() )
+      }
+      else if ( target_thread != invalid_thread )
+      {
+        thread_indices[ target_thread ][ positions[ target_thread ]++ ] = i;
+      }
+    }
+  }
+
+  // Each thread creates the connections to its targets, after reserving space for all of them.
+#pragma omp parallel
+  {
+    const size_t tid = kernel().vp_manager.get_thread_id();
+    try
+    {
+      const auto& indices = thread_indices[ tid ];
+
+      // Connections between neurons are stored in the connectors, all others in the device tables.
+      size_t num_neuron_connections = 0;
+      for ( const size_t i : indices )
+      {
+        if ( has_proxies( sources[ i ] ) and has_proxies( targets[ i ] ) )
         {
-          throw UnknownNode( *t );
+          ++num_neuron_connections;
         }
-        auto target_node = kernel().node_manager.get_node_or_proxy( *t, tid );
+      }
+      reserve_connections_( tid, synapse_model_id, num_neuron_connections );
+
+      double weight_buffer = numerics::nan;
+      double delay_buffer = numerics::nan;
+
+      for ( const size_t i : indices )
+      {
+        // Targets without proxies are replicated on all threads, but may still be represented by a proxy here.
+        Node* target_node = kernel().node_manager.get_node_or_proxy( targets[ i ], tid );
         if ( target_node->is_proxy() )
         {
-          increment_wd( w, d );
           continue;
         }
 
@@ -744,20 +887,18 @@ nest::ConnectionManager::connect_arrays( long* sources,
         // If not, the buffers will be NaN and replaced by a default value by the connect function.
         if ( weights )
         {
-          weight_buffer = *w;
+          weight_buffer = weights[ i ];
         }
         if ( delays )
         {
-          delay_buffer = *d;
+          delay_buffer = delays[ i ];
         }
 
         // Store the key-value pair of each parameter in the Dictionary.
         for ( auto& param_pointer_pair : param_pointers )
         {
-          // Increment the pointer to the parameter value.
-          const auto param_pointer = param_pointer_pair.second.first;
           const auto is_int = param_pointer_pair.second.second;
-          auto* param = param_pointer + index_counter;
+          const double* param = param_pointer_pair.second.first + i;
 
           // Integer parameters are stored as IntegerDatums.
           if ( is_int )
@@ -782,11 +923,12 @@ nest::ConnectionManager::connect_arrays( long* sources,
           }
         }
 
-        connect( *s, target_node, tid, synapse_model_id, param_dicts[ tid ], delay_buffer, weight_buffer );
+        connect( sources[ i ], target_node, tid, synapse_model_id, param_dicts[ tid ], delay_buffer, weight_buffer );
 
-        ALL_ENTRIES_ACCESSED( *param_dicts[ tid ], "connect_arrays", "Unread dictionary entries: " );
-
-        increment_wd( w, d );
+        if ( not param_pointers.empty() )
+        {
+          ALL_ENTRIES_ACCESSED( *param_dicts[ tid ], "connect_arrays", "Unread dictionary entries: " );
+        }
       }
     }
     catch ( std::exception& err )
@@ -795,14 +937,7 @@ nest::ConnectionManager::connect_arrays( long* sources,
       exceptions_raised.at( tid ) = std::shared_ptr< WrappedThreadException >( new WrappedThreadException( err ) );
     }
   }
-  // check if any exceptions have been raised
-  for ( size_t tid = 0; tid < kernel().vp_manager.get_num_threads(); ++tid )
-  {
-    if ( exceptions_raised.at( tid ).get() )
-    {
-      throw WrappedThreadException( *( exceptions_raised.at( tid ) ) );
-    }
-  }
+  rethrow_exceptions();
 
   sw_construction_connect.stop();
 }
@@ -970,6 +1105,18 @@ nest::ConnectionManager::connect_from_device_( Node& source,
   increase_connection_count( tid, syn_id );
 }
 
+void
+nest::ConnectionManager::reserve_connections_( const size_t tid, const synindex syn_id, const size_t count )
+{
+  if ( count == 0 )
+  {
+    return;
+  }
+
+  kernel().model_manager.get_connection_model( syn_id, tid ).reserve_connections( connections_[ tid ], syn_id, count );
+  source_table_.reserve( tid, syn_id, count );
+}
+
 void
 nest::ConnectionManager::increase_connection_count( const size_t tid, const synindex syn_id )
 {
@@ -1033,6 +1180,12 @@ nest::ConnectionManager::disconnect( const size_t tid,
   source_table_.disable_connection( tid, syn_id, lcid );
 
   --num_connections_[ tid ][ syn_id ];
+
+  if ( connections_removed_[ tid ].size() <= syn_id )
+  {
+    connections_removed_[ tid ].resize( syn_id + 1, false );
+  }
+  connections_removed_[ tid ][ syn_id ] = true;
 }
 
 void
@@ -1097,6 +1250,33 @@ nest::ConnectionManager::get_num_connections( const synindex syn_id ) const
   return num_connections;
 }
 
+void
+nest::ConnectionManager::get_spike_data_extrema( synindex& max_syn_id, size_t& max_lcid ) const
+{
+  max_syn_id = 0;
+  max_lcid = 0;
+  for ( size_t tid = 0; tid < connections_.size(); ++tid )
+  {
+    for ( synindex syn_id = 0; syn_id < connections_[ tid ].size(); ++syn_id )
+    {
+      if ( connections_[ tid ][ syn_id ] and get_num_connections_( tid, syn_id ) > 0 )
+      {
+        max_syn_id = std::max( max_syn_id, syn_id );
+        max_lcid = std::max( max_lcid, get_num_connections_( tid, syn_id ) - 1 );
+      }
+    }
+  }
+
+  // With compressed spikes, the lcid in spike data is an index into compressed_spike_data_
+  for ( const auto& compressed_spike_data : compressed_spike_data_ )
+  {
+    if ( not compressed_spike_data.empty() )
+    {
+      max_lcid = std::max( max_lcid, compressed_spike_data.size() - 1 );
+    }
+  }
+}
+
 ArrayDatum
 nest::ConnectionManager::get_connections( const DictionaryDatum& params )
 {
@@ -1463,9 +1643,17 @@ nest::ConnectionManager::sort_connections( const size_t tid )
   {
     for ( synindex syn_id = 0; syn_id < connections_[ tid ].size(); ++syn_id )
     {
-      if ( connections_[ tid ][ syn_id ] )
+      if ( connections_[ tid ][ syn_id ] and update_compressed_spike_data_[ syn_id ] )
       {
-        connections_[ tid ][ syn_id ]->sort_connections( source_table_.get_thread_local_sources( tid )[ syn_id ] );
+        BlockVector< Source >& sources = source_table_.get_thread_local_sources( tid )[ syn_id ];
+        if ( radix_sort_connections_ and sources.size() <= RadixSortBuffers::max_num_elements )
+        {
+          connections_[ tid ][ syn_id ]->radix_sort_connections( sources, radix_sort_buffers_[ tid ] );
+        }
+        else
+        {
+          connections_[ tid ][ syn_id ]->sort_connections( sources );
+        }
       }
     }
     remove_disabled_connections( tid );
@@ -1533,8 +1721,14 @@ nest::ConnectionManager::compute_compressed_secondary_recv_buffer_positions( con
           const size_t sg_s_id = source_table_.pack_source_node_id_and_syn_id( source_node_id, syn_id );
           const size_t source_rank = kernel().mpi_manager.get_process_id_of_node_id( source_node_id );
 
-          positions[ lcid ] = buffer_pos_of_source_node_id_syn_id_[ sg_s_id ]
-            + kernel().mpi_manager.get_recv_displacement_secondary_events_in_int( source_rank );
+          const auto buffer_pos = std::lower_bound( buffer_pos_of_source_node_id_syn_id_.begin(),
+            buffer_pos_of_source_node_id_syn_id_.end(),
+            sg_s_id,
+            []( const std::pair< size_t, size_t >& entry, const size_t key ) { return entry.first < key; } );
+          assert( buffer_pos != buffer_pos_of_source_node_id_syn_id_.end() and buffer_pos->first == sg_s_id );
+
+          positions[ lcid ] =
+            buffer_pos->second + kernel().mpi_manager.get_recv_displacement_secondary_events_in_int( source_rank );
         }
       }
     }
@@ -1711,9 +1905,9 @@ nest::ConnectionManager::deliver_secondary_events( const size_t tid,
 }
 
 void
-nest::ConnectionManager::compress_secondary_send_buffer_pos( const size_t tid )
+nest::ConnectionManager::compress_target_table( const size_t tid )
 {
-  target_table_.compress_secondary_send_buffer_pos( tid );
+  target_table_.compress( tid );
 }
 
 void
@@ -1723,7 +1917,8 @@ nest::ConnectionManager::remove_disabled_connections( const size_t tid )
 
   for ( synindex syn_id = 0; syn_id < connectors.size(); ++syn_id )
   {
-    if ( not connectors[ syn_id ] )
+    // synapse types that are not rebuilt have no disabled connections
+    if ( not connectors[ syn_id ] or not rebuild_connections_[ syn_id ] )
     {
       continue;
     }
@@ -1786,6 +1981,84 @@ nest::ConnectionManager::unset_connections_have_changed()
   connections_have_changed_ = false;
 }
 
+void
+nest::ConnectionManager::plan_connection_infrastructure_update()
+{
+  const size_t num_synapse_models = kernel().model_manager.get_num_connection_models();
+
+  // Largest change of each synapse type across threads; the additional last
+  // entry is set if all synapse types need to be rebuilt
+  std::vector< long > changes( num_synapse_models + 1, NO_CHANGE );
+  changes.back() = not incremental_connection_update_ or num_connections_at_update_.empty()
+    or kernel().node_manager.have_nodes_changed() or ( use_compressed_spikes_ and not has_compressed_spike_data_map_ );
+
+  // changes of individual synapse types only matter if no full update is required
+  for ( size_t tid = 0; not changes.back() and tid < connections_.size(); ++tid )
+  {
+    for ( synindex syn_id = 0; syn_id < connections_[ tid ].size(); ++syn_id )
+    {
+      if ( not connections_[ tid ][ syn_id ] )
+      {
+        continue;
+      }
+
+      long change = NO_CHANGE;
+      if ( syn_id < connections_removed_[ tid ].size() and connections_removed_[ tid ][ syn_id ] )
+      {
+        change = CONNECTIONS_REMOVED;
+      }
+      else if ( syn_id >= num_connections_at_update_[ tid ].size()
+        or get_num_connections_( tid, syn_id ) > num_connections_at_update_[ tid ][ syn_id ] )
+      {
+        change = CONNECTIONS_ADDED;
+      }
+      changes[ syn_id ] = std::max( changes[ syn_id ], change );
+
+      // buffer positions of secondary events depend on all secondary connections
+      const ConnectorModel& conn_model = kernel().model_manager.get_connection_model( syn_id, tid );
+      if ( change != NO_CHANGE and not conn_model.has_property( ConnectionModelProperties::IS_PRIMARY ) )
+      {
+        changes.back() = true;
+      }
+    }
+  }
+
+  kernel().mpi_manager.communicate_Allreduce_max_in_place( changes );
+
+  full_connection_update_ = changes.back();
+  rebuild_connections_.assign( num_synapse_models, full_connection_update_ );
+  update_compressed_spike_data_.assign( num_synapse_models, use_compressed_spikes_ and full_connection_update_ );
+  if ( not full_connection_update_ )
+  {
+    for ( synindex syn_id = 0; syn_id < num_synapse_models; ++syn_id )
+    {
+      // Only the new connections are exchanged. Without compressed spikes, these are the connections not yet marked
+      // as processed in the source table. With compressed spikes, sorting new connections by source moves existing
+      // connections, but sources keep their index into the compressed spike data, so only new sources are exchanged.
+      rebuild_connections_[ syn_id ] = changes[ syn_id ] == CONNECTIONS_REMOVED;
+      update_compressed_spike_data_[ syn_id ] = use_compressed_spikes_ and changes[ syn_id ] != NO_CHANGE;
+    }
+  }
+}
+
+void
+nest::ConnectionManager::record_connection_infrastructure_update()
+{
+  num_connections_at_update_.resize( connections_.size() );
+  for ( size_t tid = 0; tid < connections_.size(); ++tid )
+  {
+    num_connections_at_update_[ tid ].assign( connections_[ tid ].size(), 0 );
+    for ( synindex syn_id = 0; syn_id < connections_[ tid ].size(); ++syn_id )
+    {
+      if ( connections_[ tid ][ syn_id ] )
+      {
+        num_connections_at_update_[ tid ][ syn_id ] = get_num_connections_( tid, syn_id );
+      }
+    }
+    connections_removed_[ tid ].clear();
+  }
+}
+
 
 void
 nest::ConnectionManager::collect_compressed_spike_data( const size_t tid )
@@ -1796,16 +2069,14 @@ nest::ConnectionManager::collect_compressed_spike_data( const size_t tid )
 #pragma omp single
     {
       source_table_.resize_compressible_sources();
+      source_table_.resize_compressed_spike_data( compressed_spike_data_, rebuild_connections_ );
     } // of omp single; implicit barrier
 
-    source_table_.collect_compressible_sources( tid );
+    source_table_.collect_compressible_sources( tid, update_compressed_spike_data_ );
     kernel().get_omp_synchronization_construction_stopwatch().start();
 #pragma omp barrier
     kernel().get_omp_synchronization_construction_stopwatch().stop();
-#pragma omp single
-    {
-      source_table_.fill_compressed_spike_data( compressed_spike_data_ );
-    } // of omp single; implicit barrier
+    source_table_.fill_compressed_spike_data( tid, compressed_spike_data_, update_compressed_spike_data_ );
   }
 }
 
@@ -1821,26 +2092,37 @@ nest::ConnectionManager::fill_target_buffer( const size_t tid,
   // contains a valid entry.
   const auto& csd_maps = source_table_.compressed_spike_data_map_;
   auto syn_id = iteration_state_.at( tid ).first;
-  auto source_2_idx = iteration_state_.at( tid ).second;
+  auto map_idx = iteration_state_.at( tid ).second;
 
   if ( syn_id >= csd_maps.size() )
   {
     return true; // this thread has previously written all its targets
   }
 
+  bool is_source_table_read = true;
   do
   {
     const auto& conn_model = kernel().model_manager.get_connection_model( syn_id, tid );
     const bool is_primary = conn_model.has_property( ConnectionModelProperties::IS_PRIMARY );
 
-    while ( source_2_idx != csd_maps.at( syn_id ).end() )
+    const auto& csd_map = csd_maps.at( syn_id );
+    const size_t first_new_source_index = source_table_.first_new_source_index_.at( syn_id );
+    while ( map_idx < csd_map.size() )
     {
-      const auto source_gid = source_2_idx->first;
+      const auto source_gid = csd_map[ map_idx ].first;
+      const CSDMapEntry& csd_map_entry = csd_map[ map_idx ].second;
+      if ( csd_map_entry.get_source_index() < first_new_source_index )
+      {
+        // The presynaptic side has this source from an earlier update.
+        ++map_idx;
+        continue;
+      }
+
       const auto source_rank = kernel().mpi_manager.get_process_id_of_node_id( source_gid );
       if ( not( rank_start <= source_rank and source_rank < rank_end ) )
       {
         // We are not responsible for this source.
-        ++source_2_idx;
+        ++map_idx;
         continue;
       }
 
@@ -1851,10 +2133,8 @@ nest::ConnectionManager::fill_target_buffer( const size_t tid,
         // Since sources should be evenly distributed, this should not matter very much.
         //
         // We store where we need to continue and stop iteration for now.
-        iteration_state_.at( tid ) =
-          std::pair< size_t, std::map< size_t, CSDMapEntry >::const_iterator >( syn_id, source_2_idx );
-
-        return false; // there is data left to communicate
+        is_source_table_read = false; // there is data left to communicate
+        break;
       }
 
       TargetData next_target_data;
@@ -1869,13 +2149,13 @@ nest::ConnectionManager::fill_target_buffer( const size_t tid,
         TargetDataFields& target_fields = next_target_data.target_data;
         target_fields.set_syn_id( syn_id );
         target_fields.set_tid( 0 ); // meaningless, use 0 as fill
-        target_fields.set_lcid( source_2_idx->second.get_source_index() );
+        target_fields.set_lcid( csd_map_entry.get_source_index() );
       }
       else
       {
-        const auto target_thread = source_2_idx->second.get_target_thread();
+        const auto target_thread = csd_map_entry.get_target_thread();
         const SpikeData& conn_info =
-          compressed_spike_data_[ syn_id ][ source_2_idx->second.get_source_index() ][ target_thread ];
+          compressed_spike_data_[ syn_id ][ csd_map_entry.get_source_index() ][ target_thread ];
         assert( target_thread == static_cast< unsigned long >( conn_info.get_tid() ) );
         const size_t relative_recv_buffer_pos =
           get_secondary_recv_buffer_position( target_thread, syn_id, conn_info.get_lcid() )
@@ -1889,23 +2169,25 @@ nest::ConnectionManager::fill_target_buffer( const size_t tid,
       send_buffer_target_data.at( send_buffer_position.idx( source_rank ) ) = next_target_data;
       send_buffer_position.increase( source_rank );
 
-      ++source_2_idx;
+      ++map_idx;
     } // end while
 
-    ++syn_id;
-    if ( syn_id < csd_maps.size() )
+    if ( not is_source_table_read )
     {
-      source_2_idx = csd_maps.at( syn_id ).begin();
+      break;
     }
+
+    ++syn_id;
+    map_idx = 0;
   } while ( syn_id < csd_maps.size() );
 
-  // Store iteration state for this thread. If we get here, ther is nothing more to do for
-  // this thread so we store a non-existing syn_id with a meaningless iterator to inform that
-  // this thread has nothing to do in the next round.
-  iteration_state_.at( tid ) =
-    std::pair< size_t, std::map< size_t, CSDMapEntry >::const_iterator >( syn_id, source_2_idx );
+  // Store iteration state for this thread. If all data have been written, there is nothing
+  // more to do for this thread, so we store a non-existing syn_id with a meaningless index
+  // to inform that this thread has nothing to do in the next round.
+  iteration_state_.at( tid ) = std::pair< size_t, size_t >( syn_id, map_idx );
 
-  // Mark end of data for this round
+  // Mark end of data for this round, also if the buffer space of one rank has been filled,
+  // because the chunks of other ranks still hold target data of earlier rounds
   for ( size_t rank = rank_start; rank < rank_end; ++rank )
   {
     if ( send_buffer_position.idx( rank ) > send_buffer_position.begin( rank ) )
@@ -1920,8 +2202,7 @@ nest::ConnectionManager::fill_target_buffer( const size_t tid,
     }
   }
 
-  // If we get here, this thread has written everything.
-  return true;
+  return is_source_table_read;
 }
 
 void
@@ -1934,9 +2215,9 @@ nest::ConnectionManager::initialize_iteration_state()
   // This method only runs if at least one connection has been created,
   // so we must have at least one synapse model and we can start iteration
   // at the beginning of its compressed spike data map.
-  auto begin = source_table_.compressed_spike_data_map_.at( 0 ).cbegin();
+  assert( not source_table_.compressed_spike_data_map_.empty() );
   for ( size_t t = 0; t < num_threads; ++t )
   {
-    iteration_state_.push_back( std::pair< size_t, std::map< size_t, CSDMapEntry >::const_iterator >( 0, begin ) );
+    iteration_state_.push_back( std::pair< size_t, size_t >( 0, 0 ) );
   }
 }
@@ -24,6 +24,7 @@
 #define CONNECTION_MANAGER_H
 
 // C++ includes:
+#include <map>
 #include <string>
 
 // Includes from libnestutil:
@@ -273,7 +274,13 @@ public:
     const std::string& post_synaptic_element,
     std::vector< std::vector< size_t > >& targets );
 
-  const std::vector< Target >& get_remote_targets_of_local_node( const size_t tid, const size_t lid ) const;
+  vector_util::ConstSpan< Target > get_remote_targets_of_local_node( const size_t tid, const size_t lid ) const;
+
+  /**
+   * Sets is_spike_target_rank[ rank ] to 1 for all ranks to which this
+   * rank sends spikes, according to the TargetTable.
+   */
+  void get_spike_target_ranks( std::vector< int >& is_spike_target_rank ) const;
 
   size_t get_target_node_id( const size_t tid, const synindex syn_id, const size_t lcid ) const;
 
@@ -307,6 +314,11 @@ public:
     const std::vector< ConnectorModel* >& cm,
     Event& e );
 
+  /**
+   * Prefetch the connection at position lcid of the given synapse type.
+   */
+  void prefetch_connection( const size_t tid, const synindex syn_id, const size_t lcid ) const;
+
   /**
    * Send event e to all device targets of source source_node_id
    */
@@ -340,7 +352,7 @@ public:
   //! Removes processed entries from source table
   void clean_source_table( const size_t tid );
 
-  //! Clears all entries in source table
+  //! Clears all entries in source table, or compresses them if the source table is kept in compressed form
   void clear_source_table( const size_t tid );
 
   //! Returns true if source table is kept after building network
@@ -413,9 +425,32 @@ public:
    */
   void unset_connections_have_changed();
 
+  /**
+   * Determines which synapse types need to be rebuilt in the next update
+   * of the connection infrastructure.
+   *
+   * If incremental updates are enabled, only synapse types whose connections
+   * have been created or removed since the last update are sorted and have their
+   * target data exchanged again. All synapse types are rebuilt otherwise, and
+   * if nodes have been created or secondary connections have changed. The
+   * decision is synchronized across ranks, so this function must be called by a
+   * single thread on all ranks.
+   */
+  void plan_connection_infrastructure_update();
+
+  //! Returns true if the current update of the connection infrastructure rebuilds all synapse types.
+  bool is_full_connection_infrastructure_update() const;
+
+  /**
+   * Stores the number of connections per thread and synapse type after an
+   * update of the connection infrastructure, to detect new connections in the
+   * next update. Must be called by a single thread.
+   */
+  void record_connection_infrastructure_update();
+
   /**
    * Deletes TargetTable and resets processed flags of
-   * SourceTable.
+   * SourceTable for all synapse types that are rebuilt.
    *
    * This function must be called if connections are
    * created after connections have been communicated previously. It
@@ -429,7 +464,7 @@ public:
 
   void no_targets_to_process( const size_t tid );
 
-  const std::vector< size_t >&
+  vector_util::ConstSpan< size_t >
   get_secondary_send_buffer_positions( const size_t tid, const size_t lid, const synindex syn_id ) const;
 
   /**
@@ -441,7 +476,11 @@ public:
     const bool called_from_wfr_update,
     std::vector< unsigned int >& recv_buffer );
 
-  void compress_secondary_send_buffer_pos( const size_t tid );
+  /**
+   * Converts the targets collected during the exchange of target data
+   * into the compact layout of the target table.
+   */
+  void compress_target_table( const size_t tid );
 
   void resize_connections();
 
@@ -465,6 +504,11 @@ public:
 
   const std::vector< SpikeData >& get_compressed_spike_data( const synindex syn_id, const size_t idx );
 
+  /**
+   * Return the largest synapse-type index and local connection index that spike data sent to this rank can contain.
+   */
+  void get_spike_data_extrema( synindex& max_syn_id, size_t& max_lcid ) const;
+
   //! Set iteration_state_ entries for all threads to beginning of compressed_spike_data_map_.
   void initialize_iteration_state();
 
@@ -612,6 +656,12 @@ private:
     const double delay = NAN,
     const double weight = NAN );
 
+  /**
+   * Reserves space for count further connections of type syn_id on thread tid in the connectors and
+   * the source table.
+   */
+  void reserve_connections_( const size_t tid, const synindex syn_id, const size_t count );
+
   /**
    * Increases the connection count.
    */
@@ -645,7 +695,8 @@ private:
    */
   std::vector< std::vector< std::vector< size_t > > > secondary_recv_buffer_pos_;
 
-  std::map< size_t, size_t > buffer_pos_of_source_node_id_syn_id_;
+  //! Pairs of packed source node ID and synapse type and the buffer position of its secondary events, sorted by key
+  std::vector< std::pair< size_t, size_t > > buffer_pos_of_source_node_id_syn_id_;
 
   /**
    * A structure to hold the information about targets for each
@@ -681,6 +732,9 @@ private:
   //! Whether to keep source table after connection setup is complete.
   bool keep_source_table_;
 
+  //! Whether to keep the source table run-length encoded after connection setup is complete.
+  bool compress_source_table_;
+
   //! True if new connections have been created since startup or last call to
   //! simulate.
   bool connections_have_changed_;
@@ -698,6 +752,42 @@ private:
    */
   bool use_compressed_spikes_;
 
+  //! Whether to sort connections by source with a radix sort instead of a comparison sort.
+  bool radix_sort_connections_;
+
+  //! Scratch space of the radix sort for each thread, kept across connection infrastructure updates.
+  std::vector< RadixSortBuffers > radix_sort_buffers_;
+
+  //! Changes of the connections of a synapse type since the last connection infrastructure update, by extent.
+  enum ConnectionChange
+  {
+    NO_CHANGE = 0,
+    CONNECTIONS_ADDED,
+    CONNECTIONS_REMOVED
+  };
+
+  //! Whether to update the connection infrastructure only for synapse types whose connections have changed.
+  bool incremental_connection_update_;
+
+  //! Whether the current connection infrastructure update rebuilds all synapse types.
+  bool full_connection_update_;
+
+  //! For each synapse type, whether the current update sorts and exchanges all its connections anew.
+  std::vector< bool > rebuild_connections_;
+
+  //! For each synapse type, whether the current update sorts its connections and extends its compressed spike data.
+  std::vector< bool > update_compressed_spike_data_;
+
+  //! Whether compressed_spike_data_map_ of the source table was kept after the last update, see
+  //! clear_compressed_spike_data_map().
+  bool has_compressed_spike_data_map_;
+
+  //! Number of connections per thread and synapse type after the last connection infrastructure update.
+  std::vector< std::vector< size_t > > num_connections_at_update_;
+
+  //! Whether connections have been removed per thread and synapse type since the last update.
+  std::vector< std::vector< bool > > connections_removed_;
+
   //! Whether primary connections (spikes) exist.
   bool has_primary_connections_;
 
@@ -714,9 +804,9 @@ private:
   //! still considered 0. See issue #894
   double stdp_eps_;
 
-  //! For each thread, store (syn_id, compressed_spike_data_map_::iterator) pair for next iteration while filling target
-  //! buffers
-  std::vector< std::pair< size_t, std::map< size_t, CSDMapEntry >::const_iterator > > iteration_state_;
+  //! For each thread, store (syn_id, index into compressed_spike_data_map_) pair for next iteration while filling
+  //! target buffers
+  std::vector< std::pair< size_t, size_t > > iteration_state_;
 };
 
 inline bool
@@ -753,6 +843,10 @@ ConnectionManager::clear_source_table( const size_t tid )
   {
     source_table_.clear( tid );
   }
+  else if ( compress_source_table_ )
+  {
+    source_table_.compress( tid );
+  }
 }
 
 inline bool
@@ -815,12 +909,18 @@ ConnectionManager::prepare_target_table( const size_t tid )
   target_table_.prepare( tid );
 }
 
-inline const std::vector< Target >&
+inline vector_util::ConstSpan< Target >
 ConnectionManager::get_remote_targets_of_local_node( const size_t tid, const size_t lid ) const
 {
   return target_table_.get_targets( tid, lid );
 }
 
+inline void
+ConnectionManager::get_spike_target_ranks( std::vector< int >& is_spike_target_rank ) const
+{
+  target_table_.get_target_ranks( is_spike_target_rank );
+}
+
 inline bool
 ConnectionManager::connections_have_changed() const
 {
@@ -843,7 +943,7 @@ ConnectionManager::get_next_target_data( const size_t tid,
   return source_table_.get_next_target_data( tid, rank_start, rank_end, target_rank, next_target_data );
 }
 
-inline const std::vector< size_t >&
+inline vector_util::ConstSpan< size_t >
 ConnectionManager::get_secondary_send_buffer_positions( const size_t tid,
   const size_t lid,
   const synindex syn_id ) const
@@ -917,12 +1017,31 @@ ConnectionManager::send( const size_t tid,
   connections_[ tid ][ syn_id ]->send( tid, lcid, cm, e );
 }
 
+inline void
+ConnectionManager::prefetch_connection( const size_t tid, const synindex syn_id, const size_t lcid ) const
+{
+  connections_[ tid ][ syn_id ]->prefetch( lcid );
+}
+
+inline bool
+ConnectionManager::is_full_connection_infrastructure_update() const
+{
+  return full_connection_update_;
+}
+
 inline void
 ConnectionManager::restructure_connection_tables( const size_t tid )
 {
   assert( not source_table_.is_cleared() );
-  target_table_.clear( tid );
-  source_table_.reset_processed_flags( tid );
+  if ( full_connection_update_ )
+  {
+    target_table_.clear( tid );
+  }
+  else
+  {
+    target_table_.remove_targets( tid, rebuild_connections_ );
+  }
+  source_table_.reset_processed_flags( tid, rebuild_connections_ );
 }
 
 inline void
@@ -943,7 +1062,12 @@ ConnectionManager::get_compressed_spike_data( const synindex syn_id, const size_
 inline void
 ConnectionManager::clear_compressed_spike_data_map()
 {
-  source_table_.clear_compressed_spike_data_map();
+  // incremental updates extend the map by the new sources of each synapse type
+  has_compressed_spike_data_map_ = incremental_connection_update_ and use_compressed_spikes_;
+  if ( not has_compressed_spike_data_map_ )
+  {
+    source_table_.clear_compressed_spike_data_map();
+  }
 }
 
 } // namespace nest
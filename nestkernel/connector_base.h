@@ -161,6 +161,14 @@ public:
    */
   virtual size_t send( const size_t tid, const size_t lcid, const std::vector< ConnectorModel* >& cm, Event& e ) = 0;
 
+  /**
+   * Issue a software prefetch for the connection at position lcid.
+   *
+   * Used during target-sorted spike delivery to hide the latency of
+   * loading connections that will be accessed shortly.
+   */
+  virtual void prefetch( const size_t lcid ) const = 0;
+
   virtual void
   send_weight_event( const size_t tid, const unsigned int lcid, Event& e, const CommonSynapseProperties& cp ) = 0;
 
@@ -178,6 +186,13 @@ public:
    */
   virtual void sort_connections( BlockVector< Source >& ) = 0;
 
+  /**
+   * Sort connections according to source node IDs with a radix sort.
+   *
+   * The buffers are reused by consecutive calls to avoid allocations.
+   */
+  virtual void radix_sort_connections( BlockVector< Source >&, RadixSortBuffers& ) = 0;
+
   /**
    * Set a flag in the connection indicating whether the following
    * connection belongs to the same source.
@@ -211,6 +226,19 @@ public:
    * Remove disabled connections from the connector.
    */
   virtual void remove_disabled_connections( const size_t first_disabled_index ) = 0;
+
+protected:
+  /**
+   * Send the weight and delay of event e, which has been transmitted by the connection
+   * at position lcid, to the weight recorder of the synapse type, if there is one.
+   *
+   * Implemented in connector_base_impl.h
+   */
+  void record_weight_( const size_t tid,
+    const synindex syn_id,
+    const unsigned int lcid,
+    Event& e,
+    const CommonSynapseProperties& cp ) const;
 };
 
 /**
@@ -278,6 +306,12 @@ public:
     C_.push_back( std::move( c ) );
   }
 
+  void
+  reserve( const size_t n )
+  {
+    C_.reserve( n );
+  }
+
   void
   get_connection( const size_t source_node_id,
     const size_t target_node_id,
@@ -425,6 +459,13 @@ public:
     return 1 + lcid_offset; // event was delivered to at least one target
   }
 
+  void
+  prefetch( const size_t lcid ) const override
+  {
+    assert( lcid < C_.size() );
+    __builtin_prefetch( &C_[ lcid ] );
+  }
+
   // Implemented in connector_base_impl.h
   void
   send_weight_event( const size_t tid, const unsigned int lcid, Event& e, const CommonSynapseProperties& cp ) override;
@@ -457,6 +498,12 @@ public:
     nest::sort( sources, C_ );
   }
 
+  void
+  radix_sort_connections( BlockVector< Source >& sources, RadixSortBuffers& buffers ) override
+  {
+    nest::radix_sort( buffers, sources, C_ );
+  }
+
   void
   set_source_has_more_targets( const size_t lcid, const bool has_more_targets ) override
   {
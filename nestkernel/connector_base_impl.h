@@ -34,12 +34,12 @@
 namespace nest
 {
 
-template < typename ConnectionT >
-void
-Connector< ConnectionT >::send_weight_event( const size_t tid,
+inline void
+ConnectorBase::record_weight_( const size_t tid,
+  const synindex syn_id,
   const unsigned int lcid,
   Event& e,
-  const CommonSynapseProperties& cp )
+  const CommonSynapseProperties& cp ) const
 {
   // If the pointer to the receiver node in the event is invalid,
   // the event was not sent, and a WeightRecorderEvent is therefore not created.
@@ -52,7 +52,7 @@ Connector< ConnectionT >::send_weight_event( const size_t tid,
     wr_e.set_stamp( e.get_stamp() );
     // Sender is not available for SecondaryEvents, and not needed, so we do not
     // set it to avoid undefined behavior.
-    wr_e.set_sender_node_id( kernel().connection_manager.get_source_node_id( tid, syn_id_, lcid ) );
+    wr_e.set_sender_node_id( kernel().connection_manager.get_source_node_id( tid, syn_id, lcid ) );
     wr_e.set_weight( e.get_weight() );
     wr_e.set_delay_steps( e.get_delay_steps() );
     wr_e.set_receiver( *static_cast< Node* >( cp.get_weight_recorder() ) );
@@ -62,6 +62,16 @@ Connector< ConnectionT >::send_weight_event( const size_t tid,
   }
 }
 
+template < typename ConnectionT >
+void
+Connector< ConnectionT >::send_weight_event( const size_t tid,
+  const unsigned int lcid,
+  Event& e,
+  const CommonSynapseProperties& cp )
+{
+  record_weight_( tid, syn_id_, lcid, e, cp );
+}
+
 } // of namespace nest
 
 #endif
@@ -101,6 +101,15 @@ public:
     const double delay = NAN,
     const double weight = NAN ) = 0;
 
+  /**
+   * Reserve space for count further connections in the connector for syn_id.
+   *
+   * Creates the connector if it does not exist yet.
+   */
+  virtual void reserve_connections( std::vector< ConnectorBase* >& hetconn,
+    const synindex syn_id,
+    const size_t count ) = 0;
+
   virtual ConnectorModel* clone( std::string, synindex syn_id ) const = 0;
 
   virtual void calibrate( const TimeConverter& tc ) = 0;
@@ -181,6 +190,10 @@ public:
     const double delay,
     const double weight ) override;
 
+  void reserve_connections( std::vector< ConnectorBase* >& hetconn,
+    const synindex syn_id,
+    const size_t count ) override;
+
   ConnectorModel* clone( std::string, synindex ) const override;
 
   void calibrate( const TimeConverter& tc ) override;
@@ -321,6 +321,23 @@ GenericConnectorModel< ConnectionT >::add_connection_( Node& src,
   vc->push_back( std::move( connection ) );
 }
 
+template < typename ConnectionT >
+void
+GenericConnectorModel< ConnectionT >::reserve_connections( std::vector< ConnectorBase* >& thread_local_connectors,
+  const synindex syn_id,
+  const size_t count )
+{
+  assert( syn_id != invalid_synindex );
+
+  if ( not thread_local_connectors[ syn_id ] )
+  {
+    thread_local_connectors[ syn_id ] = new Connector< ConnectionT >( syn_id );
+  }
+
+  Connector< ConnectionT >* vc = static_cast< Connector< ConnectionT >* >( thread_local_connectors[ syn_id ] );
+  vc->reserve( vc->size() + count );
+}
+
 } // namespace nest
 
 #endif
@@ -23,7 +23,8 @@
 #include "event_delivery_manager.h"
 
 // C++ includes:
-#include <algorithm> // rotate
+#include <algorithm> // rotate, transform
+#include <cstring>   // memcpy
 #include <numeric>   // accumulate
 
 // Includes from nestkernel:
@@ -51,13 +52,31 @@ EventDeliveryManager::EventDeliveryManager()
   , slice_moduli_()
   , emitted_spikes_register_()
   , off_grid_emitted_spikes_register_()
+  , spike_register_offsets_()
+  , num_collocated_spikes_per_rank_()
+  , spike_data_collocated_( false )
+  , spike_register_mark_()
+  , off_grid_spike_register_mark_()
+  , num_spike_register_resets_()
   , send_buffer_secondary_events_()
   , recv_buffer_secondary_events_()
   , local_spike_counter_()
+  , local_target_data_counter_()
   , send_buffer_spike_data_()
   , recv_buffer_spike_data_()
   , send_buffer_off_grid_spike_data_()
   , recv_buffer_off_grid_spike_data_()
+  , send_buffer_compact_spike_data_()
+  , recv_buffer_compact_spike_data_()
+  , compact_spike_data_( false )
+  , compact_spike_data_active_( false )
+  , send_buffer_encoded_spike_data_()
+  , recv_buffer_encoded_spike_data_()
+  , spike_buffer_encoding_( false )
+  , spike_buffer_encoding_active_( false )
+  , num_slices_without_encoding_( SPIKE_BUFFER_ENCODING_RETRY_INTERVAL )
+  , encoded_chunk_size_( MIN_ENCODED_CHUNK_SIZE )
+  , global_max_encoded_chunk_size_( 0 )
   , send_buffer_target_data_()
   , recv_buffer_target_data_()
   , buffer_size_target_data_has_changed_( false )
@@ -65,8 +84,36 @@ EventDeliveryManager::EventDeliveryManager()
   , send_recv_buffer_shrink_limit_( 0.2 )
   , send_recv_buffer_shrink_spare_( 0.1 )
   , send_recv_buffer_grow_extra_( 0.5 )
+  , send_recv_buffer_predictive_sizing_( false )
+  , send_recv_buffer_ema_weight_( 0.1 )
+  , send_recv_buffer_headroom_( 0.5 )
+  , send_recv_buffer_resize_interval_( 10 )
+  , spike_buffer_ema_( 0.0 )
+  , num_slices_since_buffer_resize_( 0 )
+  , num_spike_exchange_rounds_( 0 )
+  , num_spike_buffer_overflows_( 0 )
   , send_recv_buffer_resize_log_()
   , gather_completed_checker_()
+  , spike_delivery_batch_size_( 8 )
+  , spike_delivery_batches_()
+  , sort_spikes_by_target_( false )
+  , spike_buffer_thread_sections_( false )
+  , num_spikes_received_per_rank_()
+  , spike_thread_section_begin_()
+  , partitioned_spike_data_()
+  , partitioned_off_grid_spike_data_()
+  , partitioned_compact_spike_data_()
+  , spike_exchange_pipeline_depth_( 1 )
+  , num_pipeline_stages_( 1 )
+  , pipeline_stage_length_( 1 )
+  , num_started_pipeline_stages_( 0 )
+  , spike_data_exchange_pending_( false )
+  , pending_local_max_spikes_per_rank_( 0 )
+  , pipelined_recv_buffer_spike_data_()
+  , pipelined_recv_buffer_off_grid_spike_data_()
+  , pipelined_recv_buffer_compact_spike_data_()
+  , pipelined_emitted_spikes_register_()
+  , pipelined_off_grid_emitted_spikes_register_()
 {
 }
 
@@ -74,6 +121,15 @@ EventDeliveryManager::~EventDeliveryManager()
 {
 }
 
+void
+EventDeliveryManager::SpikeDeliveryBatch::resize( const size_t batch_size )
+{
+  se.resize( batch_size );
+  tid.resize( batch_size );
+  syn_id.resize( batch_size );
+  lcid.resize( batch_size );
+}
+
 void
 EventDeliveryManager::initialize( const bool adjust_number_of_threads_or_rng_only )
 {
@@ -89,16 +145,51 @@ EventDeliveryManager::initialize( const bool adjust_number_of_threads_or_rng_onl
     send_recv_buffer_shrink_limit_ = 0.2;
     send_recv_buffer_shrink_spare_ = 0.1;
     send_recv_buffer_grow_extra_ = 0.5;
+    send_recv_buffer_predictive_sizing_ = false;
+    send_recv_buffer_ema_weight_ = 0.1;
+    send_recv_buffer_headroom_ = 0.5;
+    send_recv_buffer_resize_interval_ = 10;
+    spike_buffer_ema_ = 0.0;
+    num_slices_since_buffer_resize_ = 0;
+    num_spike_exchange_rounds_ = 0;
+    num_spike_buffer_overflows_ = 0;
     send_recv_buffer_resize_log_.clear();
+    spike_delivery_batch_size_ = 8;
+    sort_spikes_by_target_ = false;
+    spike_buffer_thread_sections_ = false;
+    spike_exchange_pipeline_depth_ = 1;
+    compact_spike_data_ = false;
+    spike_buffer_encoding_ = false;
   }
 
+  compact_spike_data_active_ = false;
+  spike_buffer_encoding_active_ = false;
+  num_slices_without_encoding_ = SPIKE_BUFFER_ENCODING_RETRY_INTERVAL;
+  encoded_chunk_size_ = MIN_ENCODED_CHUNK_SIZE;
+  global_max_encoded_chunk_size_ = 0;
+  num_pipeline_stages_ = 1;
+  pipeline_stage_length_ = 1;
+  num_started_pipeline_stages_ = 0;
+  spike_data_exchange_pending_ = false;
+  spike_data_collocated_ = false;
+
   const size_t num_threads = kernel().vp_manager.get_num_threads();
 
   local_spike_counter_.resize( num_threads, 0 );
+  local_target_data_counter_.assign( num_threads, 0 );
   reset_counters();
   emitted_spikes_register_.resize( num_threads );
   off_grid_emitted_spikes_register_.resize( num_threads );
+  spike_register_offsets_.resize( num_threads );
+  spike_register_mark_.assign( num_threads, SpikeRegisterMark() );
+  off_grid_spike_register_mark_.assign( num_threads, SpikeRegisterMark() );
+  num_spike_register_resets_.assign( num_threads, 0 );
   gather_completed_checker_.initialize( num_threads, false );
+  partitioned_spike_data_.resize( num_threads );
+  partitioned_off_grid_spike_data_.resize( num_threads );
+  partitioned_compact_spike_data_.resize( num_threads );
+  spike_delivery_batches_.resize( num_threads );
+  staged_device_spikes_.resize( num_threads );
 
 #pragma omp parallel
   {
@@ -113,6 +204,18 @@ EventDeliveryManager::initialize( const bool adjust_number_of_threads_or_rng_onl
     {
       off_grid_emitted_spikes_register_[ tid ] = new std::vector< OffGridSpikeDataWithRank >();
     }
+
+    // Resize in parallel so that each thread's partition buffers are allocated thread-locally
+    partitioned_spike_data_[ tid ].clear();
+    partitioned_spike_data_[ tid ].resize( num_threads );
+    partitioned_off_grid_spike_data_[ tid ].clear();
+    partitioned_off_grid_spike_data_[ tid ].resize( num_threads );
+    partitioned_compact_spike_data_[ tid ].clear();
+    partitioned_compact_spike_data_[ tid ].resize( num_threads );
+    spike_delivery_batches_[ tid ].resize( spike_delivery_batch_size_ );
+    spike_register_offsets_[ tid ].clear();
+    staged_device_spikes_[ tid ].clear();
+    staged_device_spikes_[ tid ].resize( num_threads );
   } // of omp parallel
 }
 
@@ -131,6 +234,17 @@ EventDeliveryManager::finalize( const bool )
     delete vec_spikedata_ptr;
   }
   off_grid_emitted_spikes_register_.clear();
+  spike_register_offsets_.clear();
+  staged_device_spikes_.clear();
+  num_collocated_spikes_per_rank_.clear();
+  spike_register_mark_.clear();
+  off_grid_spike_register_mark_.clear();
+  num_spike_register_resets_.clear();
+
+  delete_pipeline_stage_registers_();
+  pipelined_recv_buffer_spike_data_.clear();
+  pipelined_recv_buffer_off_grid_spike_data_.clear();
+  pipelined_recv_buffer_compact_spike_data_.clear();
 
   send_buffer_secondary_events_.clear();
   recv_buffer_secondary_events_.clear();
@@ -138,6 +252,15 @@ EventDeliveryManager::finalize( const bool )
   recv_buffer_spike_data_.clear();
   send_buffer_off_grid_spike_data_.clear();
   recv_buffer_off_grid_spike_data_.clear();
+  send_buffer_compact_spike_data_.clear();
+  recv_buffer_compact_spike_data_.clear();
+  send_buffer_encoded_spike_data_.clear();
+  recv_buffer_encoded_spike_data_.clear();
+  num_spikes_received_per_rank_.clear();
+  spike_thread_section_begin_.clear();
+  partitioned_spike_data_.clear();
+  partitioned_off_grid_spike_data_.clear();
+  partitioned_compact_spike_data_.clear();
 }
 
 void
@@ -174,6 +297,72 @@ EventDeliveryManager::set_status( const DictionaryDatum& dict )
     }
     send_recv_buffer_grow_extra_ = bge;
   }
+
+  updateValue< bool >( dict, names::spike_buffer_predictive_sizing, send_recv_buffer_predictive_sizing_ );
+
+  double bew = send_recv_buffer_ema_weight_;
+  if ( updateValue< double >( dict, names::spike_buffer_ema_weight, bew ) )
+  {
+    if ( bew <= 0 or bew > 1 )
+    {
+      throw BadProperty( "0 < spike_buffer_ema_weight <= 1 required." );
+    }
+    send_recv_buffer_ema_weight_ = bew;
+  }
+
+  double bh = send_recv_buffer_headroom_;
+  if ( updateValue< double >( dict, names::spike_buffer_headroom, bh ) )
+  {
+    if ( bh < 0 )
+    {
+      throw BadProperty( "spike_buffer_headroom >= 0 required." );
+    }
+    send_recv_buffer_headroom_ = bh;
+  }
+
+  long bri = send_recv_buffer_resize_interval_;
+  if ( updateValue< long >( dict, names::spike_buffer_resize_interval, bri ) )
+  {
+    if ( bri < 1 )
+    {
+      throw BadProperty( "spike_buffer_resize_interval >= 1 required." );
+    }
+    send_recv_buffer_resize_interval_ = bri;
+  }
+
+  long sdbs = spike_delivery_batch_size_;
+  if ( updateValue< long >( dict, names::spike_delivery_batch_size, sdbs ) )
+  {
+    if ( sdbs < 1 )
+    {
+      throw BadProperty( "spike_delivery_batch_size >= 1 required." );
+    }
+    spike_delivery_batch_size_ = sdbs;
+    for ( auto& batch : spike_delivery_batches_ )
+    {
+      batch.resize( spike_delivery_batch_size_ );
+    }
+  }
+
+  updateValue< bool >( dict, names::sort_spikes_by_target, sort_spikes_by_target_ );
+  updateValue< bool >( dict, names::spike_buffer_thread_sections, spike_buffer_thread_sections_ );
+
+  long sepd = spike_exchange_pipeline_depth_;
+  if ( updateValue< long >( dict, names::spike_exchange_pipeline_depth, sepd ) )
+  {
+    if ( sepd < 1 )
+    {
+      throw BadProperty( "spike_exchange_pipeline_depth >= 1 required." );
+    }
+    if ( sepd != spike_exchange_pipeline_depth_ and kernel().simulation_manager.has_been_simulated() )
+    {
+      throw BadProperty( "spike_exchange_pipeline_depth cannot be set after Simulate has been called." );
+    }
+    spike_exchange_pipeline_depth_ = sepd;
+  }
+
+  updateValue< bool >( dict, names::compact_spike_data, compact_spike_data_ );
+  updateValue< bool >( dict, names::spike_buffer_encoding, spike_buffer_encoding_ );
 }
 
 void
@@ -182,9 +371,26 @@ EventDeliveryManager::get_status( DictionaryDatum& dict )
   def< bool >( dict, names::off_grid_spiking, off_grid_spiking_ );
   def< unsigned long >(
     dict, names::local_spike_counter, std::accumulate( local_spike_counter_.begin(), local_spike_counter_.end(), 0 ) );
+  def< unsigned long >( dict,
+    names::local_target_data_counter,
+    std::accumulate( local_target_data_counter_.begin(), local_target_data_counter_.end(), 0UL ) );
   def< double >( dict, names::spike_buffer_shrink_limit, send_recv_buffer_shrink_limit_ );
   def< double >( dict, names::spike_buffer_shrink_spare, send_recv_buffer_shrink_spare_ );
   def< double >( dict, names::spike_buffer_grow_extra, send_recv_buffer_grow_extra_ );
+  def< bool >( dict, names::spike_buffer_predictive_sizing, send_recv_buffer_predictive_sizing_ );
+  def< double >( dict, names::spike_buffer_ema_weight, send_recv_buffer_ema_weight_ );
+  def< double >( dict, names::spike_buffer_headroom, send_recv_buffer_headroom_ );
+  def< long >( dict, names::spike_buffer_resize_interval, send_recv_buffer_resize_interval_ );
+  def< long >( dict, names::spike_buffer_overflows, num_spike_buffer_overflows_ );
+  def< long >( dict, names::spike_exchange_rounds, num_spike_exchange_rounds_ );
+  def< long >( dict, names::spike_delivery_batch_size, spike_delivery_batch_size_ );
+  def< bool >( dict, names::sort_spikes_by_target, sort_spikes_by_target_ );
+  def< bool >( dict, names::spike_buffer_thread_sections, spike_buffer_thread_sections_ );
+  def< long >( dict, names::spike_exchange_pipeline_depth, spike_exchange_pipeline_depth_ );
+  def< bool >( dict, names::compact_spike_data, compact_spike_data_ );
+  def< bool >( dict, names::compact_spike_data_active, compact_spike_data_active_ );
+  def< bool >( dict, names::spike_buffer_encoding, spike_buffer_encoding_ );
+  def< bool >( dict, names::spike_buffer_encoding_active, spike_buffer_encoding_active_ );
 
   DictionaryDatum log_events = DictionaryDatum( new Dictionary );
   ( *dict )[ names::spike_buffer_resize_log ] = log_events;
@@ -208,12 +414,175 @@ EventDeliveryManager::resize_send_recv_buffers_target_data()
 void
 EventDeliveryManager::resize_send_recv_buffers_spike_data_()
 {
-  if ( kernel().mpi_manager.get_buffer_size_spike_data() > send_buffer_spike_data_.size() )
+  if ( off_grid_spiking_ )
+  {
+    resize_send_recv_buffers_spike_data_(
+      send_buffer_off_grid_spike_data_, recv_buffer_off_grid_spike_data_, pipelined_recv_buffer_off_grid_spike_data_ );
+  }
+  else if ( compact_spike_data_active_ )
+  {
+    resize_send_recv_buffers_spike_data_(
+      send_buffer_compact_spike_data_, recv_buffer_compact_spike_data_, pipelined_recv_buffer_compact_spike_data_ );
+  }
+  else
+  {
+    resize_send_recv_buffers_spike_data_(
+      send_buffer_spike_data_, recv_buffer_spike_data_, pipelined_recv_buffer_spike_data_ );
+  }
+}
+
+template < typename SpikeDataT >
+void
+EventDeliveryManager::release_send_recv_buffers_spike_data_( std::vector< SpikeDataT >& send_buffer,
+  std::vector< SpikeDataT >& recv_buffer,
+  std::vector< std::vector< SpikeDataT > >& pipelined_recv_buffers )
+{
+  std::vector< SpikeDataT >().swap( send_buffer );
+  std::vector< SpikeDataT >().swap( recv_buffer );
+  for ( auto& pipelined_recv_buffer : pipelined_recv_buffers )
+  {
+    std::vector< SpikeDataT >().swap( pipelined_recv_buffer );
+  }
+}
+
+template < typename SpikeDataT >
+void
+EventDeliveryManager::resize_send_recv_buffers_spike_data_( std::vector< SpikeDataT >& send_buffer,
+  std::vector< SpikeDataT >& recv_buffer,
+  std::vector< std::vector< SpikeDataT > >& pipelined_recv_buffers )
+{
+  const size_t buffer_size = kernel().mpi_manager.get_buffer_size_spike_data();
+  if ( buffer_size > send_buffer.size() )
+  {
+    send_buffer.resize( buffer_size );
+    recv_buffer.resize( buffer_size );
+  }
+
+  // the number of pipeline stages may have changed since the buffers were last grown
+  for ( auto& pipelined_recv_buffer : pipelined_recv_buffers )
+  {
+    if ( buffer_size > pipelined_recv_buffer.size() )
+    {
+      pipelined_recv_buffer.resize( buffer_size );
+    }
+  }
+}
+
+void
+EventDeliveryManager::resize_encoded_spike_data_buffers_( const size_t chunk_size )
+{
+  assert( chunk_size >= MIN_ENCODED_CHUNK_SIZE );
+
+  encoded_chunk_size_ = chunk_size;
+  send_buffer_encoded_spike_data_.resize( kernel().mpi_manager.get_num_processes() * encoded_chunk_size_ );
+  recv_buffer_encoded_spike_data_.resize( kernel().mpi_manager.get_num_processes() * encoded_chunk_size_ );
+}
+
+void
+EventDeliveryManager::adapt_spike_data_encoding_()
+{
+  if ( not spike_buffer_encoding_ or off_grid_spiking_ or kernel().mpi_manager.neighbor_spike_exchange_active() )
+  {
+    spike_buffer_encoding_active_ = false;
+  }
+  else if ( spike_buffer_encoding_active_ )
+  {
+    // Compare to the size of chunks without encoding. All ranks observe the same maxima, so they all decide alike.
+    const size_t num_ints_per_spike =
+      ( compact_spike_data_active_ ? sizeof( CompactSpikeData ) : sizeof( SpikeData ) ) / sizeof( unsigned int );
+    if ( global_max_spikes_per_rank_ > 0
+      and global_max_encoded_chunk_size_ >= global_max_spikes_per_rank_ * num_ints_per_spike )
+    {
+      spike_buffer_encoding_active_ = false;
+      num_slices_without_encoding_ = 0;
+    }
+    else if ( global_max_encoded_chunk_size_ < send_recv_buffer_shrink_limit_ * encoded_chunk_size_ )
+    {
+      resize_encoded_spike_data_buffers_( std::max( MIN_ENCODED_CHUNK_SIZE,
+        static_cast< size_t >( ( 1 + send_recv_buffer_shrink_spare_ ) * global_max_encoded_chunk_size_ ) ) );
+    }
+  }
+  else if ( ++num_slices_without_encoding_ >= SPIKE_BUFFER_ENCODING_RETRY_INTERVAL )
+  {
+    // Spike patterns may have changed since encoding was switched off
+    spike_buffer_encoding_active_ = true;
+  }
+
+  global_max_encoded_chunk_size_ = 0;
+}
+
+void
+EventDeliveryManager::adapt_send_recv_buffers_spike_data_()
+{
+  adapt_spike_data_encoding_();
+
+  const size_t old_buff_size_per_rank = kernel().mpi_manager.get_send_recv_count_spike_data_per_rank();
+
+  if ( send_recv_buffer_predictive_sizing_ )
+  {
+    // The average follows increases immediately, so that buffers stay large enough for recurring bursts.
+    // All ranks observe the same maxima, so they all arrive at the same buffer size.
+    const double max_spikes = global_max_spikes_per_rank_;
+    spike_buffer_ema_ = std::max( max_spikes,
+      send_recv_buffer_ema_weight_ * max_spikes + ( 1 - send_recv_buffer_ema_weight_ ) * spike_buffer_ema_ );
+
+    ++num_slices_since_buffer_resize_;
+    if ( num_slices_since_buffer_resize_ >= send_recv_buffer_resize_interval_ )
+    {
+      num_slices_since_buffer_resize_ = 0;
+
+      // Resize only if the current size lies outside [ target, ( 1 + headroom ) * target ]
+      const size_t target_buff_size_per_rank =
+        std::max( 2UL, static_cast< size_t >( std::ceil( ( 1 + send_recv_buffer_headroom_ ) * spike_buffer_ema_ ) ) );
+      if ( target_buff_size_per_rank > old_buff_size_per_rank
+        or ( 1 + send_recv_buffer_headroom_ ) * target_buff_size_per_rank < old_buff_size_per_rank )
+      {
+        kernel().mpi_manager.set_buffer_size_spike_data(
+          kernel().mpi_manager.get_num_processes() * target_buff_size_per_rank );
+        resize_send_recv_buffers_spike_data_();
+        send_recv_buffer_resize_log_.add_entry( global_max_spikes_per_rank_, target_buff_size_per_rank );
+      }
+    }
+  }
+  else if ( global_max_spikes_per_rank_ < send_recv_buffer_shrink_limit_ * old_buff_size_per_rank )
+  {
+    const size_t new_buff_size_per_rank =
+      std::max( 2UL, static_cast< size_t >( ( 1 + send_recv_buffer_shrink_spare_ ) * global_max_spikes_per_rank_ ) );
+    kernel().mpi_manager.set_buffer_size_spike_data(
+      kernel().mpi_manager.get_num_processes() * new_buff_size_per_rank );
+    resize_send_recv_buffers_spike_data_();
+    send_recv_buffer_resize_log_.add_entry( global_max_spikes_per_rank_, new_buff_size_per_rank );
+  }
+
+  global_max_spikes_per_rank_ = 0;
+}
+
+template < typename SpikeDataT >
+void
+EventDeliveryManager::grow_send_recv_buffers_spike_data_( const size_t max_spikes_per_rank,
+  std::vector< std::vector< SpikeDataT > >& pipelined_recv_buffers )
+{
+  const size_t old_buff_size_per_rank = kernel().mpi_manager.get_send_recv_count_spike_data_per_rank();
+  const size_t new_buff_size_per_rank =
+    static_cast< size_t >( ( 1 + send_recv_buffer_grow_extra_ ) * max_spikes_per_rank );
+  assert( new_buff_size_per_rank > old_buff_size_per_rank );
+
+  kernel().mpi_manager.set_buffer_size_spike_data( kernel().mpi_manager.get_num_processes() * new_buff_size_per_rank );
+  resize_send_recv_buffers_spike_data_();
+  send_recv_buffer_resize_log_.add_entry( max_spikes_per_rank, new_buff_size_per_rank );
+
+  // Spikes received in earlier stages of this slice are still to be delivered. Move chunks starting
+  // from the last rank, so that no chunk is overwritten before it has been moved. Chunk 0 stays in place.
+  for ( size_t stage = 0; stage < num_started_pipeline_stages_; ++stage )
   {
-    send_buffer_spike_data_.resize( kernel().mpi_manager.get_buffer_size_spike_data() );
-    recv_buffer_spike_data_.resize( kernel().mpi_manager.get_buffer_size_spike_data() );
-    send_buffer_off_grid_spike_data_.resize( kernel().mpi_manager.get_buffer_size_spike_data() );
-    recv_buffer_off_grid_spike_data_.resize( kernel().mpi_manager.get_buffer_size_spike_data() );
+    auto& recv_buffer = pipelined_recv_buffers[ stage ];
+    for ( size_t rank = kernel().mpi_manager.get_num_processes() - 1; rank > 0; --rank )
+    {
+      const auto old_chunk_begin = recv_buffer.begin() + rank * old_buff_size_per_rank;
+      std::copy_backward( old_chunk_begin,
+        old_chunk_begin + old_buff_size_per_rank,
+        recv_buffer.begin() + rank * new_buff_size_per_rank + old_buff_size_per_rank );
+    }
   }
 }
 
@@ -226,8 +595,13 @@ EventDeliveryManager::configure_spike_data_buffers()
 
   send_buffer_spike_data_.clear();
   send_buffer_off_grid_spike_data_.clear();
+  send_buffer_compact_spike_data_.clear();
 
   resize_send_recv_buffers_spike_data_();
+  resize_encoded_spike_data_buffers_( encoded_chunk_size_ );
+  num_collocated_spikes_per_rank_.assign( kernel().mpi_manager.get_num_processes(), 0 );
+
+  num_started_pipeline_stages_ = 0;
 }
 
 void
@@ -353,38 +727,97 @@ EventDeliveryManager::deliver_secondary_events( const size_t tid, const bool cal
 }
 
 void
-EventDeliveryManager::gather_spike_data()
+EventDeliveryManager::send_staged_spikes_to_devices( const size_t tid )
+{
+  for ( auto& staged_spikes : staged_device_spikes_ )
+  {
+    for ( SpikeEvent& e : staged_spikes[ tid ] )
+    {
+      kernel().connection_manager.send_to_devices( tid, e.get_sender_node_id(), e );
+    }
+    staged_spikes[ tid ].clear();
+  }
+}
+
+void
+EventDeliveryManager::gather_spike_data( const size_t tid )
 {
   if ( off_grid_spiking_ )
   {
-    gather_spike_data_( send_buffer_off_grid_spike_data_, recv_buffer_off_grid_spike_data_ );
+    gather_spike_data_( tid,
+      send_buffer_off_grid_spike_data_,
+      recv_buffer_off_grid_spike_data_,
+      pipelined_recv_buffer_off_grid_spike_data_ );
+  }
+  else if ( compact_spike_data_active_ )
+  {
+    gather_spike_data_( tid,
+      send_buffer_compact_spike_data_,
+      recv_buffer_compact_spike_data_,
+      pipelined_recv_buffer_compact_spike_data_ );
   }
   else
   {
-    gather_spike_data_( send_buffer_spike_data_, recv_buffer_spike_data_ );
+    gather_spike_data_( tid, send_buffer_spike_data_, recv_buffer_spike_data_, pipelined_recv_buffer_spike_data_ );
   }
 }
 
 template < typename SpikeDataT >
 void
-EventDeliveryManager::gather_spike_data_( std::vector< SpikeDataT >& send_buffer,
-  std::vector< SpikeDataT >& recv_buffer )
+EventDeliveryManager::gather_spike_data_( const size_t tid,
+  std::vector< SpikeDataT >& send_buffer,
+  std::vector< SpikeDataT >& recv_buffer,
+  std::vector< std::vector< SpikeDataT > >& pipelined_recv_buffers )
 {
   // NOTE: For meaning and logic of SpikeData flags for detecting complete transmission
   //       and information for shrink/grow, see comment in spike_data.h.
 
-  const size_t old_buff_size_per_rank = kernel().mpi_manager.get_send_recv_count_spike_data_per_rank();
+#pragma omp master
+  {
+    if ( num_started_pipeline_stages_ == 0 )
+    {
+      adapt_send_recv_buffers_spike_data_();
+    }
+    else
+    {
+      // Spikes of the last stage are sent from the same buffer as those of the previous stage
+      complete_spike_data_exchange_( send_buffer, pipelined_recv_buffers );
+    }
+  } // of omp master; (no barrier)
+  kernel().get_omp_synchronization_simulation_stopwatch().start();
+#pragma omp barrier
+  kernel().get_omp_synchronization_simulation_stopwatch().stop();
+
+  // Buffers have their final size for the first exchange round now
+  collocate_spike_data_in_parallel_( tid, send_buffer );
 
-  if ( global_max_spikes_per_rank_ < send_recv_buffer_shrink_limit_ * old_buff_size_per_rank )
+#pragma omp master
   {
-    const size_t new_buff_size_per_rank =
-      std::max( 2UL, static_cast< size_t >( ( 1 + send_recv_buffer_shrink_spare_ ) * global_max_spikes_per_rank_ ) );
-    kernel().mpi_manager.set_buffer_size_spike_data(
-      kernel().mpi_manager.get_num_processes() * new_buff_size_per_rank );
-    resize_send_recv_buffers_spike_data_();
-    send_recv_buffer_resize_log_.add_entry( global_max_spikes_per_rank_, new_buff_size_per_rank );
-  }
+    // Rounds after overflows collocate serially, as they are rare
+    spike_data_collocated_ = true;
+    exchange_spike_data_( send_buffer, recv_buffer, pipelined_recv_buffers );
+
+    num_started_pipeline_stages_ = 0;
+  } // of omp master; (no barrier)
+  kernel().get_omp_synchronization_simulation_stopwatch().start();
+#pragma omp barrier
+  kernel().get_omp_synchronization_simulation_stopwatch().stop();
+
+  // We cannot shrink buffers here, because they first need to be read out by
+  // deliver events. Shrinking will happen at beginning of next gather.
+
+  /* emitted_spike_register is cleared by deliver_events in a thread-parallel context.
+     We could in principle clear it here, but since it can conveniently be done thread-parallel,
+     it is best to postpone.
+   */
+}
 
+template < typename SpikeDataT >
+void
+EventDeliveryManager::exchange_spike_data_( std::vector< SpikeDataT >& send_buffer,
+  std::vector< SpikeDataT >& recv_buffer,
+  std::vector< std::vector< SpikeDataT > >& pipelined_recv_buffers )
+{
   /* The following do-while loop is executed
    * - once if all spikes fit into current send buffers on all ranks
    * - twice if send buffer size needs to be increased to fit in all spikes
@@ -397,25 +830,8 @@ EventDeliveryManager::gather_spike_data_( std::vector< SpikeDataT >& send_buffer
 
     sw_collocate_spike_data_.start();
 
-    // Set marker at end of each chunk to DEFAULT
-    reset_complete_marker_spike_data_( send_buffer_position, send_buffer );
-    std::vector< size_t > num_spikes_per_rank( kernel().mpi_manager.get_num_processes(), 0 );
-
-    // Collocate spikes to send buffer
-    collocate_spike_data_buffers_( send_buffer_position, emitted_spikes_register_, send_buffer, num_spikes_per_rank );
-
-    if ( off_grid_spiking_ )
-    {
-      collocate_spike_data_buffers_(
-        send_buffer_position, off_grid_emitted_spikes_register_, send_buffer, num_spikes_per_rank );
-    }
-
-    // Largest number of spikes sent from this rank to any other rank.
-    const auto local_max_spikes_per_rank = *std::max_element( num_spikes_per_rank.begin(), num_spikes_per_rank.end() );
-
-    // At this point, all send_buffer entries with spikes to be transmitted, as well
-    // as all chunk-end entries, have marker DEFAULT.
-    set_end_marker_( send_buffer_position, send_buffer, local_max_spikes_per_rank );
+    const size_t local_max_spikes_per_rank = collocate_spike_data_( send_buffer_position, send_buffer );
+    ++num_spike_exchange_rounds_;
 
     sw_collocate_spike_data_.stop();
     sw_communicate_spike_data_.start();
@@ -428,98 +844,610 @@ EventDeliveryManager::gather_spike_data_( std::vector< SpikeDataT >& send_buffer
     kernel().get_mpi_synchronization_stopwatch().stop();
 #endif
 
-    // Given that we templatize by plain vs offgrid, this if should not be necessary, but ...
-    if ( off_grid_spiking_ )
+    size_t max_spikes_per_rank = 0;
+    size_t max_encoded_chunk_size = 0;
+    if ( kernel().mpi_manager.neighbor_spike_exchange_active() )
     {
-      kernel().mpi_manager.communicate_off_grid_spike_data_Alltoall( send_buffer, recv_buffer );
+      mark_non_neighbor_chunks_empty_( send_buffer_position, recv_buffer );
+
+      if ( off_grid_spiking_ )
+      {
+        kernel().mpi_manager.communicate_off_grid_spike_data_Neighbor_alltoallv( send_buffer, recv_buffer );
+      }
+      else
+      {
+        kernel().mpi_manager.communicate_spike_data_Neighbor_alltoallv( send_buffer, recv_buffer );
+      }
+
+      // Chunk-end entries only arrive from neighbours, but all ranks need to agree on the buffer size
+      std::vector< long > max_spikes( 1, local_max_spikes_per_rank );
+      kernel().mpi_manager.communicate_Allreduce_max_in_place( max_spikes );
+      max_spikes_per_rank = max_spikes[ 0 ];
+
+      sw_communicate_spike_data_.stop();
     }
-    else
+    else if ( spike_buffer_encoding_active_ )
     {
-      kernel().mpi_manager.communicate_spike_data_Alltoall( send_buffer, recv_buffer );
+      encode_spike_data_( send_buffer_position, send_buffer, local_max_spikes_per_rank );
+      kernel().mpi_manager.communicate_Alltoall(
+        send_buffer_encoded_spike_data_, recv_buffer_encoded_spike_data_, encoded_chunk_size_ );
+      max_encoded_chunk_size = decode_spike_data_( send_buffer_position, recv_buffer );
+
+      sw_communicate_spike_data_.stop();
+
+      max_spikes_per_rank = get_global_max_spikes_per_rank_( send_buffer_position, recv_buffer );
+      global_max_encoded_chunk_size_ = std::max( global_max_encoded_chunk_size_, max_encoded_chunk_size );
     }
+    else
+    {
+      // Given that we templatize by plain vs offgrid, this if should not be necessary, but ...
+      if ( off_grid_spiking_ )
+      {
+        kernel().mpi_manager.communicate_off_grid_spike_data_Alltoall( send_buffer, recv_buffer );
+      }
+      else
+      {
+        kernel().mpi_manager.communicate_spike_data_Alltoall( send_buffer, recv_buffer );
+      }
 
-    sw_communicate_spike_data_.stop();
+      sw_communicate_spike_data_.stop();
 
-    global_max_spikes_per_rank_ = get_global_max_spikes_per_rank_( send_buffer_position, recv_buffer );
+      max_spikes_per_rank = get_global_max_spikes_per_rank_( send_buffer_position, recv_buffer );
+    }
 
-    all_spikes_transmitted =
-      global_max_spikes_per_rank_ <= kernel().mpi_manager.get_send_recv_count_spike_data_per_rank();
+    global_max_spikes_per_rank_ = std::max( global_max_spikes_per_rank_, max_spikes_per_rank );
+    const bool spike_buffers_fit =
+      max_spikes_per_rank <= kernel().mpi_manager.get_send_recv_count_spike_data_per_rank();
+    const bool encoded_buffers_fit = max_encoded_chunk_size <= encoded_chunk_size_;
+    all_spikes_transmitted = spike_buffers_fit and encoded_buffers_fit;
 
     if ( not all_spikes_transmitted )
     {
-      const size_t new_buff_size_per_rank =
-        static_cast< size_t >( ( 1 + send_recv_buffer_grow_extra_ ) * global_max_spikes_per_rank_ );
-
-      kernel().mpi_manager.set_buffer_size_spike_data(
-        kernel().mpi_manager.get_num_processes() * new_buff_size_per_rank );
-      resize_send_recv_buffers_spike_data_();
-      send_recv_buffer_resize_log_.add_entry( global_max_spikes_per_rank_, new_buff_size_per_rank );
+      ++num_spike_buffer_overflows_;
+      if ( not spike_buffers_fit )
+      {
+        grow_send_recv_buffers_spike_data_( max_spikes_per_rank, pipelined_recv_buffers );
+      }
+      if ( not encoded_buffers_fit )
+      {
+        resize_encoded_spike_data_buffers_(
+          static_cast< size_t >( ( 1 + send_recv_buffer_grow_extra_ ) * max_encoded_chunk_size ) );
+      }
     }
 
   } while ( not all_spikes_transmitted );
-
-  // We cannot shrink buffers here, because they first need to be read out by
-  // deliver events. Shrinking will happen at beginning of next gather.
-
-  /* emitted_spike_register is cleared by deliver_events in a thread-parallel context.
-     We could in principle clear it here, but since it can conveniently be done thread-parallel,
-     it is best to postpone.
-   */
 }
 
-template < typename SpikeDataWithRankT, typename SpikeDataT >
 void
-EventDeliveryManager::collocate_spike_data_buffers_( SendBufferPosition& send_buffer_position,
-  std::vector< std::vector< SpikeDataWithRankT >* >& emitted_spikes_register,
-  std::vector< SpikeDataT >& send_buffer,
-  std::vector< size_t >& num_spikes_per_rank )
+EventDeliveryManager::start_spike_data_exchange()
 {
-  // First dimension: loop over writing thread
-  for ( auto& emitted_spikes_per_thread : emitted_spikes_register )
+  if ( off_grid_spiking_ )
   {
-    // Second dimension: loop over entries
-    for ( auto& emitted_spike : *emitted_spikes_per_thread )
-    {
-      const size_t rank = emitted_spike.rank;
-
-      // We need to count here even though send_buffer_position also counts,
-      // but send_buffer_position will only count spikes actually written,
-      // we need all spikes to have information for buffer resizing.
-      ++num_spikes_per_rank[ rank ];
-
-      // We do not break if condition is false, because there may be spikes that
-      // can be sent to other ranks than the one that is full.
-      if ( not send_buffer_position.is_chunk_filled( rank ) )
-      {
-        send_buffer[ send_buffer_position.idx( rank ) ] = emitted_spike.spike_data;
-        send_buffer_position.increase( rank );
-      }
-    }
+    start_spike_data_exchange_( send_buffer_off_grid_spike_data_, pipelined_recv_buffer_off_grid_spike_data_ );
+  }
+  else if ( compact_spike_data_active_ )
+  {
+    start_spike_data_exchange_( send_buffer_compact_spike_data_, pipelined_recv_buffer_compact_spike_data_ );
+  }
+  else
+  {
+    start_spike_data_exchange_( send_buffer_spike_data_, pipelined_recv_buffer_spike_data_ );
   }
 }
 
 template < typename SpikeDataT >
 void
-EventDeliveryManager::set_end_marker_( const SendBufferPosition& send_buffer_position,
-  std::vector< SpikeDataT >& send_buffer,
-  size_t local_max_spikes_per_rank )
+EventDeliveryManager::start_spike_data_exchange_( std::vector< SpikeDataT >& send_buffer,
+  std::vector< std::vector< SpikeDataT > >& pipelined_recv_buffers )
 {
-  // See comment in spike_data.h for logic.
-  const bool collocate_complete = local_max_spikes_per_rank
-    <= static_cast< size_t >( kernel().mpi_manager.get_send_recv_count_spike_data_per_rank() );
-
-  for ( size_t rank = 0; rank < kernel().mpi_manager.get_num_processes(); ++rank )
+  if ( num_started_pipeline_stages_ == 0 )
   {
-    const size_t end_idx = send_buffer_position.end( rank ) - 1;
-    if ( not collocate_complete )
-    {
-      SpikeDataT dummy;
-      dummy.set_lcid( local_max_spikes_per_rank );
-      dummy.set_invalid_marker();
-      send_buffer[ end_idx ] = dummy;
-      continue;
-    }
-
+    adapt_send_recv_buffers_spike_data_();
+  }
+  else
+  {
+    // Only one exchange can be pending, since all stages share the send buffer
+    complete_spike_data_exchange_( send_buffer, pipelined_recv_buffers );
+  }
+
+  const size_t stage = num_started_pipeline_stages_;
+  assert( stage + 1 < num_pipeline_stages_ );
+  std::vector< SpikeDataT >& recv_buffer = pipelined_recv_buffers[ stage ];
+
+  SendBufferPosition send_buffer_position;
+
+  sw_collocate_spike_data_.start();
+
+  pending_local_max_spikes_per_rank_ = collocate_spike_data_( send_buffer_position, send_buffer );
+  ++num_spike_exchange_rounds_;
+
+  // Keep spikes of this stage until delivery, in case they need to be retransmitted
+  swap_pipeline_stage_registers_( stage );
+
+  sw_collocate_spike_data_.stop();
+  sw_communicate_spike_data_.start();
+
+  if ( kernel().mpi_manager.neighbor_spike_exchange_active() )
+  {
+    mark_non_neighbor_chunks_empty_( send_buffer_position, recv_buffer );
+
+    if ( off_grid_spiking_ )
+    {
+      kernel().mpi_manager.communicate_off_grid_spike_data_Ineighbor_alltoallv( send_buffer, recv_buffer );
+    }
+    else
+    {
+      kernel().mpi_manager.communicate_spike_data_Ineighbor_alltoallv( send_buffer, recv_buffer );
+    }
+  }
+  else
+  {
+    if ( off_grid_spiking_ )
+    {
+      kernel().mpi_manager.communicate_off_grid_spike_data_Ialltoall( send_buffer, recv_buffer );
+    }
+    else
+    {
+      kernel().mpi_manager.communicate_spike_data_Ialltoall( send_buffer, recv_buffer );
+    }
+  }
+
+  sw_communicate_spike_data_.stop();
+
+  spike_data_exchange_pending_ = true;
+  ++num_started_pipeline_stages_;
+}
+
+void
+EventDeliveryManager::complete_spike_data_exchange()
+{
+  if ( off_grid_spiking_ )
+  {
+    complete_spike_data_exchange_( send_buffer_off_grid_spike_data_, pipelined_recv_buffer_off_grid_spike_data_ );
+  }
+  else if ( compact_spike_data_active_ )
+  {
+    complete_spike_data_exchange_( send_buffer_compact_spike_data_, pipelined_recv_buffer_compact_spike_data_ );
+  }
+  else
+  {
+    complete_spike_data_exchange_( send_buffer_spike_data_, pipelined_recv_buffer_spike_data_ );
+  }
+}
+
+template < typename SpikeDataT >
+void
+EventDeliveryManager::complete_spike_data_exchange_( std::vector< SpikeDataT >& send_buffer,
+  std::vector< std::vector< SpikeDataT > >& pipelined_recv_buffers )
+{
+  if ( not spike_data_exchange_pending_ )
+  {
+    return;
+  }
+
+  const size_t stage = num_started_pipeline_stages_ - 1;
+  std::vector< SpikeDataT >& recv_buffer = pipelined_recv_buffers[ stage ];
+
+  sw_communicate_spike_data_.start();
+
+  kernel().mpi_manager.wait_spike_data_exchange();
+  spike_data_exchange_pending_ = false;
+
+  size_t max_spikes_per_rank = 0;
+  if ( kernel().mpi_manager.neighbor_spike_exchange_active() )
+  {
+    std::vector< long > max_spikes( 1, pending_local_max_spikes_per_rank_ );
+    kernel().mpi_manager.communicate_Allreduce_max_in_place( max_spikes );
+    max_spikes_per_rank = max_spikes[ 0 ];
+  }
+  else
+  {
+    max_spikes_per_rank = get_global_max_spikes_per_rank_( SendBufferPosition(), recv_buffer );
+  }
+
+  sw_communicate_spike_data_.stop();
+
+  global_max_spikes_per_rank_ = std::max( global_max_spikes_per_rank_, max_spikes_per_rank );
+
+  if ( max_spikes_per_rank > kernel().mpi_manager.get_send_recv_count_spike_data_per_rank() )
+  {
+    ++num_spike_buffer_overflows_;
+    grow_send_recv_buffers_spike_data_( max_spikes_per_rank, pipelined_recv_buffers );
+
+    // Retransmit the spikes of this stage with a blocking exchange
+    swap_pipeline_stage_registers_( stage );
+    exchange_spike_data_( send_buffer, recv_buffer, pipelined_recv_buffers );
+    swap_pipeline_stage_registers_( stage );
+  }
+}
+
+void
+EventDeliveryManager::configure_spike_data_encoding()
+{
+  if ( not compact_spike_data_active_ and kernel().simulation_manager.has_been_simulated() )
+  {
+    // The encoding can only become compact before simulation starts
+    return;
+  }
+
+  // Structural plasticity creates connections during the update, so the layout could overflow
+  bool use_compact_spike_data = compact_spike_data_ and not off_grid_spiking_
+    and not kernel().sp_manager.is_structural_plasticity_enabled();
+
+  if ( use_compact_spike_data )
+  {
+    synindex max_syn_id = 0;
+    size_t max_lcid = 0;
+    kernel().connection_manager.get_spike_data_extrema( max_syn_id, max_lcid );
+
+    // All ranks must use the same layout, so it is determined by the largest values on any rank
+    std::vector< long > max_values = { kernel().connection_manager.get_min_delay() - 1,
+      static_cast< long >( kernel().vp_manager.get_num_threads() ) - 1,
+      static_cast< long >( max_syn_id ),
+      static_cast< long >( max_lcid ) };
+    kernel().mpi_manager.communicate_Allreduce_max_in_place( max_values );
+
+    if ( kernel().simulation_manager.has_been_simulated() )
+    {
+      // Spikes received at the end of the previous simulation are still encoded in the current layout
+      use_compact_spike_data =
+        CompactSpikeData::fits_layout( max_values[ 0 ], max_values[ 1 ], max_values[ 2 ], max_values[ 3 ] );
+    }
+    else
+    {
+      use_compact_spike_data =
+        CompactSpikeData::set_layout( max_values[ 0 ], max_values[ 1 ], max_values[ 2 ], max_values[ 3 ] );
+    }
+  }
+
+  if ( compact_spike_data_active_ and not use_compact_spike_data )
+  {
+    expand_compact_spike_data_();
+    release_send_recv_buffers_spike_data_(
+      send_buffer_compact_spike_data_, recv_buffer_compact_spike_data_, pipelined_recv_buffer_compact_spike_data_ );
+    LOG( M_INFO,
+      "EventDeliveryManager::configure_spike_data_encoding",
+      "Spike data no longer fit into 32 bits, exchanging spikes in full encoding." );
+  }
+  else if ( use_compact_spike_data and not compact_spike_data_active_ )
+  {
+    // The encoding only becomes compact before simulation starts, so the full buffers hold no spikes
+    release_send_recv_buffers_spike_data_(
+      send_buffer_spike_data_, recv_buffer_spike_data_, pipelined_recv_buffer_spike_data_ );
+  }
+
+  compact_spike_data_active_ = use_compact_spike_data;
+  resize_send_recv_buffers_spike_data_();
+}
+
+void
+EventDeliveryManager::expand_compact_spike_data_()
+{
+  const auto expand = []( const CompactSpikeData& spike_data ) { return spike_data.expand(); };
+
+  // buffers of the full encoding are not allocated while the compact encoding is in use
+  recv_buffer_spike_data_.resize( recv_buffer_compact_spike_data_.size() );
+  pipelined_recv_buffer_spike_data_.resize( pipelined_recv_buffer_compact_spike_data_.size() );
+  for ( size_t stage = 0; stage < pipelined_recv_buffer_compact_spike_data_.size(); ++stage )
+  {
+    pipelined_recv_buffer_spike_data_[ stage ].resize( pipelined_recv_buffer_compact_spike_data_[ stage ].size() );
+  }
+
+  std::transform( recv_buffer_compact_spike_data_.begin(),
+    recv_buffer_compact_spike_data_.end(),
+    recv_buffer_spike_data_.begin(),
+    expand );
+
+  for ( size_t stage = 0; stage < pipelined_recv_buffer_compact_spike_data_.size(); ++stage )
+  {
+    std::transform( pipelined_recv_buffer_compact_spike_data_[ stage ].begin(),
+      pipelined_recv_buffer_compact_spike_data_[ stage ].end(),
+      pipelined_recv_buffer_spike_data_[ stage ].begin(),
+      expand );
+  }
+}
+
+void
+EventDeliveryManager::configure_spike_exchange_pipeline()
+{
+  // Secondary events are only exchanged at the end of a slice and structural plasticity
+  // rebuilds the connection infrastructure within the update, so both require complete slices.
+  bool pipeline_supported = not kernel().connection_manager.secondary_connections_exist()
+    and not kernel().sp_manager.is_structural_plasticity_enabled();
+#ifdef HAVE_MUSIC
+  // MUSIC event handlers are updated once per slice.
+  pipeline_supported = false;
+#endif
+
+  if ( kernel().simulation_manager.has_been_simulated() )
+  {
+    if ( num_pipeline_stages_ > 1 and not pipeline_supported )
+    {
+      throw KernelException(
+        "Secondary connections and structural plasticity cannot be added after simulating with "
+        "spike_exchange_pipeline_depth > 1." );
+    }
+    return;
+  }
+
+  const long min_delay = kernel().connection_manager.get_min_delay();
+  long depth = std::min( spike_exchange_pipeline_depth_, min_delay );
+  if ( depth > 1 and not pipeline_supported )
+  {
+    LOG( M_WARNING,
+      "EventDeliveryManager::configure_spike_exchange_pipeline",
+      "Spike exchange pipelining is not supported with secondary connections, structural plasticity or MUSIC, "
+      "exchanging spikes once per time slice." );
+    depth = 1;
+  }
+
+  pipeline_stage_length_ = ( min_delay + depth - 1 ) / depth;
+  num_pipeline_stages_ = ( min_delay + pipeline_stage_length_ - 1 ) / pipeline_stage_length_;
+  num_started_pipeline_stages_ = 0;
+
+  const size_t num_threads = kernel().vp_manager.get_num_threads();
+
+  delete_pipeline_stage_registers_();
+  pipelined_emitted_spikes_register_.resize(
+    num_pipeline_stages_ - 1, std::vector< std::vector< SpikeDataWithRank >* >( num_threads, nullptr ) );
+  pipelined_off_grid_emitted_spikes_register_.resize(
+    num_pipeline_stages_ - 1, std::vector< std::vector< OffGridSpikeDataWithRank >* >( num_threads, nullptr ) );
+
+#pragma omp parallel
+  {
+    const size_t tid = kernel().vp_manager.get_thread_id();
+
+    // Allocate in parallel so that each thread's registers are allocated thread-locally
+    for ( size_t stage = 0; stage + 1 < num_pipeline_stages_; ++stage )
+    {
+      pipelined_emitted_spikes_register_[ stage ][ tid ] = new std::vector< SpikeDataWithRank >();
+      pipelined_off_grid_emitted_spikes_register_[ stage ][ tid ] = new std::vector< OffGridSpikeDataWithRank >();
+    }
+  } // of omp parallel
+
+  pipelined_recv_buffer_spike_data_.assign(
+    num_pipeline_stages_ - 1, std::vector< SpikeData >( send_buffer_spike_data_.size() ) );
+  pipelined_recv_buffer_off_grid_spike_data_.assign(
+    num_pipeline_stages_ - 1, std::vector< OffGridSpikeData >( send_buffer_off_grid_spike_data_.size() ) );
+  pipelined_recv_buffer_compact_spike_data_.assign(
+    num_pipeline_stages_ - 1, std::vector< CompactSpikeData >( send_buffer_compact_spike_data_.size() ) );
+}
+
+long
+EventDeliveryManager::get_pipeline_stage_end( const long step ) const
+{
+  return std::min(
+    ( step / pipeline_stage_length_ + 1 ) * pipeline_stage_length_, kernel().connection_manager.get_min_delay() );
+}
+
+void
+EventDeliveryManager::swap_pipeline_stage_registers_( const size_t stage )
+{
+  std::swap( emitted_spikes_register_, pipelined_emitted_spikes_register_[ stage ] );
+  std::swap( off_grid_emitted_spikes_register_, pipelined_off_grid_emitted_spikes_register_[ stage ] );
+}
+
+void
+EventDeliveryManager::delete_pipeline_stage_registers_()
+{
+  for ( auto& stage_register : pipelined_emitted_spikes_register_ )
+  {
+    for ( auto& vec_spikedata_ptr : stage_register )
+    {
+      delete vec_spikedata_ptr;
+    }
+  }
+  pipelined_emitted_spikes_register_.clear();
+
+  for ( auto& stage_register : pipelined_off_grid_emitted_spikes_register_ )
+  {
+    for ( auto& vec_spikedata_ptr : stage_register )
+    {
+      delete vec_spikedata_ptr;
+    }
+  }
+  pipelined_off_grid_emitted_spikes_register_.clear();
+}
+
+template < typename SpikeDataT >
+size_t
+EventDeliveryManager::collocate_spike_data_( SendBufferPosition& send_buffer_position,
+  std::vector< SpikeDataT >& send_buffer )
+{
+  // Set marker at end of each chunk to DEFAULT
+  reset_complete_marker_spike_data_( send_buffer_position, send_buffer );
+  std::vector< size_t > num_spikes_per_rank( kernel().mpi_manager.get_num_processes(), 0 );
+
+  if ( spike_data_collocated_ )
+  {
+    // Spikes have been written to the send buffer by all threads, see collocate_spike_data_in_parallel_()
+    const size_t send_recv_count_per_rank = kernel().mpi_manager.get_send_recv_count_spike_data_per_rank();
+    for ( size_t rank = 0; rank < kernel().mpi_manager.get_num_processes(); ++rank )
+    {
+      num_spikes_per_rank[ rank ] = num_collocated_spikes_per_rank_[ rank ];
+      send_buffer_position.increase( rank, std::min( num_spikes_per_rank[ rank ], send_recv_count_per_rank ) );
+    }
+    spike_data_collocated_ = false;
+  }
+  else
+  {
+    // Collocate spikes to send buffer
+    collocate_spike_data_buffers_( send_buffer_position, emitted_spikes_register_, send_buffer, num_spikes_per_rank );
+
+    if ( off_grid_spiking_ )
+    {
+      collocate_spike_data_buffers_(
+        send_buffer_position, off_grid_emitted_spikes_register_, send_buffer, num_spikes_per_rank );
+    }
+  }
+
+  if ( spike_buffer_thread_sections_ and not kernel().connection_manager.use_compressed_spikes() )
+  {
+    sort_send_buffer_by_thread_( send_buffer_position, send_buffer );
+  }
+
+  // Largest number of spikes sent from this rank to any other rank.
+  const auto local_max_spikes_per_rank = *std::max_element( num_spikes_per_rank.begin(), num_spikes_per_rank.end() );
+
+  // At this point, all send_buffer entries with spikes to be transmitted, as well
+  // as all chunk-end entries, have marker DEFAULT.
+  set_end_marker_( send_buffer_position, send_buffer, local_max_spikes_per_rank );
+
+  return local_max_spikes_per_rank;
+}
+
+template < typename SpikeDataT >
+void
+EventDeliveryManager::collocate_spike_data_in_parallel_( const size_t tid, std::vector< SpikeDataT >& send_buffer )
+{
+  sw_collocate_spike_data_.start();
+
+  const size_t num_threads = kernel().vp_manager.get_num_threads();
+  const size_t num_ranks = kernel().mpi_manager.get_num_processes();
+
+  // Count spikes of this thread for each rank
+  std::vector< size_t >& offsets = spike_register_offsets_[ tid ];
+  offsets.assign( 2 * num_ranks, 0 );
+  for ( const auto& emitted_spike : *emitted_spikes_register_[ tid ] )
+  {
+    ++offsets[ emitted_spike.rank ];
+  }
+  if ( off_grid_spiking_ )
+  {
+    for ( const auto& emitted_spike : *off_grid_emitted_spikes_register_[ tid ] )
+    {
+      ++offsets[ num_ranks + emitted_spike.rank ];
+    }
+  }
+
+  kernel().get_omp_synchronization_simulation_stopwatch().start();
+#pragma omp barrier
+  kernel().get_omp_synchronization_simulation_stopwatch().stop();
+
+  // Exclusive prefix sum over threads for a contiguous block of ranks per thread. As in serial collocation,
+  // on-grid spikes of all threads precede off-grid spikes.
+  const size_t ranks_per_thread = ( num_ranks + num_threads - 1 ) / num_threads;
+  const size_t end_rank = std::min( num_ranks, ( tid + 1 ) * ranks_per_thread );
+  for ( size_t rank = tid * ranks_per_thread; rank < end_rank; ++rank )
+  {
+    size_t num_spikes = 0;
+    for ( const size_t grid_offset : { size_t( 0 ), num_ranks } )
+    {
+      for ( auto& thread_offsets : spike_register_offsets_ )
+      {
+        const size_t num_thread_spikes = thread_offsets[ grid_offset + rank ];
+        thread_offsets[ grid_offset + rank ] = num_spikes;
+        num_spikes += num_thread_spikes;
+      }
+    }
+    num_collocated_spikes_per_rank_[ rank ] = num_spikes;
+  }
+
+  kernel().get_omp_synchronization_simulation_stopwatch().start();
+#pragma omp barrier
+  kernel().get_omp_synchronization_simulation_stopwatch().stop();
+
+  collocate_spike_register_( *emitted_spikes_register_[ tid ], send_buffer, offsets.begin() );
+  if ( off_grid_spiking_ )
+  {
+    collocate_spike_register_( *off_grid_emitted_spikes_register_[ tid ], send_buffer, offsets.begin() + num_ranks );
+  }
+
+  kernel().get_omp_synchronization_simulation_stopwatch().start();
+#pragma omp barrier
+  kernel().get_omp_synchronization_simulation_stopwatch().stop();
+
+  sw_collocate_spike_data_.stop();
+}
+
+template < typename SpikeDataWithRankT, typename SpikeDataT >
+void
+EventDeliveryManager::collocate_spike_register_( const std::vector< SpikeDataWithRankT >& spike_register,
+  std::vector< SpikeDataT >& send_buffer,
+  std::vector< size_t >::iterator offsets )
+{
+  const size_t send_recv_count_per_rank = kernel().mpi_manager.get_send_recv_count_spike_data_per_rank();
+
+  for ( const auto& emitted_spike : spike_register )
+  {
+    // Spikes that do not fit are sent after the buffers have grown
+    size_t& offset = offsets[ emitted_spike.rank ];
+    if ( offset < send_recv_count_per_rank )
+    {
+      send_buffer[ emitted_spike.rank * send_recv_count_per_rank + offset ] = emitted_spike.spike_data;
+    }
+    ++offset;
+  }
+}
+
+template < typename SpikeDataT >
+void
+EventDeliveryManager::mark_non_neighbor_chunks_empty_( const SendBufferPosition& send_buffer_position,
+  std::vector< SpikeDataT >& recv_buffer ) const
+{
+  // Only chunks from neighbouring ranks are received, all other chunks must appear empty
+  for ( size_t rank = 0; rank < kernel().mpi_manager.get_num_processes(); ++rank )
+  {
+    if ( not kernel().mpi_manager.is_neighbor_spike_source( rank ) )
+    {
+      recv_buffer[ send_buffer_position.begin( rank ) ].set_invalid_marker();
+    }
+  }
+}
+
+template < typename SpikeDataWithRankT, typename SpikeDataT >
+void
+EventDeliveryManager::collocate_spike_data_buffers_( SendBufferPosition& send_buffer_position,
+  std::vector< std::vector< SpikeDataWithRankT >* >& emitted_spikes_register,
+  std::vector< SpikeDataT >& send_buffer,
+  std::vector< size_t >& num_spikes_per_rank )
+{
+  // First dimension: loop over writing thread
+  for ( auto& emitted_spikes_per_thread : emitted_spikes_register )
+  {
+    // Second dimension: loop over entries
+    for ( auto& emitted_spike : *emitted_spikes_per_thread )
+    {
+      const size_t rank = emitted_spike.rank;
+
+      // We need to count here even though send_buffer_position also counts,
+      // but send_buffer_position will only count spikes actually written,
+      // we need all spikes to have information for buffer resizing.
+      ++num_spikes_per_rank[ rank ];
+
+      // We do not break if condition is false, because there may be spikes that
+      // can be sent to other ranks than the one that is full.
+      if ( not send_buffer_position.is_chunk_filled( rank ) )
+      {
+        send_buffer[ send_buffer_position.idx( rank ) ] = emitted_spike.spike_data;
+        send_buffer_position.increase( rank );
+      }
+    }
+  }
+}
+
+template < typename SpikeDataT >
+void
+EventDeliveryManager::set_end_marker_( const SendBufferPosition& send_buffer_position,
+  std::vector< SpikeDataT >& send_buffer,
+  size_t local_max_spikes_per_rank )
+{
+  // See comment in spike_data.h for logic.
+  const bool collocate_complete = local_max_spikes_per_rank
+    <= static_cast< size_t >( kernel().mpi_manager.get_send_recv_count_spike_data_per_rank() );
+
+  for ( size_t rank = 0; rank < kernel().mpi_manager.get_num_processes(); ++rank )
+  {
+    const size_t end_idx = send_buffer_position.end( rank ) - 1;
+    if ( not collocate_complete )
+    {
+      SpikeDataT dummy;
+      dummy.set_local_max_spikes_per_rank( local_max_spikes_per_rank );
+      dummy.set_invalid_marker();
+      send_buffer[ end_idx ] = dummy;
+      continue;
+    }
+
     const size_t next_write_idx = send_buffer_position.idx( rank );
     if ( next_write_idx == send_buffer_position.begin( rank ) )
     {
@@ -537,7 +1465,7 @@ EventDeliveryManager::set_end_marker_( const SendBufferPosition& send_buffer_pos
       // at least one spike written, but none to end_idx, thus we need complete marker
       // and size information
       SpikeDataT dummy;
-      dummy.set_lcid( local_max_spikes_per_rank );
+      dummy.set_local_max_spikes_per_rank( local_max_spikes_per_rank );
       dummy.set_complete_marker();
       send_buffer[ end_idx ] = dummy;
     }
@@ -556,6 +1484,47 @@ EventDeliveryManager::reset_complete_marker_spike_data_( const SendBufferPositio
   }
 }
 
+template < typename SpikeDataT >
+void
+EventDeliveryManager::sort_send_buffer_by_thread_( const SendBufferPosition& send_buffer_position,
+  std::vector< SpikeDataT >& send_buffer ) const
+{
+  const size_t num_threads = kernel().vp_manager.get_num_threads();
+  std::vector< size_t > thread_offsets( num_threads );
+  std::vector< SpikeDataT > sorted_chunk;
+
+  for ( size_t rank = 0; rank < kernel().mpi_manager.get_num_processes(); ++rank )
+  {
+    const size_t begin = send_buffer_position.begin( rank );
+    const size_t end = send_buffer_position.idx( rank );
+    if ( end - begin < 2 )
+    {
+      continue;
+    }
+
+    // Stable counting sort by target thread, preserving temporal order of spikes for each connection
+    std::fill( thread_offsets.begin(), thread_offsets.end(), 0 );
+    for ( size_t i = begin; i < end; ++i )
+    {
+      ++thread_offsets[ send_buffer[ i ].get_tid() ];
+    }
+    size_t offset = 0;
+    for ( auto& thread_offset : thread_offsets )
+    {
+      const size_t count = thread_offset;
+      thread_offset = offset;
+      offset += count;
+    }
+
+    sorted_chunk.resize( end - begin );
+    for ( size_t i = begin; i < end; ++i )
+    {
+      sorted_chunk[ thread_offsets[ send_buffer[ i ].get_tid() ]++ ] = send_buffer[ i ];
+    }
+    std::copy( sorted_chunk.begin(), sorted_chunk.end(), send_buffer.begin() + begin );
+  }
+}
+
 template < typename SpikeDataT >
 size_t
 EventDeliveryManager::get_global_max_spikes_per_rank_( const SendBufferPosition& send_buffer_position,
@@ -570,7 +1539,7 @@ EventDeliveryManager::get_global_max_spikes_per_rank_( const SendBufferPosition&
     size_t max_per_thread_max_spikes_per_rank = 0;
     if ( end_entry.is_complete_marker() or end_entry.is_invalid_marker() )
     {
-      max_per_thread_max_spikes_per_rank = end_entry.get_lcid();
+      max_per_thread_max_spikes_per_rank = end_entry.get_local_max_spikes_per_rank();
     }
     else
     {
@@ -582,20 +1551,224 @@ EventDeliveryManager::get_global_max_spikes_per_rank_( const SendBufferPosition&
   return maximum;
 }
 
+template < typename SpikeDataT >
+void
+EventDeliveryManager::encode_spike_data_( const SendBufferPosition& send_buffer_position,
+  const std::vector< SpikeDataT >& send_buffer,
+  const size_t local_max_spikes_per_rank )
+{
+  constexpr size_t num_ints_per_entry = sizeof( SpikeDataT ) / sizeof( unsigned int );
+  assert( encoded_chunk_size_ > ENCODED_CHUNK_HEADER_SIZE + num_ints_per_entry );
+
+  const size_t num_threads = kernel().vp_manager.get_num_threads();
+  const size_t stream_capacity =
+    ( encoded_chunk_size_ - ENCODED_CHUNK_HEADER_SIZE - num_ints_per_entry ) * sizeof( unsigned int );
+
+  // If not all spikes were collocated, they will be retransmitted, so only chunk-end entries need to be sent
+  const bool collocate_complete = local_max_spikes_per_rank
+    <= static_cast< size_t >( kernel().mpi_manager.get_send_recv_count_spike_data_per_rank() );
+
+  size_t max_chunk_size = 0;
+  for ( size_t rank = 0; rank < kernel().mpi_manager.get_num_processes(); ++rank )
+  {
+    unsigned int* chunk = &send_buffer_encoded_spike_data_[ rank * encoded_chunk_size_ ];
+    unsigned char* stream =
+      reinterpret_cast< unsigned char* >( chunk + ENCODED_CHUNK_HEADER_SIZE + num_ints_per_entry );
+
+    std::memcpy( chunk + ENCODED_CHUNK_HEADER_SIZE,
+      static_cast< const void* >( &send_buffer[ send_buffer_position.end( rank ) - 1 ] ),
+      sizeof( SpikeDataT ) );
+
+    const size_t begin = send_buffer_position.begin( rank );
+    const size_t num_spikes = collocate_complete ? send_buffer_position.idx( rank ) - begin : 0;
+
+    size_t num_bytes = 0;
+    synindex previous_syn_id = invalid_synindex;
+    size_t previous_lcid = 0;
+    for ( size_t idx = begin; idx < begin + num_spikes; ++idx )
+    {
+      const SpikeDataT& spike = send_buffer[ idx ];
+      const size_t lag_tid = spike.get_lag() * num_threads + spike.get_tid();
+      const bool new_block = spike.get_syn_id() != previous_syn_id;
+
+      write_varint_( ( lag_tid << 1 ) | new_block, stream, stream_capacity, num_bytes );
+      if ( new_block )
+      {
+        write_varint_( spike.get_syn_id(), stream, stream_capacity, num_bytes );
+        write_varint_( spike.get_lcid(), stream, stream_capacity, num_bytes );
+        previous_syn_id = spike.get_syn_id();
+      }
+      else
+      {
+        // Zigzag encoding, so that small negative differences also need few bytes
+        const long delta = static_cast< long >( spike.get_lcid() ) - static_cast< long >( previous_lcid );
+        write_varint_( delta >= 0 ? 2 * delta : -2 * delta - 1, stream, stream_capacity, num_bytes );
+      }
+      previous_lcid = spike.get_lcid();
+    }
+
+    chunk[ 1 ] = num_spikes;
+    const size_t chunk_size = ENCODED_CHUNK_HEADER_SIZE + num_ints_per_entry
+      + ( num_bytes + sizeof( unsigned int ) - 1 ) / sizeof( unsigned int );
+    max_chunk_size = std::max( max_chunk_size, chunk_size );
+  }
+
+  // Send the same required size to all ranks, so that all ranks agree on the size of the encoded buffers
+  for ( size_t rank = 0; rank < kernel().mpi_manager.get_num_processes(); ++rank )
+  {
+    send_buffer_encoded_spike_data_[ rank * encoded_chunk_size_ ] = max_chunk_size;
+  }
+}
+
+template < typename SpikeDataT >
+size_t
+EventDeliveryManager::decode_spike_data_( const SendBufferPosition& send_buffer_position,
+  std::vector< SpikeDataT >& recv_buffer )
+{
+  constexpr size_t num_ints_per_entry = sizeof( SpikeDataT ) / sizeof( unsigned int );
+  const size_t num_threads = kernel().vp_manager.get_num_threads();
+
+  // Chunk-end entries are always restored, since they are needed to determine the required spike buffer size
+  size_t max_chunk_size = 0;
+  for ( size_t rank = 0; rank < kernel().mpi_manager.get_num_processes(); ++rank )
+  {
+    const unsigned int* chunk = &recv_buffer_encoded_spike_data_[ rank * encoded_chunk_size_ ];
+    max_chunk_size = std::max( max_chunk_size, static_cast< size_t >( chunk[ 0 ] ) );
+    std::memcpy( static_cast< void* >( &recv_buffer[ send_buffer_position.end( rank ) - 1 ] ),
+      chunk + ENCODED_CHUNK_HEADER_SIZE,
+      sizeof( SpikeDataT ) );
+  }
+
+  if ( max_chunk_size > encoded_chunk_size_ )
+  {
+    // Some streams were truncated, all spikes will be retransmitted
+    return max_chunk_size;
+  }
+
+  for ( size_t rank = 0; rank < kernel().mpi_manager.get_num_processes(); ++rank )
+  {
+    const unsigned int* chunk = &recv_buffer_encoded_spike_data_[ rank * encoded_chunk_size_ ];
+    const unsigned char* stream =
+      reinterpret_cast< const unsigned char* >( chunk + ENCODED_CHUNK_HEADER_SIZE + num_ints_per_entry );
+    const size_t begin = send_buffer_position.begin( rank );
+    const size_t num_spikes = chunk[ 1 ];
+
+    if ( num_spikes == 0 )
+    {
+      recv_buffer[ begin ].set_invalid_marker();
+      continue;
+    }
+
+    size_t pos = 0;
+    synindex syn_id = 0;
+    size_t lcid = 0;
+    for ( size_t idx = begin; idx < begin + num_spikes; ++idx )
+    {
+      const size_t key = read_varint_( stream, pos );
+      if ( key & 1 )
+      {
+        syn_id = read_varint_( stream, pos );
+        lcid = read_varint_( stream, pos );
+      }
+      else
+      {
+        const size_t delta = read_varint_( stream, pos );
+        lcid = delta & 1 ? lcid - ( delta + 1 ) / 2 : lcid + delta / 2;
+      }
+
+      const size_t lag_tid = key >> 1;
+      recv_buffer[ idx ] = SpikeData( lag_tid % num_threads, syn_id, lcid, lag_tid / num_threads );
+    }
+    recv_buffer[ begin + num_spikes - 1 ].set_end_marker();
+  }
+
+  return max_chunk_size;
+}
+
+void
+EventDeliveryManager::write_varint_( size_t value, unsigned char* stream, const size_t capacity, size_t& num_bytes )
+{
+  while ( value >= 0x80 )
+  {
+    if ( num_bytes < capacity )
+    {
+      stream[ num_bytes ] = static_cast< unsigned char >( value | 0x80 );
+    }
+    ++num_bytes;
+    value >>= 7;
+  }
+  if ( num_bytes < capacity )
+  {
+    stream[ num_bytes ] = static_cast< unsigned char >( value );
+  }
+  ++num_bytes;
+}
+
+size_t
+EventDeliveryManager::read_varint_( const unsigned char* stream, size_t& pos )
+{
+  size_t value = 0;
+  unsigned int shift = 0;
+  while ( stream[ pos ] & 0x80 )
+  {
+    value |= static_cast< size_t >( stream[ pos++ ] & 0x7f ) << shift;
+    shift += 7;
+  }
+  value |= static_cast< size_t >( stream[ pos++ ] ) << shift;
+  return value;
+}
+
 void
 EventDeliveryManager::deliver_events( const size_t tid )
 {
+  // Spikes of earlier pipeline stages are delivered first, so that they arrive in temporal order
+  for ( size_t stage = 0; stage + 1 < num_pipeline_stages_; ++stage )
+  {
+    if ( off_grid_spiking_ )
+    {
+      deliver_spike_data_( tid, pipelined_recv_buffer_off_grid_spike_data_[ stage ], partitioned_off_grid_spike_data_ );
+    }
+    else if ( compact_spike_data_active_ )
+    {
+      deliver_spike_data_( tid, pipelined_recv_buffer_compact_spike_data_[ stage ], partitioned_compact_spike_data_ );
+    }
+    else
+    {
+      deliver_spike_data_( tid, pipelined_recv_buffer_spike_data_[ stage ], partitioned_spike_data_ );
+    }
+  }
+
   if ( off_grid_spiking_ )
   {
-    deliver_events_( tid, recv_buffer_off_grid_spike_data_ );
+    deliver_spike_data_( tid, recv_buffer_off_grid_spike_data_, partitioned_off_grid_spike_data_ );
+  }
+  else if ( compact_spike_data_active_ )
+  {
+    deliver_spike_data_( tid, recv_buffer_compact_spike_data_, partitioned_compact_spike_data_ );
   }
   else
   {
-    deliver_events_( tid, recv_buffer_spike_data_ );
+    deliver_spike_data_( tid, recv_buffer_spike_data_, partitioned_spike_data_ );
   }
   reset_spike_register_( tid );
 }
 
+template < typename SpikeDataT >
+void
+EventDeliveryManager::deliver_spike_data_( const size_t tid,
+  const std::vector< SpikeDataT >& recv_buffer,
+  std::vector< std::vector< std::vector< SpikeDataT > > >& partitioned_spike_data )
+{
+  if ( sort_spikes_by_target_ )
+  {
+    deliver_events_target_sorted_( tid, recv_buffer, partitioned_spike_data );
+  }
+  else
+  {
+    deliver_events_( tid, recv_buffer );
+  }
+}
+
 template < typename SpikeDataT >
 void
 EventDeliveryManager::deliver_events_( const size_t tid, const std::vector< SpikeDataT >& recv_buffer )
@@ -609,6 +1782,14 @@ EventDeliveryManager::deliver_events_( const size_t tid, const std::vector< Spik
   const size_t spike_buffer_size_per_rank = kernel().mpi_manager.get_send_recv_count_spike_data_per_rank();
   const std::vector< ConnectorModel* >& cm = kernel().model_manager.get_connection_models( tid );
 
+  // Thread sections are only meaningful if each spike is addressed to a single target thread
+  const bool use_thread_sections =
+    spike_buffer_thread_sections_ and not kernel().connection_manager.use_compressed_spikes();
+  if ( use_thread_sections )
+  {
+    find_spike_thread_sections_( tid, recv_buffer );
+  }
+
   // prepare Time objects for every possible time stamp within min_delay_
   std::vector< Time > prepared_timestamps( kernel().connection_manager.get_min_delay() );
   for ( size_t lag = 0; lag < static_cast< size_t >( kernel().connection_manager.get_min_delay() ); ++lag )
@@ -618,46 +1799,60 @@ EventDeliveryManager::deliver_events_( const size_t tid, const std::vector< Spik
       kernel().simulation_manager.get_clock() + Time::step( lag + 1 - kernel().connection_manager.get_min_delay() );
   }
 
+  const size_t spikes_per_batch = spike_delivery_batch_size_;
+  SpikeDeliveryBatch& batch = spike_delivery_batches_[ tid ];
+  std::vector< SpikeEvent >& se_batch = batch.se;
+  std::vector< size_t >& tid_batch = batch.tid;
+  std::vector< size_t >& syn_id_batch = batch.syn_id;
+  std::vector< size_t >& lcid_batch = batch.lcid;
+
   // Deliver spikes sent by each rank in order
   for ( size_t rank = 0; rank < kernel().mpi_manager.get_num_processes(); ++rank )
   {
-    // Continue with next rank if no spikes were sent by current rank
-    if ( recv_buffer[ rank * spike_buffer_size_per_rank ].is_invalid_marker() )
+    // Index of first entry to read and number of entries to read from the chunk of the current rank
+    size_t read_begin = rank * spike_buffer_size_per_rank;
+    size_t num_spikes_received = 0;
+
+    if ( use_thread_sections )
     {
-      continue;
+      // Only read the section of the chunk containing spikes for this thread
+      const size_t section_idx = rank * ( kernel().vp_manager.get_num_threads() + 1 ) + tid;
+      read_begin += spike_thread_section_begin_[ section_idx ];
+      num_spikes_received = spike_thread_section_begin_[ section_idx + 1 ] - spike_thread_section_begin_[ section_idx ];
     }
-
-    // Find number of spikes received from current rank
-    size_t num_spikes_received = 0;
-    for ( size_t i = 0; i < spike_buffer_size_per_rank; ++i )
+    else
     {
-      const SpikeDataT& spike_data = recv_buffer[ rank * spike_buffer_size_per_rank + i ];
+      // Continue with next rank if no spikes were sent by current rank
+      if ( recv_buffer[ rank * spike_buffer_size_per_rank ].is_invalid_marker() )
+      {
+        continue;
+      }
 
-      // break if this was the last valid entry from this rank
-      if ( spike_data.is_end_marker() )
+      // Find number of spikes received from current rank
+      for ( size_t i = 0; i < spike_buffer_size_per_rank; ++i )
       {
-        num_spikes_received = i + 1;
-        break;
+        const SpikeDataT& spike_data = recv_buffer[ rank * spike_buffer_size_per_rank + i ];
+
+        // break if this was the last valid entry from this rank
+        if ( spike_data.is_end_marker() )
+        {
+          num_spikes_received = i + 1;
+          break;
+        }
       }
     }
 
     // For each batch, extract data first from receive buffer into value-specific arrays, then deliver from these arrays
-    constexpr size_t SPIKES_PER_BATCH = 8;
-    const size_t num_batches = num_spikes_received / SPIKES_PER_BATCH;
-    const size_t num_remaining_entries = num_spikes_received - num_batches * SPIKES_PER_BATCH;
-
-    SpikeEvent se_batch[ SPIKES_PER_BATCH ];
-    size_t tid_batch[ SPIKES_PER_BATCH ];
-    size_t syn_id_batch[ SPIKES_PER_BATCH ];
-    size_t lcid_batch[ SPIKES_PER_BATCH ];
+    const size_t num_batches = num_spikes_received / spikes_per_batch;
+    const size_t num_remaining_entries = num_spikes_received - num_batches * spikes_per_batch;
 
     if ( not kernel().connection_manager.use_compressed_spikes() )
     {
       for ( size_t i = 0; i < num_batches; ++i )
       {
-        for ( size_t j = 0; j < SPIKES_PER_BATCH; ++j )
+        for ( size_t j = 0; j < spikes_per_batch; ++j )
         {
-          const SpikeDataT& spike_data = recv_buffer[ rank * spike_buffer_size_per_rank + i * SPIKES_PER_BATCH + j ];
+          const SpikeDataT& spike_data = recv_buffer[ read_begin + i * spikes_per_batch + j ];
           se_batch[ j ].set_stamp( prepared_timestamps[ spike_data.get_lag() ] );
           se_batch[ j ].set_offset( spike_data.get_offset() );
           tid_batch[ j ] = spike_data.get_tid();
@@ -665,7 +1860,7 @@ EventDeliveryManager::deliver_events_( const size_t tid, const std::vector< Spik
           lcid_batch[ j ] = spike_data.get_lcid();
           se_batch[ j ].set_sender_node_id_info( tid_batch[ j ], syn_id_batch[ j ], lcid_batch[ j ] );
         }
-        for ( size_t j = 0; j < SPIKES_PER_BATCH; ++j )
+        for ( size_t j = 0; j < spikes_per_batch; ++j )
         {
           if ( tid_batch[ j ] == tid )
           {
@@ -677,8 +1872,7 @@ EventDeliveryManager::deliver_events_( const size_t tid, const std::vector< Spik
       // Processed all regular-sized batches, now do remainder
       for ( size_t j = 0; j < num_remaining_entries; ++j )
       {
-        const SpikeDataT& spike_data =
-          recv_buffer[ rank * spike_buffer_size_per_rank + num_batches * SPIKES_PER_BATCH + j ];
+        const SpikeDataT& spike_data = recv_buffer[ read_begin + num_batches * spikes_per_batch + j ];
         se_batch[ j ].set_stamp( prepared_timestamps[ spike_data.get_lag() ] );
         se_batch[ j ].set_offset( spike_data.get_offset() );
         tid_batch[ j ] = spike_data.get_tid();
@@ -698,9 +1892,9 @@ EventDeliveryManager::deliver_events_( const size_t tid, const std::vector< Spik
     {
       for ( size_t i = 0; i < num_batches; ++i )
       {
-        for ( size_t j = 0; j < SPIKES_PER_BATCH; ++j )
+        for ( size_t j = 0; j < spikes_per_batch; ++j )
         {
-          const SpikeDataT& spike_data = recv_buffer[ rank * spike_buffer_size_per_rank + i * SPIKES_PER_BATCH + j ];
+          const SpikeDataT& spike_data = recv_buffer[ read_begin + i * spikes_per_batch + j ];
 
           se_batch[ j ].set_stamp( prepared_timestamps[ spike_data.get_lag() ] );
           se_batch[ j ].set_offset( spike_data.get_offset() );
@@ -710,14 +1904,14 @@ EventDeliveryManager::deliver_events_( const size_t tid, const std::vector< Spik
           // compressed_spike_data structure
           lcid_batch[ j ] = spike_data.get_lcid();
         }
-        for ( size_t j = 0; j < SPIKES_PER_BATCH; ++j )
+        for ( size_t j = 0; j < spikes_per_batch; ++j )
         {
           // find the spike-data entry for this thread
           const std::vector< SpikeData >& compressed_spike_data =
             kernel().connection_manager.get_compressed_spike_data( syn_id_batch[ j ], lcid_batch[ j ] );
           lcid_batch[ j ] = compressed_spike_data[ tid ].get_lcid();
         }
-        for ( size_t j = 0; j < SPIKES_PER_BATCH; ++j )
+        for ( size_t j = 0; j < spikes_per_batch; ++j )
         {
           if ( lcid_batch[ j ] != invalid_lcid )
           {
@@ -726,7 +1920,7 @@ EventDeliveryManager::deliver_events_( const size_t tid, const std::vector< Spik
             se_batch[ j ].set_sender_node_id_info( tid, syn_id_batch[ j ], lcid_batch[ j ] );
           }
         }
-        for ( size_t j = 0; j < SPIKES_PER_BATCH; ++j )
+        for ( size_t j = 0; j < spikes_per_batch; ++j )
         {
           if ( lcid_batch[ j ] != invalid_lcid )
           {
@@ -738,8 +1932,7 @@ EventDeliveryManager::deliver_events_( const size_t tid, const std::vector< Spik
       // Processed all regular-sized batches, now do remainder
       for ( size_t j = 0; j < num_remaining_entries; ++j )
       {
-        const SpikeDataT& spike_data =
-          recv_buffer[ rank * spike_buffer_size_per_rank + num_batches * SPIKES_PER_BATCH + j ];
+        const SpikeDataT& spike_data = recv_buffer[ read_begin + num_batches * spikes_per_batch + j ];
         se_batch[ j ].set_stamp( prepared_timestamps[ spike_data.get_lag() ] );
         se_batch[ j ].set_offset( spike_data.get_offset() );
         syn_id_batch[ j ] = spike_data.get_syn_id();
@@ -774,6 +1967,220 @@ EventDeliveryManager::deliver_events_( const size_t tid, const std::vector< Spik
   }   // for rank
 }
 
+template < typename SpikeDataT >
+void
+EventDeliveryManager::count_spikes_received_per_rank_( const size_t tid, const std::vector< SpikeDataT >& recv_buffer )
+{
+  const size_t num_threads = kernel().vp_manager.get_num_threads();
+  const size_t spike_buffer_size_per_rank = kernel().mpi_manager.get_send_recv_count_spike_data_per_rank();
+
+  for ( size_t rank = tid; rank < kernel().mpi_manager.get_num_processes(); rank += num_threads )
+  {
+    num_spikes_received_per_rank_[ rank ] = 0;
+
+    // No spikes were sent by this rank
+    if ( recv_buffer[ rank * spike_buffer_size_per_rank ].is_invalid_marker() )
+    {
+      continue;
+    }
+
+    for ( size_t i = 0; i < spike_buffer_size_per_rank; ++i )
+    {
+      // the entry carrying the end marker is the last valid entry from this rank
+      if ( recv_buffer[ rank * spike_buffer_size_per_rank + i ].is_end_marker() )
+      {
+        num_spikes_received_per_rank_[ rank ] = i + 1;
+        break;
+      }
+    }
+  }
+}
+
+template < typename SpikeDataT >
+void
+EventDeliveryManager::find_spike_thread_sections_( const size_t tid, const std::vector< SpikeDataT >& recv_buffer )
+{
+  const size_t num_threads = kernel().vp_manager.get_num_threads();
+  const size_t num_processes = kernel().mpi_manager.get_num_processes();
+  const size_t spike_buffer_size_per_rank = kernel().mpi_manager.get_send_recv_count_spike_data_per_rank();
+
+#pragma omp single
+  {
+    num_spikes_received_per_rank_.resize( num_processes );
+    spike_thread_section_begin_.resize( num_processes * ( num_threads + 1 ) );
+  } // of omp single; implicit barrier
+
+  // Each thread handles the same ranks here as in count_spikes_received_per_rank_(), so no barrier is needed
+  count_spikes_received_per_rank_( tid, recv_buffer );
+
+  for ( size_t rank = tid; rank < num_processes; rank += num_threads )
+  {
+    // Entries in each chunk are sorted by target thread, see sort_send_buffer_by_thread_()
+    const auto chunk_begin = recv_buffer.begin() + rank * spike_buffer_size_per_rank;
+    const auto chunk_end = chunk_begin + num_spikes_received_per_rank_[ rank ];
+    auto section_begin = chunk_begin;
+    for ( size_t t = 0; t < num_threads; ++t )
+    {
+      section_begin = std::lower_bound( section_begin,
+        chunk_end,
+        t,
+        []( const SpikeDataT& spike_data, const size_t thread ) { return spike_data.get_tid() < thread; } );
+      spike_thread_section_begin_[ rank * ( num_threads + 1 ) + t ] = section_begin - chunk_begin;
+    }
+    spike_thread_section_begin_[ rank * ( num_threads + 1 ) + num_threads ] = num_spikes_received_per_rank_[ rank ];
+  }
+
+  kernel().get_omp_synchronization_simulation_stopwatch().start();
+#pragma omp barrier
+  kernel().get_omp_synchronization_simulation_stopwatch().stop();
+}
+
+template < typename SpikeDataT >
+void
+EventDeliveryManager::deliver_events_target_sorted_( const size_t tid,
+  const std::vector< SpikeDataT >& recv_buffer,
+  std::vector< std::vector< std::vector< SpikeDataT > > >& partitioned_spike_data )
+{
+  // deliver only at beginning of time slice
+  if ( kernel().simulation_manager.get_from_step() > 0 )
+  {
+    return;
+  }
+
+  const size_t num_threads = kernel().vp_manager.get_num_threads();
+  const size_t num_processes = kernel().mpi_manager.get_num_processes();
+  const size_t spike_buffer_size_per_rank = kernel().mpi_manager.get_send_recv_count_spike_data_per_rank();
+  const bool use_compressed_spikes = kernel().connection_manager.use_compressed_spikes();
+
+#pragma omp single
+  {
+    num_spikes_received_per_rank_.resize( num_processes );
+  } // of omp single; implicit barrier
+
+  count_spikes_received_per_rank_( tid, recv_buffer );
+
+  // Entries in partitioned_spike_data[ tid ] have been read by all threads during
+  // the previous delivery, so the writing thread can safely clear them now.
+  for ( auto& spikes_for_thread : partitioned_spike_data[ tid ] )
+  {
+    spikes_for_thread.clear();
+  }
+
+  kernel().get_omp_synchronization_simulation_stopwatch().start();
+#pragma omp barrier
+  kernel().get_omp_synchronization_simulation_stopwatch().stop();
+
+  // Split all valid entries of the receive buffer evenly across threads
+  const size_t num_spikes_received =
+    std::accumulate( num_spikes_received_per_rank_.begin(), num_spikes_received_per_rank_.end(), size_t( 0 ) );
+  const size_t my_begin = tid * num_spikes_received / num_threads;
+  const size_t my_end = ( tid + 1 ) * num_spikes_received / num_threads;
+
+  size_t rank_begin = 0; // index of first spike from current rank in sequence of all valid spikes
+  for ( size_t rank = 0; rank < num_processes and rank_begin < my_end; ++rank )
+  {
+    const size_t rank_end = rank_begin + num_spikes_received_per_rank_[ rank ];
+    const size_t first = std::max( rank_begin, my_begin );
+    const size_t last = std::min( rank_end, my_end );
+
+    for ( size_t i = first; i < last; ++i )
+    {
+      const SpikeDataT& spike_data = recv_buffer[ rank * spike_buffer_size_per_rank + ( i - rank_begin ) ];
+      SpikeDataT entry = spike_data;
+      entry.reset_marker();
+
+      if ( not use_compressed_spikes )
+      {
+        partitioned_spike_data[ tid ][ spike_data.get_tid() ].push_back( entry );
+      }
+      else
+      {
+        // for compressed spikes lcid holds the index in the compressed_spike_data structure,
+        // which provides the lcid for each thread with targets of the sender
+        const std::vector< SpikeData >& compressed_spike_data =
+          kernel().connection_manager.get_compressed_spike_data( spike_data.get_syn_id(), spike_data.get_lcid() );
+        for ( size_t t = 0; t < num_threads; ++t )
+        {
+          const size_t lcid = compressed_spike_data[ t ].get_lcid();
+          if ( lcid != invalid_lcid )
+          {
+            entry.set_lcid( lcid );
+            partitioned_spike_data[ tid ][ t ].push_back( entry );
+          }
+        }
+      }
+    }
+
+    rank_begin = rank_end;
+  }
+
+  kernel().get_omp_synchronization_simulation_stopwatch().start();
+#pragma omp barrier
+  kernel().get_omp_synchronization_simulation_stopwatch().stop();
+
+  // Collect all spikes for this thread in the entry this thread has written itself
+  std::vector< SpikeDataT >& spikes = partitioned_spike_data[ tid ][ tid ];
+  for ( size_t writer = 0; writer < num_threads; ++writer )
+  {
+    if ( writer != tid )
+    {
+      const std::vector< SpikeDataT >& spikes_from_writer = partitioned_spike_data[ writer ][ tid ];
+      spikes.insert( spikes.end(), spikes_from_writer.begin(), spikes_from_writer.end() );
+    }
+  }
+
+  // Sort into the order in which connections are stored. Lag is included in the key so that
+  // plastic synapses see spikes in temporal order.
+  std::sort( spikes.begin(),
+    spikes.end(),
+    []( const SpikeDataT& lhs, const SpikeDataT& rhs )
+    {
+      if ( lhs.get_syn_id() != rhs.get_syn_id() )
+      {
+        return lhs.get_syn_id() < rhs.get_syn_id();
+      }
+      if ( lhs.get_lcid() != rhs.get_lcid() )
+      {
+        return lhs.get_lcid() < rhs.get_lcid();
+      }
+      return lhs.get_lag() < rhs.get_lag();
+    } );
+
+  const std::vector< ConnectorModel* >& cm = kernel().model_manager.get_connection_models( tid );
+
+  // prepare Time objects for every possible time stamp within min_delay_
+  std::vector< Time > prepared_timestamps( kernel().connection_manager.get_min_delay() );
+  for ( size_t lag = 0; lag < static_cast< size_t >( kernel().connection_manager.get_min_delay() ); ++lag )
+  {
+    // Subtract min_delay because spikes were emitted in previous time slice and we use current clock.
+    prepared_timestamps[ lag ] =
+      kernel().simulation_manager.get_clock() + Time::step( lag + 1 - kernel().connection_manager.get_min_delay() );
+  }
+
+  // Connections are prefetched one batch ahead of delivery
+  const size_t prefetch_distance = spike_delivery_batch_size_;
+  for ( size_t i = 0; i < std::min( prefetch_distance, spikes.size() ); ++i )
+  {
+    kernel().connection_manager.prefetch_connection( tid, spikes[ i ].get_syn_id(), spikes[ i ].get_lcid() );
+  }
+
+  SpikeEvent se;
+  for ( size_t i = 0; i < spikes.size(); ++i )
+  {
+    if ( i + prefetch_distance < spikes.size() )
+    {
+      const SpikeDataT& ahead = spikes[ i + prefetch_distance ];
+      kernel().connection_manager.prefetch_connection( tid, ahead.get_syn_id(), ahead.get_lcid() );
+    }
+
+    const SpikeDataT& spike_data = spikes[ i ];
+    se.set_stamp( prepared_timestamps[ spike_data.get_lag() ] );
+    se.set_offset( spike_data.get_offset() );
+    se.set_sender_node_id_info( tid, spike_data.get_syn_id(), spike_data.get_lcid() );
+    kernel().connection_manager.send( tid, spike_data.get_syn_id(), spike_data.get_lcid(), cm, se );
+  }
+}
+
 
 void
 EventDeliveryManager::gather_target_data( const size_t tid )
@@ -785,6 +2192,7 @@ EventDeliveryManager::gather_target_data( const size_t tid )
   assert( gather_completed_checker_.all_false() );
 
   const AssignedRanks assigned_ranks = kernel().vp_manager.get_assigned_ranks( tid );
+  local_target_data_counter_[ tid ] = 0;
 
   kernel().connection_manager.prepare_target_table( tid );
   kernel().connection_manager.reset_source_table_entry_point( tid );
@@ -813,6 +2221,7 @@ EventDeliveryManager::gather_target_data( const size_t tid )
 
     const bool gather_completed = collocate_target_data_buffers_( tid, assigned_ranks, send_buffer_position );
     gather_completed_checker_.logical_and( tid, gather_completed );
+    local_target_data_counter_[ tid ] += send_buffer_position.get_num_target_data_written();
 
     if ( gather_completed_checker_.all_true() )
     {
@@ -859,6 +2268,7 @@ EventDeliveryManager::gather_target_data_compressed( const size_t tid )
   assert( gather_completed_checker_.all_false() );
 
   const AssignedRanks assigned_ranks = kernel().vp_manager.get_assigned_ranks( tid );
+  local_target_data_counter_[ tid ] = 0;
 
   kernel().connection_manager.prepare_target_table( tid );
 
@@ -885,6 +2295,7 @@ EventDeliveryManager::gather_target_data_compressed( const size_t tid )
       collocate_target_data_buffers_compressed_( tid, assigned_ranks, send_buffer_position );
 
     gather_completed_checker_.logical_and( tid, gather_completed );
+    local_target_data_counter_[ tid ] += send_buffer_position.get_num_target_data_written();
 
     if ( gather_completed_checker_.all_true() )
     {
@@ -24,6 +24,7 @@
 #define EVENT_DELIVERY_MANAGER_H
 
 // C++ includes:
+#include <algorithm>
 #include <cassert>
 #include <limits>
 #include <vector>
@@ -107,6 +108,9 @@ public:
    * elements are updated and the system is
    * in a synchronised (single threaded) state.
    * @see send_to_targets()
+   *
+   * The spike is stored in the spike register of thread tid, which may differ
+   * from the thread of the sender if the sender is updated by another thread.
    */
   void send_remote( size_t tid, SpikeEvent&, const long lag = 0 );
 
@@ -128,9 +132,21 @@ public:
    * elements are updated and the system is
    * in a synchronised (single threaded) state.
    * @see send_to_targets()
+   *
+   * The spike is stored in the spike register of thread tid, which may differ
+   * from the thread of the sender if the sender is updated by another thread.
    */
   void send_off_grid_remote( size_t tid, SpikeEvent& e, const long lag = 0 );
 
+  /**
+   * Send the spikes staged for the devices of thread tid to these devices.
+   *
+   * Spikes of nodes updated by another thread than their own are staged per updating thread, so that
+   * the recording devices of a thread are only accessed by that thread. Thread tid must call this after
+   * all threads have finished the update phase.
+   */
+  void send_staged_spikes_to_devices( const size_t tid );
+
   /**
    * Send event e directly to its target node.
    *
@@ -202,8 +218,54 @@ public:
   /**
    * Collocates spikes from register to MPI buffers, communicates via
    * MPI and delivers events to targets.
+   *
+   * If the time slice is split into several pipeline stages, this
+   * exchanges the spikes of the last stage.
+   *
+   * All threads collocate their own spikes, communication is done by the master thread.
+   *
+   * @note Must be called by all threads, contains barriers.
+   */
+  void gather_spike_data( const size_t tid );
+
+  /**
+   * Choose whether spikes are exchanged as CompactSpikeData.
+   *
+   * The compact encoding is used if compact_spike_data is set and
+   * the largest lag, thread, synapse-type and connection index on
+   * any rank fit into 32 bits. Once simulation has started, the
+   * layout is fixed and the exchange falls back to SpikeData if
+   * connections no longer fit.
    */
-  void gather_spike_data();
+  void configure_spike_data_encoding();
+
+  /**
+   * Set up the pipeline for the spike exchange within each time slice.
+   *
+   * Splits each time slice into stages of equal length, bounded by
+   * spike_exchange_pipeline_depth. The number of stages is fixed once
+   * simulation has started.
+   */
+  void configure_spike_exchange_pipeline();
+
+  /**
+   * Return the step within the current time slice at which the pipeline stage containing `step` ends.
+   */
+  long get_pipeline_stage_end( const long step ) const;
+
+  /**
+   * Collocates spikes emitted during the current pipeline stage to MPI
+   * buffers and starts a non-blocking exchange.
+   *
+   * The exchange overlaps with the update of the next stage and is
+   * completed before the spikes of the next stage are exchanged.
+   */
+  void start_spike_data_exchange();
+
+  /**
+   * Complete the pending non-blocking spike exchange, if any.
+   */
+  void complete_spike_data_exchange();
 
   /**
    * Collocates presynaptic connection information, communicates via
@@ -269,11 +331,131 @@ public:
   virtual void reset_timers_for_dynamics();
 
 private:
+  /**
+   * Convert received spikes that still need to be delivered from compact to full encoding.
+   */
+  void expand_compact_spike_data_();
+
+  template < typename SpikeDataT >
+  void gather_spike_data_( const size_t tid,
+    std::vector< SpikeDataT >& send_buffer,
+    std::vector< SpikeDataT >& recv_buffer,
+    std::vector< std::vector< SpikeDataT > >& pipelined_recv_buffers );
+
+  /**
+   * Collocate and exchange spikes in the spike register, growing the buffers until all spikes are transmitted.
+   */
+  template < typename SpikeDataT >
+  void exchange_spike_data_( std::vector< SpikeDataT >& send_buffer,
+    std::vector< SpikeDataT >& recv_buffer,
+    std::vector< std::vector< SpikeDataT > >& pipelined_recv_buffers );
+
+  template < typename SpikeDataT >
+  void start_spike_data_exchange_( std::vector< SpikeDataT >& send_buffer,
+    std::vector< std::vector< SpikeDataT > >& pipelined_recv_buffers );
+
+  /**
+   * Wait for the pending exchange and retransmit its spikes if they did not fit into the buffers.
+   */
+  template < typename SpikeDataT >
+  void complete_spike_data_exchange_( std::vector< SpikeDataT >& send_buffer,
+    std::vector< std::vector< SpikeDataT > >& pipelined_recv_buffers );
+
+  /**
+   * Adapt spike buffers at the beginning of a time slice to the number of spikes sent in previous slices.
+   *
+   * By default, buffers shrink if they were much larger than needed in the previous slice. With
+   * predictive sizing, buffers are sized to an exponential moving average of the per-slice maxima,
+   * which follows increases immediately and decays slowly after bursts.
+   *
+   * The prediction is global: MPI_Alltoall exchanges chunks of equal size between all pairs of ranks,
+   * so the single pair of ranks with most spikes determines the size of all chunks.
+   */
+  void adapt_send_recv_buffers_spike_data_();
+
+  /**
+   * Grow spike buffers to fit the given number of spikes per rank.
+   *
+   * Receive buffers of pipeline stages already exchanged in the current time
+   * slice are rearranged so that each chunk starts at its new position.
+   */
   template < typename SpikeDataT >
-  void gather_spike_data_( std::vector< SpikeDataT >& send_buffer, std::vector< SpikeDataT >& recv_buffer );
+  void grow_send_recv_buffers_spike_data_( const size_t max_spikes_per_rank,
+    std::vector< std::vector< SpikeDataT > >& pipelined_recv_buffers );
 
+  /**
+   * Grow the send, receive and pipelined receive buffers of the spike data type in use to the buffer size.
+   *
+   * Buffers of the other spike data types are left unchanged, so that unused types do not occupy memory.
+   */
   void resize_send_recv_buffers_spike_data_();
 
+  template < typename SpikeDataT >
+  void resize_send_recv_buffers_spike_data_( std::vector< SpikeDataT >& send_buffer,
+    std::vector< SpikeDataT >& recv_buffer,
+    std::vector< std::vector< SpikeDataT > >& pipelined_recv_buffers );
+
+  //! Free the memory of spike buffers of a spike data type no longer in use.
+  template < typename SpikeDataT >
+  void release_send_recv_buffers_spike_data_( std::vector< SpikeDataT >& send_buffer,
+    std::vector< SpikeDataT >& recv_buffer,
+    std::vector< std::vector< SpikeDataT > >& pipelined_recv_buffers );
+
+  /**
+   * Collocate all spikes in the spike registers to the send buffer and set markers.
+   *
+   * @returns largest number of spikes to be sent to any rank
+   */
+  template < typename SpikeDataT >
+  size_t collocate_spike_data_( SendBufferPosition& send_buffer_position, std::vector< SpikeDataT >& send_buffer );
+
+  /**
+   * Write the spikes in the registers of this thread to the send buffer.
+   *
+   * Threads first count their spikes for each rank. A prefix sum over these counts, computed in parallel over
+   * ranks, then gives each thread an exclusive range in each rank's chunk, so that spikes end up in the same
+   * order as with serial collocation. Markers are set by the next call to collocate_spike_data_().
+   *
+   * @note Must be called by all threads, contains barriers.
+   */
+  template < typename SpikeDataT >
+  void collocate_spike_data_in_parallel_( const size_t tid, std::vector< SpikeDataT >& send_buffer );
+
+  /**
+   * Write spikes in a register to the send buffer, starting at the given offset into each rank's chunk.
+   *
+   * Offsets are advanced past the written spikes.
+   */
+  template < typename SpikeDataWithRankT, typename SpikeDataT >
+  void collocate_spike_register_( const std::vector< SpikeDataWithRankT >& spike_register,
+    std::vector< SpikeDataT >& send_buffer,
+    std::vector< size_t >::iterator offsets );
+
+  /**
+   * Mark chunks that are not received in neighbourhood exchange as empty.
+   */
+  template < typename SpikeDataT >
+  void mark_non_neighbor_chunks_empty_( const SendBufferPosition& send_buffer_position,
+    std::vector< SpikeDataT >& recv_buffer ) const;
+
+  /**
+   * Swap spike registers with the registers holding the spikes of the given pipeline stage.
+   */
+  void swap_pipeline_stage_registers_( const size_t stage );
+
+  /**
+   * Free spike registers of pipeline stages.
+   */
+  void delete_pipeline_stage_registers_();
+
+  /**
+   * Deliver spikes from a receive buffer using the selected delivery method.
+   */
+  template < typename SpikeDataT >
+  void deliver_spike_data_( const size_t tid,
+    const std::vector< SpikeDataT >& recv_buffer,
+    std::vector< std::vector< std::vector< SpikeDataT > > >& partitioned_spike_data );
+
   /**
    * Moves spikes from on grid and off grid spike registers to correct
    * locations in MPI buffers.
@@ -303,6 +485,15 @@ private:
   void reset_complete_marker_spike_data_( const SendBufferPosition& send_buffer_position,
     std::vector< SpikeDataT >& send_buffer ) const;
 
+  /**
+   * Sort spikes in each rank's chunk of the send buffer by target thread.
+   *
+   * The receiving rank can then read per-thread sections of its receive buffer, see find_spike_thread_sections_().
+   */
+  template < typename SpikeDataT >
+  void sort_send_buffer_by_thread_( const SendBufferPosition& send_buffer_position,
+    std::vector< SpikeDataT >& send_buffer ) const;
+
   /**
    * Get required buffer size.
    *
@@ -312,6 +503,47 @@ private:
   size_t get_global_max_spikes_per_rank_( const SendBufferPosition& send_buffer_position,
     std::vector< SpikeDataT >& recv_buffer ) const;
 
+  /**
+   * Encode each rank's chunk of the send buffer as a byte stream in the encoded send buffer.
+   *
+   * For each spike, the combination of lag and target thread is written as a variable-length integer. At the
+   * beginning of each block of consecutive spikes with the same synapse type, synapse type and local connection id
+   * follow; within a block, only the difference to the local connection id of the previous spike follows. Chunk-end
+   * entries are copied unchanged.
+   */
+  template < typename SpikeDataT >
+  void encode_spike_data_( const SendBufferPosition& send_buffer_position,
+    const std::vector< SpikeDataT >& send_buffer,
+    const size_t local_max_spikes_per_rank );
+
+  /**
+   * Decode the encoded receive buffer into the receive buffer and set markers.
+   *
+   * Chunks are only decoded if the encoded chunks of all ranks fit into the encoded buffers.
+   *
+   * @returns largest size of an encoded chunk required by any rank
+   */
+  template < typename SpikeDataT >
+  size_t decode_spike_data_( const SendBufferPosition& send_buffer_position, std::vector< SpikeDataT >& recv_buffer );
+
+  /**
+   * Switch spike encoding off if it did not reduce the amount of data sent in the last slice, retry periodically,
+   * and shrink the encoded spike buffers.
+   */
+  void adapt_spike_data_encoding_();
+
+  void resize_encoded_spike_data_buffers_( const size_t chunk_size );
+
+  /**
+   * Append value to stream as variable-length integer with seven bits per byte.
+   *
+   * Bytes beyond capacity are counted, but not written.
+   */
+  static void write_varint_( size_t value, unsigned char* stream, const size_t capacity, size_t& num_bytes );
+
+  //! Read variable-length integer starting at pos and advance pos past it.
+  static size_t read_varint_( const unsigned char* stream, size_t& pos );
+
 
   /**
    * Reads spikes from MPI buffers and delivers them to ringbuffer of
@@ -320,12 +552,71 @@ private:
   template < typename SpikeDataT >
   void deliver_events_( const size_t tid, const std::vector< SpikeDataT >& recv_buffer );
 
+  /**
+   * Reads spikes from MPI buffers and delivers them in target order.
+   *
+   * In a first, thread-parallel pass, all received spikes are partitioned by
+   * target thread. Each thread then sorts its own spikes by synapse type, local
+   * connection id and lag and delivers them in the order in which connections
+   * are stored, prefetching connections ahead of delivery.
+   *
+   * @note Must be called by all threads, contains barriers.
+   */
+  template < typename SpikeDataT >
+  void deliver_events_target_sorted_( const size_t tid,
+    const std::vector< SpikeDataT >& recv_buffer,
+    std::vector< std::vector< std::vector< SpikeDataT > > >& partitioned_spike_data );
+
+  /**
+   * Count valid spikes received from each rank.
+   *
+   * Ranks are distributed round-robin across threads.
+   */
+  template < typename SpikeDataT >
+  void count_spikes_received_per_rank_( const size_t tid, const std::vector< SpikeDataT >& recv_buffer );
+
+  /**
+   * Find begin of the section for each target thread in each rank's chunk of the receive buffer.
+   *
+   * Requires that senders have sorted their chunks by target thread.
+   *
+   * @note Must be called by all threads, contains barriers.
+   */
+  template < typename SpikeDataT >
+  void find_spike_thread_sections_( const size_t tid, const std::vector< SpikeDataT >& recv_buffer );
+
   /**
    * Deletes all spikes from spike registers and resets spike
    * counters.
    */
   void reset_spike_register_( const size_t tid );
 
+  /**
+   * Size of the spike registers of one thread.
+   *
+   * The high-water mark follows increases immediately. Every SPIKE_REGISTER_DECAY_INTERVAL resets it
+   * moves halfway towards the largest size since the previous decay, so that a single burst does not
+   * fix the size of the registers for the rest of the simulation.
+   */
+  struct SpikeRegisterMark
+  {
+    size_t high_water_mark = 0;
+    size_t recent_max = 0; //!< largest register size since the last decay
+  };
+
+  /**
+   * Clear spike register and ensure that it can hold more spikes than its high-water mark without reallocation.
+   *
+   * Registers that are too small, or much larger than needed after the mark has decayed, are replaced by
+   * new registers allocated and first touched by the calling thread, so that they are placed in memory
+   * local to that thread. Spikes in the old register are not copied, since they have already been sent.
+   */
+  template < typename SpikeDataWithRankT >
+  void prepare_spike_register_( std::vector< SpikeDataWithRankT >& spike_register, SpikeRegisterMark& mark );
+
+  //! Move the high-water mark halfway towards recent usage and restart recording recent usage.
+  static void decay_spike_register_mark_( SpikeRegisterMark& mark );
+
   /**
    * Returns true if spike has been moved to MPI buffer, such that it
    * can be removed by clean_spike_register. Required static function
@@ -423,6 +714,33 @@ private:
    */
   std::vector< std::vector< OffGridSpikeDataWithRank >* > off_grid_emitted_spikes_register_;
 
+  /**
+   * Offsets at which each thread writes its spikes into each rank's chunk during parallel collocation.
+   *
+   * Structure: thread | on-grid spikes for each rank, off-grid spikes for each rank. Before the prefix sum,
+   * the entries hold the number of spikes in the thread's registers.
+   */
+  std::vector< std::vector< size_t > > spike_register_offsets_;
+
+  //! Number of spikes for each rank in all registers, computed during parallel collocation.
+  std::vector< size_t > num_collocated_spikes_per_rank_;
+
+  //! Whether the send buffer holds spikes collocated in parallel, which still need markers.
+  bool spike_data_collocated_;
+
+  //! Size of each thread's registers in slices and pipeline stages, see SpikeRegisterMark.
+  std::vector< SpikeRegisterMark > spike_register_mark_;
+  std::vector< SpikeRegisterMark > off_grid_spike_register_mark_;
+
+  //! Number of register resets of each thread since the marks last decayed.
+  std::vector< long > num_spike_register_resets_;
+
+  //! Capacity of spike registers beyond their high-water mark, as a fraction of the mark.
+  static constexpr double SPIKE_REGISTER_HEADROOM = 0.5;
+
+  //! Number of register resets, i.e., time slices or pipeline stages, between decays of the high-water marks.
+  static constexpr long SPIKE_REGISTER_DECAY_INTERVAL = 100;
+
   /**
    * Buffer to collect the secondary events after serialization.
    */
@@ -434,10 +752,48 @@ private:
    */
   std::vector< unsigned long > local_spike_counter_;
 
+  /**
+   * Number of target data sent by each thread during the last update of the connection infrastructure.
+   */
+  std::vector< unsigned long > local_target_data_counter_;
+
+  //! Spikes for devices by updating thread and thread of the sender, see send_staged_spikes_to_devices()
+  std::vector< std::vector< std::vector< SpikeEvent > > > staged_device_spikes_;
+
   std::vector< SpikeData > send_buffer_spike_data_;
   std::vector< SpikeData > recv_buffer_spike_data_;
   std::vector< OffGridSpikeData > send_buffer_off_grid_spike_data_;
   std::vector< OffGridSpikeData > recv_buffer_off_grid_spike_data_;
+  std::vector< CompactSpikeData > send_buffer_compact_spike_data_;
+  std::vector< CompactSpikeData > recv_buffer_compact_spike_data_;
+
+  bool compact_spike_data_;        //!< whether spikes may be exchanged as CompactSpikeData
+  bool compact_spike_data_active_; //!< whether spikes are exchanged as CompactSpikeData
+
+  //! Number of entries at the beginning of each rank's chunk of the encoded spike buffers.
+  static constexpr size_t ENCODED_CHUNK_HEADER_SIZE = 2;
+
+  //! Encoded chunks must hold the header, the chunk-end entry and at least one entry of spike data.
+  static constexpr size_t MIN_ENCODED_CHUNK_SIZE =
+    ENCODED_CHUNK_HEADER_SIZE + sizeof( SpikeData ) / sizeof( unsigned int ) + 1;
+
+  //! Number of time slices after which encoding is tried again once it has been switched off.
+  static constexpr long SPIKE_BUFFER_ENCODING_RETRY_INTERVAL = 100;
+
+  /**
+   * Buffers for spikes encoded as byte streams.
+   *
+   * Each rank's chunk contains the largest chunk size required by the sending rank for any rank, the number of
+   * spikes, the chunk-end entry of the spike buffer and the byte stream, see encode_spike_data_().
+   */
+  std::vector< unsigned int > send_buffer_encoded_spike_data_;
+  std::vector< unsigned int > recv_buffer_encoded_spike_data_;
+
+  bool spike_buffer_encoding_;           //!< whether spikes may be exchanged as encoded byte streams
+  bool spike_buffer_encoding_active_;    //!< whether spikes are exchanged as encoded byte streams
+  long num_slices_without_encoding_;     //!< number of slices since encoding was switched off
+  size_t encoded_chunk_size_;            //!< size of each rank's chunk of the encoded buffers in unsigned ints
+  size_t global_max_encoded_chunk_size_; //!< largest encoded chunk size required in the last slice
 
   std::vector< TargetData > send_buffer_target_data_;
   std::vector< TargetData > recv_buffer_target_data_;
@@ -446,7 +802,7 @@ private:
   bool buffer_size_target_data_has_changed_;
 
   /**
-   * Largest number of spikes sent from any rank to any other rank in last spike exchange round.
+   * Largest number of spikes sent from any rank to any other rank in any spike exchange round of the last slice.
    *
    * The spike buffer section for any rank must be at least this size. Therefore, this number controls
    * buffer resizing.
@@ -457,6 +813,18 @@ private:
   double send_recv_buffer_shrink_spare_; //!< leave this fraction more space than minimally needed
   double send_recv_buffer_grow_extra_;   //!< when growing, add this fraction extra space
 
+  bool send_recv_buffer_predictive_sizing_; //!< size buffers by moving average instead of last slice
+  double send_recv_buffer_ema_weight_;      //!< weight of the last slice in the moving average
+  double send_recv_buffer_headroom_;        //!< fraction of extra space above the moving average
+  long send_recv_buffer_resize_interval_;   //!< number of slices between predictive resizes
+
+  //! Exponential moving average of global_max_spikes_per_rank_ over slices, following increases immediately
+  double spike_buffer_ema_;
+  long num_slices_since_buffer_resize_;
+
+  long num_spike_exchange_rounds_;  //!< number of spike exchange rounds, including retransmissions
+  long num_spike_buffer_overflows_; //!< number of rounds after which spikes had to be retransmitted
+
   /**
    * Log all resize events.
    *
@@ -466,6 +834,82 @@ private:
 
   PerThreadBoolIndicator gather_completed_checker_;
 
+  //! Number of spikes read from a receive buffer chunk in one batch during delivery.
+  size_t spike_delivery_batch_size_;
+
+  //! Arrays into which a thread unpacks one batch of spikes before delivering them.
+  struct SpikeDeliveryBatch
+  {
+    std::vector< SpikeEvent > se;
+    std::vector< size_t > tid;
+    std::vector< size_t > syn_id;
+    std::vector< size_t > lcid;
+
+    void resize( const size_t batch_size );
+  };
+
+  //! Delivery batch per thread, sized to spike_delivery_batch_size_ whenever that changes.
+  std::vector< SpikeDeliveryBatch > spike_delivery_batches_;
+
+  //! Whether to partition received spikes by target thread and sort them before delivery.
+  bool sort_spikes_by_target_;
+
+  //! Whether spikes are sorted by target thread in each rank's chunk of the spike buffers.
+  bool spike_buffer_thread_sections_;
+
+  //! Number of valid spikes in each rank's chunk of the receive buffer, used by target-sorted delivery.
+  std::vector< size_t > num_spikes_received_per_rank_;
+
+  /**
+   * Begin of per-thread sections in each rank's chunk of the receive buffer.
+   *
+   * Entry rank * ( num_threads + 1 ) + t is the offset of the first spike for thread t within the chunk received
+   * from rank; entry rank * ( num_threads + 1 ) + num_threads is the number of spikes received from rank.
+   */
+  std::vector< size_t > spike_thread_section_begin_;
+
+  /**
+   * Received spikes partitioned by target thread for target-sorted delivery.
+   *
+   * Structure: writing thread | target thread | spikes. Each thread writes only into its own
+   * outermost entry, each thread reads only its target-thread entries.
+   */
+  std::vector< std::vector< std::vector< SpikeData > > > partitioned_spike_data_;
+  std::vector< std::vector< std::vector< OffGridSpikeData > > > partitioned_off_grid_spike_data_;
+  std::vector< std::vector< std::vector< CompactSpikeData > > > partitioned_compact_spike_data_;
+
+  //! Requested number of pipeline stages per time slice for the spike exchange.
+  long spike_exchange_pipeline_depth_;
+
+  size_t num_pipeline_stages_; //!< number of pipeline stages per time slice in use
+  long pipeline_stage_length_; //!< length of pipeline stages in steps, the last stage may be shorter
+
+  //! Number of pipeline stages whose exchange has been started in the current time slice.
+  size_t num_started_pipeline_stages_;
+
+  bool spike_data_exchange_pending_; //!< whether a non-blocking spike exchange is in flight
+
+  //! Largest number of spikes sent from this rank to any rank in the pending exchange.
+  size_t pending_local_max_spikes_per_rank_;
+
+  /**
+   * Receive buffers of all pipeline stages but the last, which uses the regular receive buffers.
+   *
+   * Spikes are delivered from these buffers at the beginning of the next time slice.
+   */
+  std::vector< std::vector< SpikeData > > pipelined_recv_buffer_spike_data_;
+  std::vector< std::vector< OffGridSpikeData > > pipelined_recv_buffer_off_grid_spike_data_;
+  std::vector< std::vector< CompactSpikeData > > pipelined_recv_buffer_compact_spike_data_;
+
+  /**
+   * Spikes emitted during all pipeline stages but the last.
+   *
+   * They are kept until delivery so that they can be retransmitted if they did not fit into the buffers.
+   * Structure: stage | thread | spikes, pointers as in emitted_spikes_register_.
+   */
+  std::vector< std::vector< std::vector< SpikeDataWithRank >* > > pipelined_emitted_spikes_register_;
+  std::vector< std::vector< std::vector< OffGridSpikeDataWithRank >* > > pipelined_off_grid_emitted_spikes_register_;
+
   // private stop watches for benchmarking purposes
   // (intended for internal core developers, not for use in the public API)
   Stopwatch< StopwatchGranularity::Detailed, StopwatchParallelism::MasterOnly > sw_collocate_spike_data_;
@@ -476,8 +920,55 @@ private:
 inline void
 EventDeliveryManager::reset_spike_register_( const size_t tid )
 {
-  emitted_spikes_register_[ tid ]->clear();
-  off_grid_emitted_spikes_register_[ tid ]->clear();
+  if ( ++num_spike_register_resets_[ tid ] >= SPIKE_REGISTER_DECAY_INTERVAL )
+  {
+    num_spike_register_resets_[ tid ] = 0;
+    decay_spike_register_mark_( spike_register_mark_[ tid ] );
+    decay_spike_register_mark_( off_grid_spike_register_mark_[ tid ] );
+  }
+
+  prepare_spike_register_( *emitted_spikes_register_[ tid ], spike_register_mark_[ tid ] );
+  prepare_spike_register_( *off_grid_emitted_spikes_register_[ tid ], off_grid_spike_register_mark_[ tid ] );
+
+  for ( auto& stage_register : pipelined_emitted_spikes_register_ )
+  {
+    prepare_spike_register_( *stage_register[ tid ], spike_register_mark_[ tid ] );
+  }
+  for ( auto& stage_register : pipelined_off_grid_emitted_spikes_register_ )
+  {
+    prepare_spike_register_( *stage_register[ tid ], off_grid_spike_register_mark_[ tid ] );
+  }
+}
+
+inline void
+EventDeliveryManager::decay_spike_register_mark_( SpikeRegisterMark& mark )
+{
+  assert( mark.recent_max <= mark.high_water_mark );
+  mark.high_water_mark = mark.recent_max + ( mark.high_water_mark - mark.recent_max ) / 2;
+  mark.recent_max = 0;
+}
+
+template < typename SpikeDataWithRankT >
+inline void
+EventDeliveryManager::prepare_spike_register_( std::vector< SpikeDataWithRankT >& spike_register,
+  SpikeRegisterMark& mark )
+{
+  mark.recent_max = std::max( mark.recent_max, spike_register.size() );
+  mark.high_water_mark = std::max( mark.high_water_mark, spike_register.size() );
+
+  // replace registers that are too small, or more than twice as large as needed
+  const size_t capacity = static_cast< size_t >( ( 1 + SPIKE_REGISTER_HEADROOM ) * mark.high_water_mark );
+  if ( spike_register.capacity() < capacity or spike_register.capacity() > 2 * capacity )
+  {
+    // Constructing all entries writes to the new memory from the calling thread
+    std::vector< SpikeDataWithRankT > new_register( capacity );
+    new_register.clear();
+    spike_register.swap( new_register );
+  }
+  else
+  {
+    spike_register.clear();
+  }
 }
 
 inline bool
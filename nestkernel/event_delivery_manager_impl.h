@@ -71,20 +71,31 @@ EventDeliveryManager::send< SpikeEvent >( Node& source, SpikeEvent& e, const lon
   e.set_sender_node_id( source_node_id );
   if ( source.has_proxies() )
   {
-    local_spike_counter_[ tid ] += e.get_multiplicity();
+    // with update stealing, the node may be updated by another thread than its own
+    const size_t executing_tid = kernel().vp_manager.get_thread_id();
+    local_spike_counter_[ executing_tid ] += e.get_multiplicity();
 
     e.set_stamp( kernel().simulation_manager.get_slice_origin() + Time::step( lag + 1 ) );
     e.set_sender( source );
 
     if ( source.is_off_grid() )
     {
-      send_off_grid_remote( tid, e, lag );
+      send_off_grid_remote( executing_tid, e, lag );
     }
     else
     {
-      send_remote( tid, e, lag );
+      send_remote( executing_tid, e, lag );
+    }
+
+    if ( executing_tid == tid )
+    {
+      kernel().connection_manager.send_to_devices( tid, source_node_id, e );
+    }
+    else
+    {
+      // recording devices are only accessed by their own thread, which sends these spikes after the update
+      staged_device_spikes_[ executing_tid ][ tid ].push_back( e );
     }
-    kernel().connection_manager.send_to_devices( tid, source_node_id, e );
   }
   else
   {
@@ -103,9 +114,9 @@ EventDeliveryManager::send< DSSpikeEvent >( Node& source, DSSpikeEvent& e, const
 inline void
 EventDeliveryManager::send_remote( size_t tid, SpikeEvent& e, const long lag )
 {
-  // Put the spike in a buffer for the remote machines
+  // Put the spike in a buffer for the remote machines; targets are stored with the thread of the sender
   const size_t lid = kernel().vp_manager.node_id_to_lid( e.get_sender().get_node_id() );
-  const auto& targets = kernel().connection_manager.get_remote_targets_of_local_node( tid, lid );
+  const auto targets = kernel().connection_manager.get_remote_targets_of_local_node( e.get_sender().get_thread(), lid );
 
   for ( const auto& target : targets )
   {
@@ -120,9 +131,9 @@ EventDeliveryManager::send_remote( size_t tid, SpikeEvent& e, const long lag )
 inline void
 EventDeliveryManager::send_off_grid_remote( size_t tid, SpikeEvent& e, const long lag )
 {
-  // Put the spike in a buffer for the remote machines
+  // Put the spike in a buffer for the remote machines; targets are stored with the thread of the sender
   const size_t lid = kernel().vp_manager.node_id_to_lid( e.get_sender().get_node_id() );
-  const auto& targets = kernel().connection_manager.get_remote_targets_of_local_node( tid, lid );
+  const auto targets = kernel().connection_manager.get_remote_targets_of_local_node( e.get_sender().get_thread(), lid );
 
   for ( const auto& target : targets )
   {
@@ -150,8 +161,7 @@ EventDeliveryManager::send_secondary( Node& source, SecondaryEvent& e )
     const std::set< synindex >& supported_syn_ids = e.get_supported_syn_ids();
     for ( const auto& syn_id : supported_syn_ids )
     {
-      const std::vector< size_t >& positions =
-        kernel().connection_manager.get_secondary_send_buffer_positions( tid, lid, syn_id );
+      const auto positions = kernel().connection_manager.get_secondary_send_buffer_positions( tid, lid, syn_id );
 
       for ( size_t i = 0; i < positions.size(); ++i )
       {
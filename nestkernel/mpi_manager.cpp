@@ -23,15 +23,19 @@
 #include "mpi_manager.h"
 
 // C++ includes:
+#include <algorithm>
 #include <cstdlib>
 
 // Includes from libnestutil:
+#include "compose.hpp"
 #include "stopwatch_impl.h"
 
 // Includes from nestkernel:
+#include "exceptions.h"
 #include "kernel_manager.h"
 #include "mpi_manager_impl.h"
 #include "nest_types.h"
+#include "vp_manager_impl.h"
 
 // Includes from sli:
 #include "dictutils.h"
@@ -66,11 +70,22 @@ nest::MPIManager::MPIManager()
   , shrink_factor_buffer_spike_data_( 1.1 )
   , send_recv_count_spike_data_per_rank_( 0 )
   , send_recv_count_target_data_per_rank_( 0 )
+  , neighbor_spike_exchange_( false )
+  , neighbor_spike_exchange_max_density_( 0.5 )
+  , neighbor_spike_exchange_active_( false )
+  , neighbor_spike_exchange_bytes_saved_( 0 )
+  , hierarchical_target_data_exchange_( false )
+  , hierarchical_target_data_exchange_group_size_( 0 )
+  , group_of_this_rank_( 0 )
 #ifdef HAVE_MPI
   , comm_step_( std::vector< int >() )
   , COMM_OVERFLOW_ERROR( std::numeric_limits< unsigned int >::max() )
   , comm( 0 )
   , MPI_OFFGRID_SPIKE( 0 )
+  , neighbor_comm_( MPI_COMM_NULL )
+  , group_comm_( MPI_COMM_NULL )
+  , group_leader_comm_( MPI_COMM_NULL )
+  , spike_data_request_( MPI_REQUEST_NULL )
 #endif
 {
 }
@@ -185,6 +200,12 @@ nest::MPIManager::initialize( const bool adjust_number_of_threads_or_rng_only )
     return;
   }
 
+  neighbor_spike_exchange_ = false;
+  neighbor_spike_exchange_max_density_ = 0.5;
+  neighbor_spike_exchange_bytes_saved_ = 0;
+  hierarchical_target_data_exchange_ = false;
+  hierarchical_target_data_exchange_group_size_ = 0;
+
 #ifndef HAVE_MPI
   char* pmix_rank_set = std::getenv( "PMIX_RANK" ); // set by OpenMPI's launcher
   char* pmi_rank_set = std::getenv( "PMI_RANK" );   // set by MPICH's launcher
@@ -218,6 +239,11 @@ nest::MPIManager::initialize( const bool adjust_number_of_threads_or_rng_only )
 void
 nest::MPIManager::finalize( const bool )
 {
+#ifdef HAVE_MPI
+  free_neighbor_communicator_();
+  free_hierarchical_communicators_();
+#endif
+  neighbor_spike_exchange_active_ = false;
 }
 
 void
@@ -246,6 +272,42 @@ nest::MPIManager::set_status( const DictionaryDatum& dict )
   updateValue< long >( dict, names::max_buffer_size_target_data, max_buffer_size_target_data_ );
 
   updateValue< double >( dict, names::shrink_factor_buffer_spike_data, shrink_factor_buffer_spike_data_ );
+
+  double new_max_density = neighbor_spike_exchange_max_density_;
+  updateValue< double >( dict, names::neighbor_spike_exchange_max_density, new_max_density );
+  if ( new_max_density < 0.0 or new_max_density > 1.0 )
+  {
+    throw BadProperty( "neighbor_spike_exchange_max_density must be in [0, 1]." );
+  }
+  neighbor_spike_exchange_max_density_ = new_max_density;
+
+  // The neighbourhood is set up during the next update of the connection infrastructure,
+  // but switching neighbourhood exchange off takes effect immediately.
+  updateValue< bool >( dict, names::neighbor_spike_exchange, neighbor_spike_exchange_ );
+  if ( not neighbor_spike_exchange_ and neighbor_spike_exchange_active_ )
+  {
+#ifdef HAVE_MPI
+    free_neighbor_communicator_();
+#endif
+    neighbor_spike_exchange_active_ = false;
+  }
+
+  long new_group_size = hierarchical_target_data_exchange_group_size_;
+  updateValue< long >( dict, names::hierarchical_target_data_exchange_group_size, new_group_size );
+  if ( new_group_size < 0 )
+  {
+    throw BadProperty( "hierarchical_target_data_exchange_group_size must be non-negative." );
+  }
+
+  // Groups are formed during the next exchange of target data, so changes only require discarding the current groups
+  updateValue< bool >( dict, names::hierarchical_target_data_exchange, hierarchical_target_data_exchange_ );
+  if ( not hierarchical_target_data_exchange_ or new_group_size != hierarchical_target_data_exchange_group_size_ )
+  {
+#ifdef HAVE_MPI
+    free_hierarchical_communicators_();
+#endif
+  }
+  hierarchical_target_data_exchange_group_size_ = new_group_size;
 }
 
 void
@@ -260,6 +322,14 @@ nest::MPIManager::get_status( DictionaryDatum& dict )
   def< size_t >( dict, names::max_buffer_size_target_data, max_buffer_size_target_data_ );
   def< double >( dict, names::growth_factor_buffer_spike_data, growth_factor_buffer_spike_data_ );
   def< double >( dict, names::growth_factor_buffer_target_data, growth_factor_buffer_target_data_ );
+  def< bool >( dict, names::neighbor_spike_exchange, neighbor_spike_exchange_ );
+  def< double >( dict, names::neighbor_spike_exchange_max_density, neighbor_spike_exchange_max_density_ );
+  def< bool >( dict, names::neighbor_spike_exchange_active, neighbor_spike_exchange_active_ );
+  def< size_t >( dict, names::neighbor_spike_exchange_bytes_saved, neighbor_spike_exchange_bytes_saved_ );
+  def< bool >( dict, names::hierarchical_target_data_exchange, hierarchical_target_data_exchange_ );
+  def< long >(
+    dict, names::hierarchical_target_data_exchange_group_size, hierarchical_target_data_exchange_group_size_ );
+  def< size_t >( dict, names::hierarchical_target_data_exchange_num_groups, ranks_of_group_.size() );
 }
 
 #ifdef HAVE_MPI
@@ -306,6 +376,12 @@ nest::MPIManager::mpi_abort( int exitcode )
   MPI_Abort( comm, exitcode );
 }
 
+size_t
+nest::MPIManager::get_process_id_of_node_id( const size_t node_id ) const
+{
+  return get_process_id_of_vp( kernel().vp_manager.node_id_to_vp( node_id ) );
+}
+
 
 std::string
 nest::MPIManager::get_processor_name()
@@ -746,6 +822,12 @@ nest::MPIManager::communicate_Allreduce_sum( std::vector< double >& send_buffer,
   MPI_Allreduce( &send_buffer[ 0 ], &recv_buffer[ 0 ], send_buffer.size(), MPI_Type< double >::type, MPI_SUM, comm );
 }
 
+void
+nest::MPIManager::communicate_Allreduce_max_in_place( std::vector< long >& buffer )
+{
+  MPI_Allreduce( MPI_IN_PLACE, &buffer[ 0 ], buffer.size(), MPI_Type< long >::type, MPI_MAX, comm );
+}
+
 bool
 nest::MPIManager::equal_cross_ranks( const double value )
 {
@@ -790,6 +872,340 @@ nest::MPIManager::communicate_Alltoallv_( void* send_buffer,
     comm );
 }
 
+void
+nest::MPIManager::set_neighbor_counts_and_displacements_( const unsigned int send_recv_count )
+{
+  assert( neighbor_spike_exchange_active_ );
+
+  // Chunks keep their position in the dense buffer layout, only the chunks for neighbours are transmitted
+  for ( size_t i = 0; i < neighbor_spike_targets_.size(); ++i )
+  {
+    neighbor_send_counts_[ i ] = send_recv_count;
+    neighbor_send_displacements_[ i ] = neighbor_spike_targets_[ i ] * send_recv_count;
+  }
+  for ( size_t i = 0; i < neighbor_spike_sources_.size(); ++i )
+  {
+    neighbor_recv_counts_[ i ] = send_recv_count;
+    neighbor_recv_displacements_[ i ] = neighbor_spike_sources_[ i ] * send_recv_count;
+  }
+
+  neighbor_spike_exchange_bytes_saved_ +=
+    ( get_num_processes() - neighbor_spike_targets_.size() ) * send_recv_count * sizeof( unsigned int );
+}
+
+void
+nest::MPIManager::communicate_Neighbor_alltoallv_( void* send_buffer,
+  void* recv_buffer,
+  const unsigned int send_recv_count )
+{
+  set_neighbor_counts_and_displacements_( send_recv_count );
+
+#if MPI_VERSION >= 3
+  MPI_Neighbor_alltoallv( send_buffer,
+    &neighbor_send_counts_[ 0 ],
+    &neighbor_send_displacements_[ 0 ],
+    MPI_UNSIGNED,
+    recv_buffer,
+    &neighbor_recv_counts_[ 0 ],
+    &neighbor_recv_displacements_[ 0 ],
+    MPI_UNSIGNED,
+    neighbor_comm_ );
+#endif
+}
+
+void
+nest::MPIManager::communicate_Ialltoall_( void* send_buffer, void* recv_buffer, const unsigned int send_recv_count )
+{
+  assert( spike_data_request_ == MPI_REQUEST_NULL );
+
+#if MPI_VERSION >= 3
+  MPI_Ialltoall( send_buffer,
+    send_recv_count,
+    MPI_UNSIGNED,
+    recv_buffer,
+    send_recv_count,
+    MPI_UNSIGNED,
+    comm,
+    &spike_data_request_ );
+#else
+  MPI_Alltoall( send_buffer, send_recv_count, MPI_UNSIGNED, recv_buffer, send_recv_count, MPI_UNSIGNED, comm );
+#endif
+}
+
+void
+nest::MPIManager::communicate_Ineighbor_alltoallv_( void* send_buffer,
+  void* recv_buffer,
+  const unsigned int send_recv_count )
+{
+  assert( spike_data_request_ == MPI_REQUEST_NULL );
+
+  // Counts and displacements must not be modified until the exchange is complete
+  set_neighbor_counts_and_displacements_( send_recv_count );
+
+#if MPI_VERSION >= 3
+  MPI_Ineighbor_alltoallv( send_buffer,
+    &neighbor_send_counts_[ 0 ],
+    &neighbor_send_displacements_[ 0 ],
+    MPI_UNSIGNED,
+    recv_buffer,
+    &neighbor_recv_counts_[ 0 ],
+    &neighbor_recv_displacements_[ 0 ],
+    MPI_UNSIGNED,
+    neighbor_comm_,
+    &spike_data_request_ );
+#endif
+}
+
+void
+nest::MPIManager::wait_spike_data_exchange()
+{
+  MPI_Wait( &spike_data_request_, MPI_STATUS_IGNORE );
+}
+
+void
+nest::MPIManager::configure_neighbor_spike_exchange( const std::vector< int >& is_spike_target_rank )
+{
+  free_neighbor_communicator_();
+  neighbor_spike_exchange_active_ = false;
+
+#if MPI_VERSION >= 3
+  if ( not neighbor_spike_exchange_ or get_num_processes() == 1 )
+  {
+    return;
+  }
+
+  // Rank r receives spikes from this rank if it is a target rank of this rank
+  std::vector< int > send_flags( is_spike_target_rank );
+  std::vector< int > is_spike_source_rank( get_num_processes(), 0 );
+  communicate_Alltoall( send_flags, is_spike_source_rank, 1 );
+
+  neighbor_spike_targets_.clear();
+  neighbor_spike_sources_.clear();
+  is_neighbor_spike_source_.assign( get_num_processes(), false );
+  for ( size_t rank = 0; rank < get_num_processes(); ++rank )
+  {
+    if ( is_spike_target_rank[ rank ] )
+    {
+      neighbor_spike_targets_.push_back( rank );
+    }
+    if ( is_spike_source_rank[ rank ] )
+    {
+      neighbor_spike_sources_.push_back( rank );
+      is_neighbor_spike_source_[ rank ] = true;
+    }
+  }
+
+  // Neighbourhood exchange only pays off if most pairs of ranks do not exchange spikes
+  std::vector< double > num_connected_rank_pairs( 1, neighbor_spike_targets_.size() );
+  communicate_Allreduce_sum_in_place( num_connected_rank_pairs );
+  const double num_rank_pairs = static_cast< double >( get_num_processes() ) * get_num_processes();
+  const double density = num_connected_rank_pairs[ 0 ] / num_rank_pairs;
+  if ( density > neighbor_spike_exchange_max_density_ )
+  {
+    LOG( M_INFO,
+      "MPIManager::configure_neighbor_spike_exchange",
+      String::compose( "Fraction of connected rank pairs is %1, using Alltoall for spike exchange.", density ) );
+    return;
+  }
+
+  // Avoid null pointers to empty vectors in calls to MPI
+  neighbor_send_counts_.resize( std::max( neighbor_spike_targets_.size(), 1UL ) );
+  neighbor_send_displacements_.resize( std::max( neighbor_spike_targets_.size(), 1UL ) );
+  neighbor_recv_counts_.resize( std::max( neighbor_spike_sources_.size(), 1UL ) );
+  neighbor_recv_displacements_.resize( std::max( neighbor_spike_sources_.size(), 1UL ) );
+
+  MPI_Dist_graph_create_adjacent( comm,
+    neighbor_spike_sources_.size(),
+    neighbor_spike_sources_.data(),
+    MPI_UNWEIGHTED,
+    neighbor_spike_targets_.size(),
+    neighbor_spike_targets_.data(),
+    MPI_UNWEIGHTED,
+    MPI_INFO_NULL,
+    false,
+    &neighbor_comm_ );
+
+  neighbor_spike_exchange_active_ = true;
+#else
+  if ( neighbor_spike_exchange_ )
+  {
+    LOG( M_WARNING,
+      "MPIManager::configure_neighbor_spike_exchange",
+      "MPI library does not support neighbourhood collectives, using Alltoall for spike exchange." );
+  }
+#endif
+}
+
+void
+nest::MPIManager::free_neighbor_communicator_()
+{
+  int finalized;
+  MPI_Finalized( &finalized );
+  if ( neighbor_comm_ != MPI_COMM_NULL and not finalized )
+  {
+    MPI_Comm_free( &neighbor_comm_ );
+  }
+  neighbor_comm_ = MPI_COMM_NULL;
+}
+
+void
+nest::MPIManager::configure_hierarchical_exchange_()
+{
+  free_hierarchical_communicators_();
+
+  if ( hierarchical_target_data_exchange_group_size_ > 0 )
+  {
+    const int group = get_rank() / hierarchical_target_data_exchange_group_size_;
+    MPI_Comm_split( comm, group, get_rank(), &group_comm_ );
+  }
+  else
+  {
+#if MPI_VERSION >= 3
+    MPI_Comm_split_type( comm, MPI_COMM_TYPE_SHARED, get_rank(), MPI_INFO_NULL, &group_comm_ );
+#else
+    LOG( M_WARNING,
+      "MPIManager::configure_hierarchical_exchange_",
+      "MPI library cannot determine ranks sharing memory, each rank forms its own group." );
+    MPI_Comm_split( comm, get_rank(), get_rank(), &group_comm_ );
+#endif
+  }
+
+  // The leader of each group is its member with the lowest rank, since members are ordered by their rank in comm
+  int rank_in_group;
+  MPI_Comm_rank( group_comm_, &rank_in_group );
+  MPI_Comm_split( comm, rank_in_group == 0 ? 0 : MPI_UNDEFINED, get_rank(), &group_leader_comm_ );
+
+  int leader = get_rank();
+  MPI_Bcast( &leader, 1, MPI_INT, 0, group_comm_ );
+  std::vector< int > leader_of_rank( get_num_processes() );
+  MPI_Allgather( &leader, 1, MPI_INT, &leader_of_rank[ 0 ], 1, MPI_INT, comm );
+
+  // Each leader precedes the other ranks of its group, so groups are numbered in order of their leaders
+  std::vector< size_t > group_of_leader( get_num_processes(), 0 );
+  for ( size_t rank = 0; rank < get_num_processes(); ++rank )
+  {
+    if ( leader_of_rank[ rank ] == static_cast< int >( rank ) )
+    {
+      group_of_leader[ rank ] = ranks_of_group_.size();
+      ranks_of_group_.emplace_back();
+    }
+    ranks_of_group_[ group_of_leader[ leader_of_rank[ rank ] ] ].push_back( rank );
+  }
+  group_of_this_rank_ = group_of_leader[ leader ];
+}
+
+void
+nest::MPIManager::free_hierarchical_communicators_()
+{
+  int finalized;
+  MPI_Finalized( &finalized );
+  if ( not finalized )
+  {
+    if ( group_comm_ != MPI_COMM_NULL )
+    {
+      MPI_Comm_free( &group_comm_ );
+    }
+    if ( group_leader_comm_ != MPI_COMM_NULL )
+    {
+      MPI_Comm_free( &group_leader_comm_ );
+    }
+  }
+  group_comm_ = MPI_COMM_NULL;
+  group_leader_comm_ = MPI_COMM_NULL;
+
+  ranks_of_group_.clear();
+  group_of_this_rank_ = 0;
+  std::vector< unsigned int >().swap( group_buffer_ );
+  std::vector< unsigned int >().swap( group_send_buffer_ );
+  std::vector< unsigned int >().swap( group_recv_buffer_ );
+}
+
+void
+nest::MPIManager::communicate_hierarchical_Alltoall_( void* send_buffer,
+  void* recv_buffer,
+  const unsigned int send_recv_count )
+{
+  if ( group_comm_ == MPI_COMM_NULL )
+  {
+    configure_hierarchical_exchange_();
+  }
+
+  const size_t buffer_size = send_recv_count * get_num_processes();
+  const size_t num_ranks_in_group = ranks_of_group_[ group_of_this_rank_ ].size();
+  const bool is_leader = group_leader_comm_ != MPI_COMM_NULL;
+
+  // Collect the send buffers of all ranks of the group on the leader
+  if ( is_leader )
+  {
+    group_buffer_.resize( num_ranks_in_group * buffer_size );
+  }
+  MPI_Gather(
+    send_buffer, buffer_size, MPI_UNSIGNED, group_buffer_.data(), buffer_size, MPI_UNSIGNED, 0, group_comm_ );
+
+  if ( is_leader )
+  {
+    const size_t num_groups = ranks_of_group_.size();
+    std::vector< int > send_counts( num_groups );
+    std::vector< int > send_displacements( num_groups );
+    std::vector< int > recv_counts( num_groups );
+    std::vector< int > recv_displacements( num_groups );
+
+    // Arrange the chunks for each group by source rank in this group and by target rank in the target group
+    group_send_buffer_.resize( group_buffer_.size() );
+    size_t send_pos = 0;
+    size_t recv_pos = 0;
+    for ( size_t group = 0; group < num_groups; ++group )
+    {
+      send_displacements[ group ] = send_pos;
+      for ( size_t source = 0; source < num_ranks_in_group; ++source )
+      {
+        for ( const int target_rank : ranks_of_group_[ group ] )
+        {
+          const auto chunk = group_buffer_.begin() + source * buffer_size + target_rank * send_recv_count;
+          std::copy( chunk, chunk + send_recv_count, group_send_buffer_.begin() + send_pos );
+          send_pos += send_recv_count;
+        }
+      }
+      send_counts[ group ] = send_pos - send_displacements[ group ];
+
+      recv_displacements[ group ] = recv_pos;
+      recv_counts[ group ] = ranks_of_group_[ group ].size() * num_ranks_in_group * send_recv_count;
+      recv_pos += recv_counts[ group ];
+    }
+
+    group_recv_buffer_.resize( recv_pos );
+    MPI_Alltoallv( group_send_buffer_.data(),
+      &send_counts[ 0 ],
+      &send_displacements[ 0 ],
+      MPI_UNSIGNED,
+      group_recv_buffer_.data(),
+      &recv_counts[ 0 ],
+      &recv_displacements[ 0 ],
+      MPI_UNSIGNED,
+      group_leader_comm_ );
+
+    // Place the chunks in the receive buffers of the ranks of this group, ordered by source rank
+    recv_pos = 0;
+    for ( size_t group = 0; group < num_groups; ++group )
+    {
+      for ( const int source_rank : ranks_of_group_[ group ] )
+      {
+        for ( size_t target = 0; target < num_ranks_in_group; ++target )
+        {
+          const auto chunk = group_recv_buffer_.begin() + recv_pos;
+          std::copy( chunk,
+            chunk + send_recv_count,
+            group_buffer_.begin() + target * buffer_size + source_rank * send_recv_count );
+          recv_pos += send_recv_count;
+        }
+      }
+    }
+  }
+
+  MPI_Scatter(
+    group_buffer_.data(), buffer_size, MPI_UNSIGNED, recv_buffer, buffer_size, MPI_UNSIGNED, 0, group_comm_ );
+}
+
 void
 nest::MPIManager::communicate_recv_counts_secondary_events()
 {
@@ -1092,6 +1508,23 @@ nest::MPIManager::communicate_Allreduce_sum( std::vector< double >& send_buffer,
   recv_buffer.swap( send_buffer );
 }
 
+void
+nest::MPIManager::communicate_Allreduce_max_in_place( std::vector< long >& )
+{
+}
+
+void
+nest::MPIManager::wait_spike_data_exchange()
+{
+}
+
+void
+nest::MPIManager::configure_neighbor_spike_exchange( const std::vector< int >& )
+{
+  // with a single process, spikes are never exchanged with other ranks
+  neighbor_spike_exchange_active_ = false;
+}
+
 bool
 nest::MPIManager::equal_cross_ranks( const double )
 {
@@ -159,6 +159,9 @@ public:
   void communicate_Allreduce_sum_in_place( std::vector< int >& buffer );
   void communicate_Allreduce_sum( std::vector< double >& send_buffer, std::vector< double >& recv_buffer );
 
+  //! Maximum across all ranks
+  void communicate_Allreduce_max_in_place( std::vector< long >& buffer );
+
   /**
    * Equal across all ranks.
    *
@@ -213,6 +216,14 @@ public:
     const int* recv_counts,
     const int* recv_displacements );
 
+  void communicate_Neighbor_alltoallv_( void* send_buffer, void* recv_buffer, const unsigned int send_recv_count );
+
+  void communicate_Ialltoall_( void* send_buffer, void* recv_buffer, const unsigned int send_recv_count );
+
+  void communicate_Ineighbor_alltoallv_( void* send_buffer, void* recv_buffer, const unsigned int send_recv_count );
+
+  void communicate_hierarchical_Alltoall_( void* send_buffer, void* recv_buffer, const unsigned int send_recv_count );
+
 #endif /* HAVE_MPI */
 
   template < class D >
@@ -228,6 +239,115 @@ public:
   template < class D >
   void communicate_secondary_events_Alltoallv( std::vector< D >& send_buffer, std::vector< D >& recv_buffer );
 
+  /**
+   * Exchange different amounts of data between all ranks.
+   *
+   * The first send_counts[ 0 ] elements of send_buffer are sent to rank 0, the following
+   * send_counts[ 1 ] elements to rank 1, and so on. recv_buffer is resized to hold all
+   * received elements, ordered by the sending rank.
+   */
+  template < class D >
+  void communicate_Alltoallv( std::vector< D >& send_buffer,
+    const std::vector< int >& send_counts,
+    std::vector< D >& recv_buffer );
+
+  /**
+   * Exchange spike data only with neighbouring ranks.
+   *
+   * Uses the same buffer layout as the Alltoall variants, but only the
+   * chunks for ranks this rank sends spikes to are transmitted and only
+   * the chunks from ranks this rank receives spikes from are written.
+   * Must only be called if neighbor_spike_exchange_active() is true.
+   */
+  template < class D >
+  void communicate_Neighbor_alltoallv( std::vector< D >& send_buffer,
+    std::vector< D >& recv_buffer,
+    const unsigned int send_recv_count );
+  template < class D >
+  void communicate_spike_data_Neighbor_alltoallv( std::vector< D >& send_buffer, std::vector< D >& recv_buffer );
+  template < class D >
+  void communicate_off_grid_spike_data_Neighbor_alltoallv( std::vector< D >& send_buffer,
+    std::vector< D >& recv_buffer );
+
+  /**
+   * Exchange data between all ranks in two levels.
+   *
+   * Uses the same buffer layout as communicate_Alltoall(). The ranks of each
+   * group, by default the ranks sharing memory on a compute node, first gather
+   * their send buffers on the group leader, the member of the group with the
+   * lowest rank. Only the leaders exchange data between groups, before they
+   * scatter the received data to the ranks of their group. This replaces
+   * messages between all pairs of ranks by messages between pairs of groups.
+   */
+  template < class D >
+  void communicate_hierarchical_Alltoall( std::vector< D >& send_buffer,
+    std::vector< D >& recv_buffer,
+    const unsigned int send_recv_count );
+
+  /**
+   * Start a non-blocking exchange of spike data.
+   *
+   * The Ialltoall variants use the same buffer layout as the Alltoall variants,
+   * the Ineighbor_alltoallv variants the same as the Neighbor_alltoallv variants.
+   * Neither buffer may be accessed before wait_spike_data_exchange() has returned
+   * and only one exchange may be pending at any time. If the MPI library does not
+   * support non-blocking collectives, the exchange is completed immediately.
+   */
+  template < class D >
+  void communicate_Ialltoall( std::vector< D >& send_buffer,
+    std::vector< D >& recv_buffer,
+    const unsigned int send_recv_count );
+  template < class D >
+  void communicate_spike_data_Ialltoall( std::vector< D >& send_buffer, std::vector< D >& recv_buffer );
+  template < class D >
+  void communicate_off_grid_spike_data_Ialltoall( std::vector< D >& send_buffer, std::vector< D >& recv_buffer );
+  template < class D >
+  void communicate_Ineighbor_alltoallv( std::vector< D >& send_buffer,
+    std::vector< D >& recv_buffer,
+    const unsigned int send_recv_count );
+  template < class D >
+  void communicate_spike_data_Ineighbor_alltoallv( std::vector< D >& send_buffer, std::vector< D >& recv_buffer );
+  template < class D >
+  void communicate_off_grid_spike_data_Ineighbor_alltoallv( std::vector< D >& send_buffer,
+    std::vector< D >& recv_buffer );
+
+  /**
+   * Wait until the pending non-blocking exchange of spike data is complete.
+   *
+   * Returns immediately if no exchange is pending.
+   */
+  void wait_spike_data_exchange();
+
+  /**
+   * Set up the neighbourhood for the exchange of spikes.
+   *
+   * Determines the ranks this rank receives spikes from and creates a
+   * distributed graph communicator connecting each rank to the ranks it
+   * exchanges spikes with. Falls back to the dense Alltoall if
+   * neighbor_spike_exchange is false, the MPI library does not support
+   * neighbourhood collectives or the fraction of connected rank pairs
+   * exceeds neighbor_spike_exchange_max_density.
+   *
+   * @param is_spike_target_rank 1 for each rank this rank sends spikes to, 0 otherwise
+   */
+  void configure_neighbor_spike_exchange( const std::vector< int >& is_spike_target_rank );
+
+  /**
+   * Returns whether neighbourhood exchange of spikes was requested.
+   */
+  bool get_neighbor_spike_exchange() const;
+
+  /**
+   * Returns whether spikes are exchanged using the neighbourhood collective.
+   */
+  bool neighbor_spike_exchange_active() const;
+
+  /**
+   * Returns whether this rank receives spikes from `source_rank` in
+   * neighbourhood exchange.
+   */
+  bool is_neighbor_spike_source( const size_t source_rank ) const;
+
   /**
    * Ensure all processes have reached the same stage by waiting until all
    * processes have sent a dummy message to process 0.
@@ -343,6 +463,45 @@ private:
   //! Offset in the MPI send buffer (in ints) from which elements send to each rank will be read
   std::vector< int > send_displacements_secondary_events_in_int_per_rank_;
 
+  bool neighbor_spike_exchange_; //!< whether spikes should only be exchanged with neighbouring ranks
+
+  //! Fraction of connected rank pairs above which spikes are exchanged with Alltoall
+  double neighbor_spike_exchange_max_density_;
+
+  bool neighbor_spike_exchange_active_; //!< whether the neighbourhood communicator is used
+
+  //! Number of bytes not sent in neighbourhood exchange compared to Alltoall
+  size_t neighbor_spike_exchange_bytes_saved_;
+
+  std::vector< int > neighbor_spike_sources_; //!< ranks this rank receives spikes from
+  std::vector< int > neighbor_spike_targets_; //!< ranks this rank sends spikes to
+
+  //! Flag for each rank whether it is contained in neighbor_spike_sources_
+  std::vector< bool > is_neighbor_spike_source_;
+
+  //! Counts and displacements (in ints) for neighbourhood exchange, in order of neighbours
+  std::vector< int > neighbor_send_counts_;
+  std::vector< int > neighbor_send_displacements_;
+  std::vector< int > neighbor_recv_counts_;
+  std::vector< int > neighbor_recv_displacements_;
+
+  //! Whether target data are exchanged in two levels, see communicate_hierarchical_Alltoall()
+  bool hierarchical_target_data_exchange_;
+
+  //! Number of consecutive ranks per group in hierarchical exchange, 0 to group ranks by shared memory
+  long hierarchical_target_data_exchange_group_size_;
+
+  //! Global ranks of the ranks in each group, groups in order of their leaders
+  std::vector< std::vector< int > > ranks_of_group_;
+
+  //! Index of the group of this rank in ranks_of_group_
+  size_t group_of_this_rank_;
+
+  //! Buffers of the group leader for the data of all ranks in the group and for the exchange between groups
+  std::vector< unsigned int > group_buffer_;
+  std::vector< unsigned int > group_send_buffer_;
+  std::vector< unsigned int > group_recv_buffer_;
+
 #ifdef HAVE_MPI
 
   std::vector< int > comm_step_;
@@ -354,6 +513,33 @@ private:
   MPI_Comm comm;
   MPI_Datatype MPI_OFFGRID_SPIKE;
 
+  //! Distributed graph communicator for neighbourhood exchange of spikes
+  MPI_Comm neighbor_comm_;
+
+  //! Communicator of the ranks in the group of this rank for hierarchical exchange
+  MPI_Comm group_comm_;
+
+  //! Communicator of the group leaders for hierarchical exchange, MPI_COMM_NULL on other ranks
+  MPI_Comm group_leader_comm_;
+
+  //! Request of the pending non-blocking spike data exchange
+  MPI_Request spike_data_request_;
+
+  void free_neighbor_communicator_();
+
+  /**
+   * Split the ranks into groups for hierarchical exchange and determine
+   * the ranks of all groups. Must be called on all ranks.
+   */
+  void configure_hierarchical_exchange_();
+
+  void free_hierarchical_communicators_();
+
+  /**
+   * Set counts and displacements of the chunks exchanged with neighbours.
+   */
+  void set_neighbor_counts_and_displacements_( const unsigned int send_recv_count );
+
   void communicate_Allgather( std::vector< unsigned int >& send_buffer,
     std::vector< unsigned int >& recv_buffer,
     std::vector< int >& displacements );
@@ -608,6 +794,24 @@ MPIManager::adaptive_target_buffers() const
   return adaptive_target_buffers_;
 }
 
+inline bool
+MPIManager::get_neighbor_spike_exchange() const
+{
+  return neighbor_spike_exchange_;
+}
+
+inline bool
+MPIManager::neighbor_spike_exchange_active() const
+{
+  return neighbor_spike_exchange_active_;
+}
+
+inline bool
+MPIManager::is_neighbor_spike_source( const size_t source_rank ) const
+{
+  return is_neighbor_spike_source_[ source_rank ];
+}
+
 #ifndef HAVE_MPI
 inline std::string
 MPIManager::get_processor_name()
@@ -714,6 +918,90 @@ MPIManager::communicate_secondary_events_Alltoallv( std::vector< D >& send_buffe
     &recv_displacements_secondary_events_in_int_per_rank_[ 0 ] );
 }
 
+template < class D >
+void
+MPIManager::communicate_Alltoallv( std::vector< D >& send_buffer,
+  const std::vector< int >& send_counts,
+  std::vector< D >& recv_buffer )
+{
+  static_assert(
+    sizeof( D ) % sizeof( unsigned int ) == 0, "Size of elements must be a multiple of sizeof( unsigned int )" );
+  const int ints_per_element = sizeof( D ) / sizeof( unsigned int );
+
+  std::vector< int > send_counts_in_int( get_num_processes() );
+  std::vector< int > recv_counts_in_int( get_num_processes() );
+  std::vector< int > send_displacements_in_int( get_num_processes(), 0 );
+  std::vector< int > recv_displacements_in_int( get_num_processes(), 0 );
+
+  for ( size_t rank = 0; rank < get_num_processes(); ++rank )
+  {
+    send_counts_in_int[ rank ] = send_counts[ rank ] * ints_per_element;
+  }
+  communicate_Alltoall_( &send_counts_in_int[ 0 ], &recv_counts_in_int[ 0 ], 1 );
+
+  for ( size_t rank = 1; rank < get_num_processes(); ++rank )
+  {
+    send_displacements_in_int[ rank ] = send_displacements_in_int[ rank - 1 ] + send_counts_in_int[ rank - 1 ];
+    recv_displacements_in_int[ rank ] = recv_displacements_in_int[ rank - 1 ] + recv_counts_in_int[ rank - 1 ];
+  }
+  recv_buffer.resize( ( recv_displacements_in_int.back() + recv_counts_in_int.back() ) / ints_per_element );
+
+  communicate_Alltoallv_( send_buffer.data(),
+    &send_counts_in_int[ 0 ],
+    &send_displacements_in_int[ 0 ],
+    recv_buffer.data(),
+    &recv_counts_in_int[ 0 ],
+    &recv_displacements_in_int[ 0 ] );
+}
+
+template < class D >
+void
+MPIManager::communicate_Neighbor_alltoallv( std::vector< D >& send_buffer,
+  std::vector< D >& recv_buffer,
+  const unsigned int send_recv_count )
+{
+  void* send_buffer_int = static_cast< void* >( &send_buffer[ 0 ] );
+  void* recv_buffer_int = static_cast< void* >( &recv_buffer[ 0 ] );
+
+  communicate_Neighbor_alltoallv_( send_buffer_int, recv_buffer_int, send_recv_count );
+}
+
+template < class D >
+void
+MPIManager::communicate_Ialltoall( std::vector< D >& send_buffer,
+  std::vector< D >& recv_buffer,
+  const unsigned int send_recv_count )
+{
+  void* send_buffer_int = static_cast< void* >( &send_buffer[ 0 ] );
+  void* recv_buffer_int = static_cast< void* >( &recv_buffer[ 0 ] );
+
+  communicate_Ialltoall_( send_buffer_int, recv_buffer_int, send_recv_count );
+}
+
+template < class D >
+void
+MPIManager::communicate_Ineighbor_alltoallv( std::vector< D >& send_buffer,
+  std::vector< D >& recv_buffer,
+  const unsigned int send_recv_count )
+{
+  void* send_buffer_int = static_cast< void* >( &send_buffer[ 0 ] );
+  void* recv_buffer_int = static_cast< void* >( &recv_buffer[ 0 ] );
+
+  communicate_Ineighbor_alltoallv_( send_buffer_int, recv_buffer_int, send_recv_count );
+}
+
+template < class D >
+void
+MPIManager::communicate_hierarchical_Alltoall( std::vector< D >& send_buffer,
+  std::vector< D >& recv_buffer,
+  const unsigned int send_recv_count )
+{
+  void* send_buffer_int = static_cast< void* >( &send_buffer[ 0 ] );
+  void* recv_buffer_int = static_cast< void* >( &recv_buffer[ 0 ] );
+
+  communicate_hierarchical_Alltoall_( send_buffer_int, recv_buffer_int, send_recv_count );
+}
+
 #else // HAVE_MPI
 template < class D >
 void
@@ -731,6 +1019,49 @@ MPIManager::communicate_secondary_events_Alltoallv( std::vector< D >& send_buffe
   recv_buffer.swap( send_buffer );
 }
 
+template < class D >
+void
+MPIManager::communicate_Alltoallv( std::vector< D >& send_buffer,
+  const std::vector< int >&,
+  std::vector< D >& recv_buffer )
+{
+  recv_buffer.swap( send_buffer );
+}
+
+template < class D >
+void
+MPIManager::communicate_Neighbor_alltoallv( std::vector< D >& send_buffer,
+  std::vector< D >& recv_buffer,
+  const unsigned int )
+{
+  recv_buffer.swap( send_buffer );
+}
+
+template < class D >
+void
+MPIManager::communicate_Ialltoall( std::vector< D >& send_buffer, std::vector< D >& recv_buffer, const unsigned int )
+{
+  recv_buffer.swap( send_buffer );
+}
+
+template < class D >
+void
+MPIManager::communicate_Ineighbor_alltoallv( std::vector< D >& send_buffer,
+  std::vector< D >& recv_buffer,
+  const unsigned int )
+{
+  recv_buffer.swap( send_buffer );
+}
+
+template < class D >
+void
+MPIManager::communicate_hierarchical_Alltoall( std::vector< D >& send_buffer,
+  std::vector< D >& recv_buffer,
+  const unsigned int )
+{
+  recv_buffer.swap( send_buffer );
+}
+
 #endif /* HAVE_MPI */
 
 template < class D >
@@ -740,7 +1071,14 @@ MPIManager::communicate_target_data_Alltoall( std::vector< D >& send_buffer, std
   const size_t send_recv_count_target_data_in_int_per_rank =
     sizeof( TargetData ) / sizeof( unsigned int ) * send_recv_count_target_data_per_rank_;
 
-  communicate_Alltoall( send_buffer, recv_buffer, send_recv_count_target_data_in_int_per_rank );
+  if ( hierarchical_target_data_exchange_ and get_num_processes() > 1 )
+  {
+    communicate_hierarchical_Alltoall( send_buffer, recv_buffer, send_recv_count_target_data_in_int_per_rank );
+  }
+  else
+  {
+    communicate_Alltoall( send_buffer, recv_buffer, send_recv_count_target_data_in_int_per_rank );
+  }
 }
 
 template < class D >
@@ -748,7 +1086,7 @@ void
 MPIManager::communicate_spike_data_Alltoall( std::vector< D >& send_buffer, std::vector< D >& recv_buffer )
 {
   const size_t send_recv_count_spike_data_in_int_per_rank =
-    sizeof( SpikeData ) / sizeof( unsigned int ) * send_recv_count_spike_data_per_rank_;
+    sizeof( D ) / sizeof( unsigned int ) * send_recv_count_spike_data_per_rank_;
 
   communicate_Alltoall( send_buffer, recv_buffer, send_recv_count_spike_data_in_int_per_rank );
 }
@@ -762,6 +1100,68 @@ MPIManager::communicate_off_grid_spike_data_Alltoall( std::vector< D >& send_buf
 
   communicate_Alltoall( send_buffer, recv_buffer, send_recv_count_off_grid_spike_data_in_int_per_rank );
 }
+
+template < class D >
+void
+MPIManager::communicate_spike_data_Neighbor_alltoallv( std::vector< D >& send_buffer, std::vector< D >& recv_buffer )
+{
+  const size_t send_recv_count_spike_data_in_int_per_rank =
+    sizeof( D ) / sizeof( unsigned int ) * send_recv_count_spike_data_per_rank_;
+
+  communicate_Neighbor_alltoallv( send_buffer, recv_buffer, send_recv_count_spike_data_in_int_per_rank );
+}
+
+template < class D >
+void
+MPIManager::communicate_off_grid_spike_data_Neighbor_alltoallv( std::vector< D >& send_buffer,
+  std::vector< D >& recv_buffer )
+{
+  const size_t send_recv_count_off_grid_spike_data_in_int_per_rank =
+    sizeof( OffGridSpikeData ) / sizeof( unsigned int ) * send_recv_count_spike_data_per_rank_;
+
+  communicate_Neighbor_alltoallv( send_buffer, recv_buffer, send_recv_count_off_grid_spike_data_in_int_per_rank );
+}
+
+template < class D >
+void
+MPIManager::communicate_spike_data_Ialltoall( std::vector< D >& send_buffer, std::vector< D >& recv_buffer )
+{
+  const size_t send_recv_count_spike_data_in_int_per_rank =
+    sizeof( D ) / sizeof( unsigned int ) * send_recv_count_spike_data_per_rank_;
+
+  communicate_Ialltoall( send_buffer, recv_buffer, send_recv_count_spike_data_in_int_per_rank );
+}
+
+template < class D >
+void
+MPIManager::communicate_off_grid_spike_data_Ialltoall( std::vector< D >& send_buffer, std::vector< D >& recv_buffer )
+{
+  const size_t send_recv_count_off_grid_spike_data_in_int_per_rank =
+    sizeof( OffGridSpikeData ) / sizeof( unsigned int ) * send_recv_count_spike_data_per_rank_;
+
+  communicate_Ialltoall( send_buffer, recv_buffer, send_recv_count_off_grid_spike_data_in_int_per_rank );
+}
+
+template < class D >
+void
+MPIManager::communicate_spike_data_Ineighbor_alltoallv( std::vector< D >& send_buffer, std::vector< D >& recv_buffer )
+{
+  const size_t send_recv_count_spike_data_in_int_per_rank =
+    sizeof( D ) / sizeof( unsigned int ) * send_recv_count_spike_data_per_rank_;
+
+  communicate_Ineighbor_alltoallv( send_buffer, recv_buffer, send_recv_count_spike_data_in_int_per_rank );
+}
+
+template < class D >
+void
+MPIManager::communicate_off_grid_spike_data_Ineighbor_alltoallv( std::vector< D >& send_buffer,
+  std::vector< D >& recv_buffer )
+{
+  const size_t send_recv_count_off_grid_spike_data_in_int_per_rank =
+    sizeof( OffGridSpikeData ) / sizeof( unsigned int ) * send_recv_count_spike_data_per_rank_;
+
+  communicate_Ineighbor_alltoallv( send_buffer, recv_buffer, send_recv_count_off_grid_spike_data_in_int_per_rank );
+}
 }
 
 #endif /* MPI_MANAGER_H */
@@ -74,12 +74,6 @@ nest::MPIManager::communicate_Allgatherv( std::vector< T >& send_buffer,
     comm );
 }
 
-inline size_t
-nest::MPIManager::get_process_id_of_node_id( const size_t node_id ) const
-{
-  return node_id % kernel().vp_manager.get_num_virtual_processes() % num_processes_;
-}
-
 #else // HAVE_MPI
 
 
@@ -103,8 +103,11 @@ const Name center( "center" );
 const Name circular( "circular" );
 const Name clear( "clear" );
 const Name comp_idx( "comp_idx" );
+const Name compact_spike_data( "compact_spike_data" );
+const Name compact_spike_data_active( "compact_spike_data_active" );
 const Name comparator( "comparator" );
 const Name compartments( "compartments" );
+const Name compress_source_table( "compress_source_table" );
 const Name conc_Mg2( "conc_Mg2" );
 const Name configbit_0( "configbit_0" );
 const Name configbit_1( "configbit_1" );
@@ -246,6 +249,9 @@ const Name h( "h" );
 const Name h_IP3R( "h_IP3R" );
 const Name has_connections( "has_connections" );
 const Name has_delay( "has_delay" );
+const Name hierarchical_target_data_exchange( "hierarchical_target_data_exchange" );
+const Name hierarchical_target_data_exchange_group_size( "hierarchical_target_data_exchange_group_size" );
+const Name hierarchical_target_data_exchange_num_groups( "hierarchical_target_data_exchange_num_groups" );
 const Name histogram( "histogram" );
 const Name histogram_correction( "histogram_correction" );
 
@@ -269,6 +275,7 @@ const Name Inact_h( "Inact_h" );
 const Name Inact_p( "Inact_p" );
 const Name IP3( "IP3" );
 const Name IP3_0( "IP3_0" );
+const Name incremental_connection_update( "incremental_connection_update" );
 const Name indegree( "indegree" );
 const Name index_map( "index_map" );
 const Name individual_spike_trains( "individual_spike_trains" );
@@ -302,6 +309,7 @@ const Name linear_summation( "linear_summation" );
 const Name local( "local" );
 const Name local_num_threads( "local_num_threads" );
 const Name local_spike_counter( "local_spike_counter" );
+const Name local_target_data_counter( "local_target_data_counter" );
 const Name lookuptable_0( "lookuptable_0" );
 const Name lookuptable_1( "lookuptable_1" );
 const Name lookuptable_2( "lookuptable_2" );
@@ -327,6 +335,7 @@ const Name min_update_time( "min_update_time" );
 const Name minor_axis( "minor_axis" );
 const Name model( "model" );
 const Name model_id( "model_id" );
+const Name model_update_costs( "model_update_costs" );
 const Name modules( "modules" );
 const Name mpi_address( "mpi_address" );
 const Name ms_per_tic( "ms_per_tic" );
@@ -347,6 +356,10 @@ const Name n_messages( "n_messages" );
 const Name n_proc( "n_proc" );
 const Name n_receptors( "n_receptors" );
 const Name n_synapses( "n_synapses" );
+const Name neighbor_spike_exchange( "neighbor_spike_exchange" );
+const Name neighbor_spike_exchange_active( "neighbor_spike_exchange_active" );
+const Name neighbor_spike_exchange_bytes_saved( "neighbor_spike_exchange_bytes_saved" );
+const Name neighbor_spike_exchange_max_density( "neighbor_spike_exchange_max_density" );
 const Name network_size( "network_size" );
 const Name neuron( "neuron" );
 const Name next_readout_time( "next_readout_time" );
@@ -413,6 +426,7 @@ const Name q_sfa( "q_sfa" );
 const Name q_stc( "q_stc" );
 
 const Name radius( "radius" );
+const Name radix_sort_connections( "radix_sort_connections" );
 const Name rate( "rate" );
 const Name rate_IP3R( "rate_IP3R" );
 const Name rate_L( "rate_L" );
@@ -473,13 +487,25 @@ const Name size_of( "sizeof" );
 const Name soma_curr( "soma_curr" );
 const Name soma_exc( "soma_exc" );
 const Name soma_inh( "soma_inh" );
+const Name sort_spikes_by_target( "sort_spikes_by_target" );
 const Name source( "source" );
 const Name spherical( "spherical" );
+const Name spike_buffer_ema_weight( "spike_buffer_ema_weight" );
+const Name spike_buffer_encoding( "spike_buffer_encoding" );
+const Name spike_buffer_encoding_active( "spike_buffer_encoding_active" );
 const Name spike_buffer_grow_extra( "spike_buffer_grow_extra" );
+const Name spike_buffer_headroom( "spike_buffer_headroom" );
+const Name spike_buffer_overflows( "spike_buffer_overflows" );
+const Name spike_buffer_predictive_sizing( "spike_buffer_predictive_sizing" );
+const Name spike_buffer_resize_interval( "spike_buffer_resize_interval" );
 const Name spike_buffer_resize_log( "spike_buffer_resize_log" );
 const Name spike_buffer_shrink_limit( "spike_buffer_shrink_limit" );
 const Name spike_buffer_shrink_spare( "spike_buffer_shrink_spare" );
+const Name spike_buffer_thread_sections( "spike_buffer_thread_sections" );
+const Name spike_delivery_batch_size( "spike_delivery_batch_size" );
 const Name spike_dependent_threshold( "spike_dependent_threshold" );
+const Name spike_exchange_pipeline_depth( "spike_exchange_pipeline_depth" );
+const Name spike_exchange_rounds( "spike_exchange_rounds" );
 const Name spike_multiplicities( "spike_multiplicities" );
 const Name spike_times( "spike_times" );
 const Name spike_weights( "spike_weights" );
@@ -490,6 +516,7 @@ const Name std_mod( "std_mod" );
 const Name stimulation_backends( "stimulation_backends" );
 const Name stimulator( "stimulator" );
 const Name stimulus_source( "stimulus_source" );
+const Name stolen_update_chunks( "stolen_update_chunks" );
 const Name stop( "stop" );
 const Name structural_plasticity_synapses( "structural_plasticity_synapses" );
 const Name structural_plasticity_update_interval( "structural_plasticity_update_interval" );
@@ -633,6 +660,8 @@ const Name time_simulate( "time_simulate" );
 const Name time_simulate_cpu( "time_simulate_cpu" );
 const Name time_update( "time_update" );
 const Name time_update_cpu( "time_update_cpu" );
+const Name time_update_per_thread( "time_update_per_thread" );
+const Name time_update_per_thread_cpu( "time_update_per_thread_cpu" );
 const Name times( "times" );
 const Name to_do( "to_do" );
 const Name total_num_virtual_procs( "total_num_virtual_procs" );
@@ -646,9 +675,14 @@ const Name u_bar_bar( "u_bar_bar" );
 const Name u_bar_minus( "u_bar_minus" );
 const Name u_bar_plus( "u_bar_plus" );
 const Name u_ref_squared( "u_ref_squared" );
+const Name update_stealing_chunk_size( "update_stealing_chunk_size" );
 const Name update_time_limit( "update_time_limit" );
 const Name upper_right( "upper_right" );
 const Name use_compressed_spikes( "use_compressed_spikes" );
+const Name use_cost_balanced_placement( "use_cost_balanced_placement" );
+const Name use_input_buffer_pools( "use_input_buffer_pools" );
+const Name use_population_update( "use_population_update" );
+const Name use_update_stealing( "use_update_stealing" );
 const Name use_wfr( "use_wfr" );
 
 const Name v( "v" );
@@ -675,6 +709,7 @@ const Name voltage_reset_add( "voltage_reset_add" );
 const Name voltage_reset_fraction( "voltage_reset_fraction" );
 const Name volume_transmitter( "volume_transmitter" );
 const Name vp( "vp" );
+const Name vp_update_costs( "vp_update_costs" );
 
 const Name Wmax( "Wmax" );
 const Name Wmin( "Wmin" );
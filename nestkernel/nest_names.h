@@ -130,8 +130,11 @@ extern const Name center;
 extern const Name circular;
 extern const Name clear;
 extern const Name comp_idx;
+extern const Name compact_spike_data;
+extern const Name compact_spike_data_active;
 extern const Name comparator;
 extern const Name compartments;
+extern const Name compress_source_table;
 extern const Name conc_Mg2;
 extern const Name configbit_0;
 extern const Name configbit_1;
@@ -274,6 +277,9 @@ extern const Name h;
 extern const Name h_IP3R;
 extern const Name has_connections;
 extern const Name has_delay;
+extern const Name hierarchical_target_data_exchange;
+extern const Name hierarchical_target_data_exchange_group_size;
+extern const Name hierarchical_target_data_exchange_num_groups;
 extern const Name histogram;
 extern const Name histogram_correction;
 
@@ -297,6 +303,7 @@ extern const Name Inact_h;
 extern const Name Inact_p;
 extern const Name IP3;
 extern const Name IP3_0;
+extern const Name incremental_connection_update;
 extern const Name indegree;
 extern const Name index_map;
 extern const Name individual_spike_trains;
@@ -330,6 +337,7 @@ extern const Name linear_summation;
 extern const Name local;
 extern const Name local_num_threads;
 extern const Name local_spike_counter;
+extern const Name local_target_data_counter;
 extern const Name lookuptable_0;
 extern const Name lookuptable_1;
 extern const Name lookuptable_2;
@@ -355,6 +363,7 @@ extern const Name min_update_time;
 extern const Name minor_axis;
 extern const Name model;
 extern const Name model_id;
+extern const Name model_update_costs;
 extern const Name modules;
 extern const Name mpi_address;
 extern const Name ms_per_tic;
@@ -375,6 +384,10 @@ extern const Name n_messages;
 extern const Name n_proc;
 extern const Name n_receptors;
 extern const Name n_synapses;
+extern const Name neighbor_spike_exchange;
+extern const Name neighbor_spike_exchange_active;
+extern const Name neighbor_spike_exchange_bytes_saved;
+extern const Name neighbor_spike_exchange_max_density;
 extern const Name network_size;
 extern const Name neuron;
 extern const Name next_readout_time;
@@ -441,6 +454,7 @@ extern const Name q_sfa;
 extern const Name q_stc;
 
 extern const Name radius;
+extern const Name radix_sort_connections;
 extern const Name rate;
 extern const Name rate_IP3R;
 extern const Name rate_L;
@@ -501,13 +515,25 @@ extern const Name size_of;
 extern const Name soma_curr;
 extern const Name soma_exc;
 extern const Name soma_inh;
+extern const Name sort_spikes_by_target;
 extern const Name source;
 extern const Name spherical;
+extern const Name spike_buffer_ema_weight;
+extern const Name spike_buffer_encoding;
+extern const Name spike_buffer_encoding_active;
 extern const Name spike_buffer_grow_extra;
+extern const Name spike_buffer_headroom;
+extern const Name spike_buffer_overflows;
+extern const Name spike_buffer_predictive_sizing;
+extern const Name spike_buffer_resize_interval;
 extern const Name spike_buffer_resize_log;
 extern const Name spike_buffer_shrink_limit;
 extern const Name spike_buffer_shrink_spare;
+extern const Name spike_buffer_thread_sections;
+extern const Name spike_delivery_batch_size;
 extern const Name spike_dependent_threshold;
+extern const Name spike_exchange_pipeline_depth;
+extern const Name spike_exchange_rounds;
 extern const Name spike_multiplicities;
 extern const Name spike_times;
 extern const Name spike_weights;
@@ -518,6 +544,7 @@ extern const Name std_mod;
 extern const Name stimulation_backends;
 extern const Name stimulator;
 extern const Name stimulus_source;
+extern const Name stolen_update_chunks;
 extern const Name stop;
 extern const Name structural_plasticity_synapses;
 extern const Name structural_plasticity_update_interval;
@@ -661,6 +688,8 @@ extern const Name time_simulate;
 extern const Name time_simulate_cpu;
 extern const Name time_update;
 extern const Name time_update_cpu;
+extern const Name time_update_per_thread;
+extern const Name time_update_per_thread_cpu;
 extern const Name times;
 extern const Name to_do;
 extern const Name total_num_virtual_procs;
@@ -674,9 +703,14 @@ extern const Name u_bar_bar;
 extern const Name u_bar_minus;
 extern const Name u_bar_plus;
 extern const Name u_ref_squared;
+extern const Name update_stealing_chunk_size;
 extern const Name update_time_limit;
 extern const Name upper_right;
 extern const Name use_compressed_spikes;
+extern const Name use_cost_balanced_placement;
+extern const Name use_input_buffer_pools;
+extern const Name use_population_update;
+extern const Name use_update_stealing;
 extern const Name use_wfr;
 
 extern const Name v;
@@ -703,6 +737,7 @@ extern const Name voltage_reset_add;
 extern const Name voltage_reset_fraction;
 extern const Name volume_transmitter;
 extern const Name vp;
+extern const Name vp_update_costs;
 
 extern const Name Wmax;
 extern const Name Wmin;
@@ -197,6 +197,39 @@ Node::wfr_update( Time const&, const long, const long )
   throw UnexpectedEvent( "Waveform relaxation not supported." );
 }
 
+bool
+Node::supports_population_update() const
+{
+  return false;
+}
+
+bool
+Node::supports_update_stealing() const
+{
+  return false;
+}
+
+void
+Node::update_population( const std::vector< Node* >& nodes, Time const& origin, const long from, const long to )
+{
+  for ( auto node : nodes )
+  {
+    node->update( origin, from, to );
+  }
+}
+
+size_t
+Node::get_input_buffer_pool_channels() const
+{
+  return 0;
+}
+
+void
+Node::set_input_buffer_pool( double*, const size_t )
+{
+  throw KernelException( "Input buffer pools not supported." );
+}
+
 /**
  * Default implementation of check_connection just throws IllegalConnection
  */
@@ -315,6 +315,73 @@ public:
    */
   virtual bool wfr_update( Time const&, const long, const long );
 
+  /**
+   * Returns true if the node can be updated together with other nodes of its
+   * model by update_population().
+   */
+  virtual bool supports_population_update() const;
+
+  /**
+   * Bring a group of nodes of the same model from state $t$ to $t+n*dt$.
+   *
+   * Has the same effect as calling update() on each node of the group, but
+   * allows a model to advance the nodes block by block in one loop over time
+   * steps, with the state of the nodes in a block held in contiguous arrays
+   * so that the compiler can vectorise the update across nodes. Within each
+   * step, spikes are emitted in the order of the nodes in the group.
+   *
+   * The function is called on one node of the group. All nodes in the group
+   * are of the model of this node and support population updates.
+   *
+   * The default implementation calls update() on each node of the group.
+   *
+   * @param nodes  nodes to update
+   * @param Time   network time at beginning of time slice.
+   * @param long initial step inside time slice
+   * @param long post-final step inside time slice
+   */
+  virtual void update_population( const std::vector< Node* >& nodes, Time const&, const long, const long );
+
+  /**
+   * Maximal number of nodes advanced together by implementations of update_population().
+   *
+   * Keeps the arrays holding the state of one block of nodes small enough to stay in cache.
+   */
+  static constexpr size_t population_update_block_size = 128;
+
+  /**
+   * Returns true if the node can be updated by any thread, not only by the
+   * thread it is placed on.
+   *
+   * The update of such nodes must not use resources of their thread, e.g.,
+   * the random number generator of the virtual process, and must not send
+   * secondary events. Spikes they send are registered with the thread
+   * executing the update.
+   */
+  virtual bool supports_update_stealing() const;
+
+  /**
+   * Returns the number of input channels per ring buffer slot that the node
+   * can keep in an input buffer pool, or 0 if its input buffer cannot be
+   * kept in a pool.
+   */
+  virtual size_t get_input_buffer_pool_channels() const;
+
+  /**
+   * Keep the input buffer of the node in an input buffer pool.
+   *
+   * An input buffer pool holds the input buffers of the nodes of one model
+   * on one thread in a single array, interleaved slot by slot, so that input
+   * is delivered to a few large arrays and read contiguously during update.
+   * Slot s of the node begins at first + s * stride * channels. If first is
+   * a nullptr, the node keeps its input buffer in its own storage again.
+   * Buffered input is preserved.
+   *
+   * @param first  first value of the input buffer in the pool
+   * @param stride number of nodes sharing the pool
+   */
+  virtual void set_input_buffer_pool( double* first, const size_t stride );
+
   /**
    * @defgroup status_interface Configuration interface.
    *
@@ -24,6 +24,7 @@
 
 // C++ includes:
 #include <algorithm>
+#include <cmath>
 #include <set>
 
 // Includes from libnestutil:
@@ -54,6 +55,12 @@ NodeManager::NodeManager()
   , num_active_nodes_( 0 )
   , num_thread_local_devices_()
   , have_nodes_changed_( true )
+  , use_input_buffer_pools_( false )
+  , have_input_buffer_pools_( false )
+  , input_buffer_pools_()
+  , use_cost_balanced_placement_( false )
+  , model_update_costs_()
+  , vp_update_costs_()
   , exceptions_raised_() // cannot call kernel(), not complete yet
 {
 }
@@ -72,11 +79,18 @@ NodeManager::initialize( const bool adjust_number_of_threads_or_rng_only )
   wfr_network_size_ = 0;
   local_nodes_.resize( kernel().vp_manager.get_num_threads() );
   num_thread_local_devices_.resize( kernel().vp_manager.get_num_threads(), 0 );
+  input_buffer_pools_.resize( kernel().vp_manager.get_num_threads() );
   ensure_valid_thread_local_ids();
 
+  // no nodes exist when the number of threads changes
+  vp_update_costs_.assign( kernel().vp_manager.get_num_virtual_processes(), 0.0 );
+
   if ( not adjust_number_of_threads_or_rng_only )
   {
     sw_construction_create_.reset();
+    use_input_buffer_pools_ = false;
+    use_cost_balanced_placement_ = false;
+    model_update_costs_.clear();
   }
 }
 
@@ -85,6 +99,10 @@ NodeManager::finalize( const bool )
 {
   destruct_nodes_();
   clear_node_collection_container();
+
+  // pools can only be released after the nodes using them
+  input_buffer_pools_.clear();
+  have_input_buffer_pools_ = false;
 }
 
 DictionaryDatum
@@ -127,6 +145,7 @@ NodeManager::add_node( size_t model_id, long n )
   }
 
   kernel().modelrange_manager.add_range( model_id, min_node_id, max_node_id );
+  assign_vps_( *model, min_node_id, max_node_id );
 
   // clear any exceptions from previous call
   std::vector< std::shared_ptr< WrappedThreadException > >( kernel().vp_manager.get_num_threads() )
@@ -185,6 +204,67 @@ NodeManager::add_node( size_t model_id, long n )
   return nc_ptr;
 }
 
+void
+NodeManager::assign_vps_( Model& model, size_t min_node_id, size_t max_node_id )
+{
+  const size_t num_vps = kernel().vp_manager.get_num_virtual_processes();
+
+  // VP continuing the round-robin order
+  const size_t round_robin_vp = kernel().vp_manager.node_id_to_vp( min_node_id );
+  size_t first_vp = round_robin_vp;
+
+  if ( model.has_proxies() )
+  {
+    const size_t model_id = model.get_model_id();
+    const size_t num_nodes = max_node_id - min_node_id + 1;
+    const size_t num_extra = num_nodes % num_vps; // number of VPs receiving one neuron more
+
+    const auto cost_it = model_update_costs_.find( model_id );
+    const double cost = cost_it != model_update_costs_.end() ? cost_it->second : 1.0;
+
+    const bool continues_model =
+      min_node_id > 1 and kernel().modelrange_manager.get_model_id( min_node_id - 1 ) == model_id;
+
+    if ( use_cost_balanced_placement_ and num_extra > 0 and not continues_model )
+    {
+      // Slide a window of num_extra VPs once around all VPs, starting at the round-robin VP,
+      // so that it is kept if no other window is cheaper.
+      double window_cost = 0.0;
+      for ( size_t i = 0; i < num_extra; ++i )
+      {
+        window_cost += vp_update_costs_[ ( round_robin_vp + i ) % num_vps ];
+      }
+
+      double min_window_cost = window_cost;
+      for ( size_t i = 1; i < num_vps; ++i )
+      {
+        const size_t vp = ( round_robin_vp + i ) % num_vps;
+        window_cost +=
+          vp_update_costs_[ ( vp + num_extra - 1 ) % num_vps ] - vp_update_costs_[ ( vp + num_vps - 1 ) % num_vps ];
+
+        // ignore differences from rounding in the running sum
+        if ( window_cost < min_window_cost - 1e-10 * std::abs( min_window_cost ) )
+        {
+          min_window_cost = window_cost;
+          first_vp = vp;
+        }
+      }
+    }
+
+    const double base_cost = cost * ( num_nodes / num_vps );
+    for ( auto& vp_cost : vp_update_costs_ )
+    {
+      vp_cost += base_cost;
+    }
+    for ( size_t i = 0; i < num_extra; ++i )
+    {
+      vp_update_costs_[ ( first_vp + i ) % num_vps ] += cost;
+    }
+  }
+
+  kernel().vp_manager.assign_vps( min_node_id, max_node_id, first_vp );
+}
+
 void
 NodeManager::add_neurons_( Model& model, size_t min_node_id, size_t max_node_id )
 {
@@ -438,8 +518,8 @@ NodeManager::is_local_node_id( size_t node_id ) const
 size_t
 NodeManager::get_max_num_local_nodes() const
 {
-  return static_cast< size_t >(
-    ceil( static_cast< double >( size() ) / kernel().vp_manager.get_num_virtual_processes() ) );
+  // local IDs are reserved on every VP, also where fewer nodes are placed
+  return size() == 0 ? 0 : kernel().vp_manager.node_id_to_lid( size() ) + 1;
 }
 
 size_t
@@ -666,6 +746,16 @@ NodeManager::prepare_nodes()
           }
         }
       }
+
+      // new nodes have been given input buffers of their own by prepare_node_()
+      if ( use_input_buffer_pools_ and ( have_nodes_changed_ or not have_input_buffer_pools_ ) )
+      {
+        build_input_buffer_pools_( t );
+      }
+      else if ( not use_input_buffer_pools_ and have_input_buffer_pools_ )
+      {
+        release_input_buffer_pools_( t );
+      }
     }
     catch ( std::exception& e )
     {
@@ -694,9 +784,67 @@ NodeManager::prepare_nodes()
   }
 
   num_active_nodes_ = num_active_nodes;
+  have_input_buffer_pools_ = use_input_buffer_pools_;
   LOG( M_INFO, "NodeManager::prepare_nodes", os.str() );
 }
 
+void
+NodeManager::build_input_buffer_pools_( const size_t tid )
+{
+  // number of nodes and channels per slot for each model
+  std::map< size_t, std::pair< size_t, size_t > > pool_sizes;
+  for ( SparseNodeArray::const_iterator it = local_nodes_[ tid ].begin(); it != local_nodes_[ tid ].end(); ++it )
+  {
+    const Node* node = it->get_node();
+    const size_t num_channels = node->get_input_buffer_pool_channels();
+    if ( num_channels > 0 )
+    {
+      auto& pool_size = pool_sizes[ node->get_model_id() ];
+      ++pool_size.first;
+      pool_size.second = num_channels;
+    }
+  }
+
+  const size_t num_slots = kernel().connection_manager.get_min_delay() + kernel().connection_manager.get_max_delay();
+
+  // nodes copy their buffered input from the old pools, which are released after the loop
+  std::map< size_t, std::vector< double > > pools;
+  for ( const auto& pool_size : pool_sizes )
+  {
+    pools[ pool_size.first ].resize( num_slots * pool_size.second.first * pool_size.second.second, 0.0 );
+  }
+
+  std::map< size_t, size_t > next_index;
+  for ( SparseNodeArray::const_iterator it = local_nodes_[ tid ].begin(); it != local_nodes_[ tid ].end(); ++it )
+  {
+    Node* node = it->get_node();
+    const size_t num_channels = node->get_input_buffer_pool_channels();
+    if ( num_channels > 0 )
+    {
+      const size_t model_id = node->get_model_id();
+      const size_t index = next_index[ model_id ]++;
+      node->set_input_buffer_pool( pools[ model_id ].data() + index * num_channels, pool_sizes[ model_id ].first );
+    }
+  }
+
+  input_buffer_pools_[ tid ].swap( pools );
+}
+
+void
+NodeManager::release_input_buffer_pools_( const size_t tid )
+{
+  for ( SparseNodeArray::const_iterator it = local_nodes_[ tid ].begin(); it != local_nodes_[ tid ].end(); ++it )
+  {
+    Node* node = it->get_node();
+    if ( node->get_input_buffer_pool_channels() > 0 )
+    {
+      node->set_input_buffer_pool( nullptr, 0 );
+    }
+  }
+
+  input_buffer_pools_[ tid ].clear();
+}
+
 void
 NodeManager::post_run_cleanup()
 {
@@ -786,12 +934,42 @@ void
 NodeManager::get_status( DictionaryDatum& d )
 {
   def< long >( d, names::network_size, size() );
+  def< bool >( d, names::use_input_buffer_pools, use_input_buffer_pools_ );
+  def< bool >( d, names::use_cost_balanced_placement, use_cost_balanced_placement_ );
+  def< ArrayDatum >( d, names::vp_update_costs, ArrayDatum( vp_update_costs_ ) );
+
+  DictionaryDatum model_update_costs( new Dictionary );
+  for ( const auto& model_cost : model_update_costs_ )
+  {
+    def< double >(
+      model_update_costs, kernel().model_manager.get_node_model( model_cost.first )->get_name(), model_cost.second );
+  }
+  def< DictionaryDatum >( d, names::model_update_costs, model_update_costs );
+
   sw_construction_create_.get_status( d, names::time_construction_create, names::time_construction_create_cpu );
 }
 
 void
-NodeManager::set_status( const DictionaryDatum& )
+NodeManager::set_status( const DictionaryDatum& d )
 {
+  updateValue< bool >( d, names::use_input_buffer_pools, use_input_buffer_pools_ );
+  updateValue< bool >( d, names::use_cost_balanced_placement, use_cost_balanced_placement_ );
+
+  DictionaryDatum model_update_costs;
+  if ( updateValue< DictionaryDatum >( d, names::model_update_costs, model_update_costs ) )
+  {
+    std::map< size_t, double > new_model_update_costs;
+    for ( Dictionary::const_iterator it = model_update_costs->begin(); it != model_update_costs->end(); ++it )
+    {
+      const double cost = getValue< double >( it->second );
+      if ( not( cost > 0.0 ) )
+      {
+        throw BadProperty( "Update costs of models must be positive." );
+      }
+      new_model_update_costs[ kernel().model_manager.get_node_model_id( it->first ) ] = cost;
+    }
+    model_update_costs_.swap( new_model_update_costs );
+  }
 }
 
 } // namespace nest
@@ -24,6 +24,7 @@
 #define NODE_MANAGER_H
 
 // C++ includes:
+#include <map>
 #include <vector>
 
 // Includes from libnestutil:
@@ -281,6 +282,35 @@ private:
    */
   void prepare_node_( Node* );
 
+  /**
+   * Move the input buffers of the nodes on the thread into one pool per model.
+   *
+   * Buffered input is moved from the current storage of the input buffers.
+   *
+   * @see Node::set_input_buffer_pool()
+   */
+  void build_input_buffer_pools_( const size_t tid );
+
+  /**
+   * Move the input buffers of the nodes on the thread back into their own storage.
+   */
+  void release_input_buffer_pools_( const size_t tid );
+
+  /**
+   * Assign the new nodes to VPs and add their expected update cost to the VPs.
+   *
+   * Nodes are assigned round-robin. If use_cost_balanced_placement_ is set, neurons
+   * start on the VP after which the VPs that receive one neuron more than the others
+   * have the lowest expected update cost. The start is only moved where the model
+   * changes, so that the nodes of each contiguous range of one model keep a fixed
+   * VP stride.
+   *
+   * @param model Model of nodes to create.
+   * @param min_node_id node ID of first node to create.
+   * @param max_node_id node ID of last node to create (inclusive).
+   */
+  void assign_vps_( Model& model, size_t min_node_id, size_t max_node_id );
+
   /**
    * Add normal neurons.
    *
@@ -352,6 +382,20 @@ private:
   bool have_nodes_changed_; //!< true if new nodes have been created
                             //!< since startup or last call to simulate
 
+  bool use_input_buffer_pools_;  //!< keep input buffers of nodes in one pool per thread and model
+  bool have_input_buffer_pools_; //!< true if input buffers are kept in pools
+
+  //! Input buffer pools, indexed by thread and model id
+  std::vector< std::map< size_t, std::vector< double > > > input_buffer_pools_;
+
+  bool use_cost_balanced_placement_; //!< place neurons on VPs by their expected update cost
+
+  //! Expected update cost per neuron, indexed by model id; models not listed cost 1
+  std::map< size_t, double > model_update_costs_;
+
+  //! Expected update cost of the neurons placed on each VP
+  std::vector< double > vp_update_costs_;
+
   //! Store exceptions raised in thread-parallel sections for later handling
   std::vector< std::shared_ptr< WrappedThreadException > > exceptions_raised_;
 
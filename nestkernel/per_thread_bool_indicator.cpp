@@ -45,6 +45,12 @@ PerThreadBoolIndicator::operator[]( const size_t tid )
   return per_thread_status_[ tid ];
 }
 
+const BoolIndicatorUInt64&
+PerThreadBoolIndicator::operator[]( const size_t tid ) const
+{
+  return per_thread_status_[ tid ];
+}
+
 void
 PerThreadBoolIndicator::initialize( const size_t num_threads, const bool status )
 {
@@ -108,6 +108,7 @@ public:
   PerThreadBoolIndicator() {};
 
   BoolIndicatorUInt64& operator[]( const size_t tid );
+  const BoolIndicatorUInt64& operator[]( const size_t tid ) const;
 
   void
   set_true( const size_t tid )
@@ -365,15 +365,25 @@ ListRingBuffer::get_index_( const long d ) const
 }
 
 
-template < unsigned int num_channels >
+/**
+ * Ring buffer holding the input of several channels per slot.
+ *
+ * Values are stored as valueT, so that models can keep their input buffers in
+ * single precision. Each value added is converted to valueT after summation.
+ */
+template < unsigned int num_channels, typename valueT = double >
 class MultiChannelInputBuffer
 {
 public:
   MultiChannelInputBuffer();
 
+  //! Copies the buffered data into storage owned by the new buffer
+  MultiChannelInputBuffer( const MultiChannelInputBuffer& );
+  MultiChannelInputBuffer& operator=( const MultiChannelInputBuffer& ) = delete;
+
   void add_value( const size_t slot, const size_t channel, const double value );
 
-  const std::array< double, num_channels >& get_values_all_channels( const size_t slot ) const;
+  const std::array< valueT, num_channels >& get_values_all_channels( const size_t slot ) const;
   void reset_values_all_channels( const size_t slot );
 
   void clear();
@@ -382,44 +392,80 @@ public:
 
   size_t size() const;
 
+  /**
+   * Keep the buffered data in external storage shared with other buffers.
+   *
+   * Slot s of the buffer is kept in the num_channels values beginning at
+   * first + s * stride * num_channels, so that the buffers of stride nodes
+   * can be interleaved slot by slot in one array. The buffered data is
+   * copied to the new storage. If first is a nullptr, the data is moved back
+   * into storage owned by the buffer.
+   */
+  void use_external_storage( valueT* first, const size_t stride );
+
 private:
+  std::array< valueT, num_channels >& slot_( const size_t slot );
+  const std::array< valueT, num_channels >& slot_( const size_t slot ) const;
+
   /**
-   * Buffered data stored in a vector of arrays of double values
+   * Buffered data stored in a vector of arrays of values
    *
    * 1st dimension: ring buffer slot (index into outer vector)
    * 2nd dimension: channel (index into inner array)
+   *
+   * Empty while the data is kept in external storage.
    */
-  std::vector< std::array< double, num_channels > > buffer_;
+  std::vector< std::array< valueT, num_channels > > buffer_;
+
+  std::array< valueT, num_channels >* external_buffer_; //!< First slot in external storage, or nullptr
+  size_t external_stride_;                              //!< Distance between slots in external storage
+  size_t external_size_;                                //!< Number of slots in external storage
 };
 
-template < unsigned int num_channels >
+template < unsigned int num_channels, typename valueT >
+inline std::array< valueT, num_channels >&
+MultiChannelInputBuffer< num_channels, valueT >::slot_( const size_t slot )
+{
+  assert( slot < size() );
+  return external_buffer_ ? external_buffer_[ slot * external_stride_ ] : buffer_[ slot ];
+}
+
+template < unsigned int num_channels, typename valueT >
+inline const std::array< valueT, num_channels >&
+MultiChannelInputBuffer< num_channels, valueT >::slot_( const size_t slot ) const
+{
+  assert( slot < size() );
+  return external_buffer_ ? external_buffer_[ slot * external_stride_ ] : buffer_[ slot ];
+}
+
+template < unsigned int num_channels, typename valueT >
 inline void
-MultiChannelInputBuffer< num_channels >::reset_values_all_channels( const size_t slot )
+MultiChannelInputBuffer< num_channels, valueT >::reset_values_all_channels( const size_t slot )
 {
-  assert( slot < buffer_.size() );
-  buffer_[ slot ].fill( 0.0 );
+  slot_( slot ).fill( 0.0 );
 }
 
-template < unsigned int num_channels >
+template < unsigned int num_channels, typename valueT >
 inline void
-MultiChannelInputBuffer< num_channels >::add_value( const size_t slot, const size_t channel, const double value )
+MultiChannelInputBuffer< num_channels, valueT >::add_value( const size_t slot,
+  const size_t channel,
+  const double value )
 {
-  buffer_[ slot ][ channel ] += value;
+  slot_( slot )[ channel ] += value;
 }
 
-template < unsigned int num_channels >
-inline const std::array< double, num_channels >&
-MultiChannelInputBuffer< num_channels >::get_values_all_channels( const size_t slot ) const
+template < unsigned int num_channels, typename valueT >
+inline const std::array< valueT, num_channels >&
+MultiChannelInputBuffer< num_channels, valueT >::get_values_all_channels( const size_t slot ) const
 {
-  assert( slot < buffer_.size() );
-  return buffer_[ slot ];
+  return slot_( slot );
 }
 
-template < unsigned int num_channels >
+template < unsigned int num_channels, typename valueT >
 inline size_t
-MultiChannelInputBuffer< num_channels >::size() const
+MultiChannelInputBuffer< num_channels, valueT >::size() const
 {
-  return buffer_.size();
+  return external_buffer_ ? external_size_ : buffer_.size();
 }
 
 } // namespace nest
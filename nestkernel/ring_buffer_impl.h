@@ -25,31 +25,87 @@
 
 #include "ring_buffer.h"
 
-template < unsigned int num_channels >
-nest::MultiChannelInputBuffer< num_channels >::MultiChannelInputBuffer()
+template < unsigned int num_channels, typename valueT >
+nest::MultiChannelInputBuffer< num_channels, valueT >::MultiChannelInputBuffer()
   : buffer_( kernel().connection_manager.get_min_delay() + kernel().connection_manager.get_max_delay(),
-    std::array< double, num_channels >() )
+    std::array< valueT, num_channels >() )
+  , external_buffer_( nullptr )
+  , external_stride_( 0 )
+  , external_size_( 0 )
 {
 }
 
-template < unsigned int num_channels >
+template < unsigned int num_channels, typename valueT >
+nest::MultiChannelInputBuffer< num_channels, valueT >::MultiChannelInputBuffer( const MultiChannelInputBuffer& other )
+  : buffer_( other.size() )
+  , external_buffer_( nullptr )
+  , external_stride_( 0 )
+  , external_size_( 0 )
+{
+  for ( size_t slot = 0; slot < buffer_.size(); ++slot )
+  {
+    buffer_[ slot ] = other.slot_( slot );
+  }
+}
+
+template < unsigned int num_channels, typename valueT >
 void
-nest::MultiChannelInputBuffer< num_channels >::resize()
+nest::MultiChannelInputBuffer< num_channels, valueT >::resize()
 {
   const size_t size = kernel().connection_manager.get_min_delay() + kernel().connection_manager.get_max_delay();
-  if ( buffer_.size() != size )
+
+  // external storage is set up for the number of slots of the buffer when it is assigned
+  assert( not external_buffer_ or external_size_ == size );
+
+  if ( not external_buffer_ and buffer_.size() != size )
   {
-    buffer_.resize( size, std::array< double, num_channels >() );
+    buffer_.resize( size, std::array< valueT, num_channels >() );
   }
 }
 
-template < unsigned int num_channels >
+template < unsigned int num_channels, typename valueT >
 void
-nest::MultiChannelInputBuffer< num_channels >::clear()
+nest::MultiChannelInputBuffer< num_channels, valueT >::use_external_storage( valueT* first, const size_t stride )
+{
+  static_assert( sizeof( std::array< valueT, num_channels > ) == num_channels * sizeof( valueT ),
+    "External storage requires arrays of channels without padding." );
+
+  const size_t num_slots = size();
+
+  if ( first )
+  {
+    auto* external_buffer = reinterpret_cast< std::array< valueT, num_channels >* >( first );
+    for ( size_t slot = 0; slot < num_slots; ++slot )
+    {
+      external_buffer[ slot * stride ] = slot_( slot );
+    }
+
+    external_buffer_ = external_buffer;
+    external_stride_ = stride;
+    external_size_ = num_slots;
+    std::vector< std::array< valueT, num_channels > >().swap( buffer_ );
+  }
+  else if ( external_buffer_ )
+  {
+    buffer_.resize( num_slots );
+    for ( size_t slot = 0; slot < num_slots; ++slot )
+    {
+      buffer_[ slot ] = external_buffer_[ slot * external_stride_ ];
+    }
+
+    external_buffer_ = nullptr;
+    external_stride_ = 0;
+    external_size_ = 0;
+  }
+}
+
+template < unsigned int num_channels, typename valueT >
+void
+nest::MultiChannelInputBuffer< num_channels, valueT >::clear()
 {
   resize(); // does nothing if size is fine
   // set all elements to 0.0
-  for ( size_t slot = 0; slot < buffer_.size(); ++slot )
+  for ( size_t slot = 0; slot < size(); ++slot )
   {
     reset_values_all_channels( slot );
   }
@@ -71,6 +71,9 @@ public:
   bool is_chunk_filled( const size_t rank ) const;
 
   void increase( const size_t rank );
+
+  //! Advance write position for rank by the given number of entries.
+  void increase( const size_t rank, const size_t num_entries );
 };
 
 inline size_t
@@ -103,6 +106,13 @@ SendBufferPosition::increase( const size_t rank )
   ++idx_[ rank ];
 }
 
+inline void
+SendBufferPosition::increase( const size_t rank, const size_t num_entries )
+{
+  assert( idx_[ rank ] + num_entries <= end_[ rank ] );
+  idx_[ rank ] += num_entries;
+}
+
 
 /**
  * This class simplifies keeping track of write position in MPI buffer
@@ -155,6 +165,12 @@ public:
   bool are_all_chunks_filled() const;
 
   void increase( const size_t rank );
+
+  /**
+   * Returns the number of target data written to the parts of the MPI
+   * buffer assigned to this thread.
+   */
+  size_t get_num_target_data_written() const;
 };
 
 inline TargetSendBufferPosition::TargetSendBufferPosition( const AssignedRanks& assigned_ranks,
@@ -224,6 +240,12 @@ TargetSendBufferPosition::increase( const size_t rank )
   ++num_target_data_written_;
 }
 
+inline size_t
+TargetSendBufferPosition::get_num_target_data_written() const
+{
+  return num_target_data_written_;
+}
+
 } // namespace nest
 
 #endif /* SEND_BUFFER_POSITION_H */
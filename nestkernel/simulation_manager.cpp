@@ -26,6 +26,7 @@
 #include <sys/time.h>
 
 // C++ includes:
+#include <algorithm>
 #include <limits>
 #include <vector>
 
@@ -55,6 +56,9 @@ nest::SimulationManager::SimulationManager()
   , simulated_( false )
   , inconsistent_state_( false )
   , print_time_( false )
+  , use_population_update_( false )
+  , use_update_stealing_( false )
+  , stealing_chunk_size_( 64 )
   , use_wfr_( true )
   , wfr_comm_interval_( 1.0 )
   , wfr_tol_( 0.0001 )
@@ -95,6 +99,9 @@ nest::SimulationManager::initialize( const bool adjust_number_of_threads_or_rng_
   simulated_ = false;
   inconsistent_state_ = false;
   print_time_ = false;
+  use_population_update_ = false;
+  use_update_stealing_ = false;
+  stealing_chunk_size_ = 64;
   use_wfr_ = true;
 
   wfr_comm_interval_ = 1.0;
@@ -128,8 +135,11 @@ nest::SimulationManager::reset_timers_for_dynamics()
   sw_gather_spike_data_.reset();
   sw_gather_secondary_data_.reset();
   sw_update_.reset();
+  sw_update_per_thread_.reset();
   sw_deliver_spike_data_.reset();
   sw_deliver_secondary_data_.reset();
+
+  stolen_update_chunks_.assign( kernel().vp_manager.get_num_threads(), 0 );
 }
 
 void
@@ -172,6 +182,20 @@ nest::SimulationManager::set_status( const DictionaryDatum& d )
   }
 
   updateValue< bool >( d, names::print_time, print_time_ );
+  updateValue< bool >( d, names::use_population_update, use_population_update_ );
+  updateValue< bool >( d, names::use_update_stealing, use_update_stealing_ );
+
+  long chunk_size = 0;
+  if ( updateValue< long >( d, names::update_stealing_chunk_size, chunk_size ) )
+  {
+    if ( chunk_size <= 0 )
+    {
+      LOG( M_ERROR, "SimulationManager::set_status", "update_stealing_chunk_size > 0 required." );
+      throw KernelException();
+    }
+
+    stealing_chunk_size_ = chunk_size;
+  }
 
   // tics_per_ms and resolution must come after local_num_thread /
   // total_num_threads because they might reset the network and the time
@@ -461,6 +485,10 @@ nest::SimulationManager::get_status( DictionaryDatum& d )
   def< double >( d, names::biological_time, get_time().get_ms() );
   def< long >( d, names::to_do, to_do_ );
   def< bool >( d, names::print_time, print_time_ );
+  def< bool >( d, names::use_population_update, use_population_update_ );
+  def< bool >( d, names::use_update_stealing, use_update_stealing_ );
+  def< long >( d, names::update_stealing_chunk_size, stealing_chunk_size_ );
+  def< ArrayDatum >( d, names::stolen_update_chunks, ArrayDatum( stolen_update_chunks_ ) );
 
   def< bool >( d, names::prepared, prepared_ );
 
@@ -479,6 +507,7 @@ nest::SimulationManager::get_status( DictionaryDatum& d )
   sw_gather_spike_data_.get_status( d, names::time_gather_spike_data, names::time_gather_spike_data_cpu );
   sw_gather_secondary_data_.get_status( d, names::time_gather_secondary_data, names::time_gather_secondary_data_cpu );
   sw_update_.get_status( d, names::time_update, names::time_update_cpu );
+  sw_update_per_thread_.get_status( d, names::time_update_per_thread, names::time_update_per_thread_cpu );
   sw_gather_target_data_.get_status( d, names::time_gather_target_data, names::time_gather_target_data_cpu );
   sw_deliver_spike_data_.get_status( d, names::time_deliver_spike_data, names::time_deliver_spike_data_cpu );
   sw_deliver_secondary_data_.get_status(
@@ -552,6 +581,12 @@ nest::SimulationManager::prepare()
       update_connection_infrastructure( tid );
     } // of omp parallel
   }
+
+  // needs to know the final connection infrastructure
+  kernel().event_delivery_manager.configure_spike_data_encoding();
+
+  // needs to know whether secondary connections exist
+  kernel().event_delivery_manager.configure_spike_exchange_pipeline();
 }
 
 void
@@ -628,7 +663,7 @@ nest::SimulationManager::run( Time const& t )
   // of a simulation, it has been reset properly elsewhere.  If
   // a simulation was ended and is now continued, from_step_ will
   // have the proper value.  to_step_ is set as in advance_time().
-  to_step_ = std::min( from_step_ + to_do_, kernel().connection_manager.get_min_delay() );
+  to_step_ = std::min( from_step_ + to_do_, kernel().event_delivery_manager.get_pipeline_stage_end( from_step_ ) );
 
 
   // Warn about possible inconsistencies, see #504.
@@ -740,6 +775,12 @@ nest::SimulationManager::update_connection_infrastructure( const size_t tid )
 
   sw_communicate_prepare_.start();
 
+#pragma omp single
+  {
+    // decide which synapse types are rebuilt, see plan_connection_infrastructure_update()
+    kernel().connection_manager.plan_connection_infrastructure_update();
+  } // of omp single; implicit barrier
+
   kernel().connection_manager.sort_connections( tid );
   sw_gather_target_data_.start();
   kernel().connection_manager.restructure_connection_tables( tid );
@@ -761,7 +802,10 @@ nest::SimulationManager::update_connection_infrastructure( const size_t tid )
     kernel().connection_manager.check_secondary_connections_exist();
   }
 
-  if ( kernel().connection_manager.secondary_connections_exist() )
+  // incremental updates leave secondary connections untouched, so their buffers remain valid
+  const bool full_update = kernel().connection_manager.is_full_connection_infrastructure_update();
+
+  if ( full_update and kernel().connection_manager.secondary_connections_exist() )
   {
     kernel().get_omp_synchronization_construction_stopwatch().start();
 #pragma omp barrier
@@ -800,17 +844,23 @@ nest::SimulationManager::update_connection_infrastructure( const size_t tid )
 
   sw_gather_target_data_.stop();
 
-  if ( kernel().connection_manager.secondary_connections_exist() )
-  {
-    kernel().connection_manager.compress_secondary_send_buffer_pos( tid );
-  }
+  kernel().connection_manager.compress_target_table( tid );
 
   kernel().get_omp_synchronization_construction_stopwatch().start();
 #pragma omp barrier
   kernel().get_omp_synchronization_construction_stopwatch().stop();
 #pragma omp single
   {
+    if ( kernel().mpi_manager.get_neighbor_spike_exchange() )
+    {
+      // set up neighbourhood for spike exchange from the targets of local neurons
+      std::vector< int > is_spike_target_rank( kernel().mpi_manager.get_num_processes(), 0 );
+      kernel().connection_manager.get_spike_target_ranks( is_spike_target_rank );
+      kernel().mpi_manager.configure_neighbor_spike_exchange( is_spike_target_rank );
+    }
+
     kernel().connection_manager.clear_compressed_spike_data_map();
+    kernel().connection_manager.record_connection_infrastructure_update();
     kernel().node_manager.set_have_nodes_changed( false );
     kernel().connection_manager.unset_connections_have_changed();
   }
@@ -823,6 +873,107 @@ nest::SimulationManager::wfr_update_( Node* n )
   return ( n->wfr_update( clock_, from_step_, to_step_ ) );
 }
 
+void
+nest::SimulationManager::update_population_( std::vector< Node* >& population )
+{
+  if ( population.size() == 1 )
+  {
+    population.front()->update( clock_, from_step_, to_step_ );
+  }
+  else if ( population.size() > 1 )
+  {
+    population.front()->update_population( population, clock_, from_step_, to_step_ );
+  }
+  population.clear();
+}
+
+void
+nest::SimulationManager::update_node_( Node* node, std::vector< Node* >& population )
+{
+  if ( use_population_update_ and node->supports_population_update() )
+  {
+    if ( not population.empty() and population.front()->get_model_id() != node->get_model_id() )
+    {
+      update_population_( population );
+    }
+    population.push_back( node );
+  }
+  else
+  {
+    // update collected nodes first to preserve the order of updates
+    update_population_( population );
+    node->update( clock_, from_step_, to_step_ );
+  }
+}
+
+void
+nest::SimulationManager::collect_stealable_nodes_( const size_t tid, std::vector< Node* >& own_nodes )
+{
+  stealable_nodes_[ tid ].clear();
+
+  const SparseNodeArray& thread_local_nodes = kernel().node_manager.get_local_nodes( tid );
+  for ( SparseNodeArray::const_iterator n = thread_local_nodes.begin(); n != thread_local_nodes.end(); ++n )
+  {
+    Node* node = n->get_node();
+    if ( node->is_frozen() )
+    {
+      continue;
+    }
+
+    if ( node->supports_update_stealing() )
+    {
+      stealable_nodes_[ tid ].push_back( node );
+    }
+    else
+    {
+      own_nodes.push_back( node );
+    }
+  }
+}
+
+void
+nest::SimulationManager::update_stealable_nodes_( const size_t tid, std::vector< Node* >& population )
+{
+  const size_t num_threads = kernel().vp_manager.get_num_threads();
+  const size_t chunk_size = stealing_chunk_size_;
+
+  // counted locally, as the counters of all threads share cache lines
+  long stolen_chunks = 0;
+
+  for ( size_t i = 0; i < num_threads; ++i )
+  {
+    const size_t owner = ( tid + i ) % num_threads;
+    const std::vector< Node* >& nodes = stealable_nodes_[ owner ];
+
+    while ( true )
+    {
+      size_t chunk;
+#pragma omp atomic capture
+      chunk = next_stealable_chunk_[ owner ]++;
+
+      const size_t begin = chunk * chunk_size;
+      if ( begin >= nodes.size() )
+      {
+        break;
+      }
+
+      const size_t end = std::min( begin + chunk_size, nodes.size() );
+      for ( size_t n = begin; n < end; ++n )
+      {
+        update_node_( nodes[ n ], population );
+      }
+      update_population_( population );
+
+      if ( owner != tid )
+      {
+        ++stolen_chunks;
+      }
+    }
+  }
+
+  stolen_update_chunks_[ tid ] += stolen_chunks;
+}
+
 void
 nest::SimulationManager::update_()
 {
@@ -836,11 +987,30 @@ nest::SimulationManager::update_()
 
   std::vector< std::shared_ptr< WrappedThreadException > > exceptions_raised( kernel().vp_manager.get_num_threads() );
 
+  if ( use_update_stealing_ )
+  {
+    stealable_nodes_.resize( kernel().vp_manager.get_num_threads() );
+    next_stealable_chunk_.assign( kernel().vp_manager.get_num_threads(), 0 );
+  }
+
 // parallel section begins
 #pragma omp parallel
   {
     const size_t tid = kernel().vp_manager.get_thread_id();
 
+    // consecutive nodes of one model collected for Node::update_population()
+    std::vector< Node* > population;
+
+    // nodes that only this thread updates, in their original order
+    std::vector< Node* > own_nodes;
+    if ( use_update_stealing_ )
+    {
+      collect_stealable_nodes_( tid, own_nodes );
+
+      // all threads must know the stealable nodes of the other threads
+#pragma omp barrier
+    }
+
     // We update in a parallel region. Therefore, we need to catch
     // exceptions here and then handle them after the parallel region.
     try
@@ -1037,37 +1207,71 @@ nest::SimulationManager::update_()
         } // of structural plasticity
 
         sw_update_.start();
-        const SparseNodeArray& thread_local_nodes = kernel().node_manager.get_local_nodes( tid );
+        sw_update_per_thread_.start();
+        if ( use_update_stealing_ )
+        {
+          for ( Node* node : own_nodes )
+          {
+            update_node_( node, population );
+          }
+          update_population_( population );
+          sw_update_per_thread_.stop();
+          sw_update_.stop();
 
-        for ( SparseNodeArray::const_iterator n = thread_local_nodes.begin(); n != thread_local_nodes.end(); ++n )
+          // Devices must be done before other threads update the targets of the stimulation devices of this thread.
+          kernel().get_omp_synchronization_simulation_stopwatch().start();
+#pragma omp barrier
+          kernel().get_omp_synchronization_simulation_stopwatch().stop();
+
+          sw_update_.start();
+          sw_update_per_thread_.start();
+          update_stealable_nodes_( tid, population );
+        }
+        else
         {
-          Node* node = n->get_node();
-          if ( not( node )->is_frozen() )
+          const SparseNodeArray& thread_local_nodes = kernel().node_manager.get_local_nodes( tid );
+          for ( SparseNodeArray::const_iterator n = thread_local_nodes.begin(); n != thread_local_nodes.end(); ++n )
           {
-            ( node )->update( clock_, from_step_, to_step_ );
+            Node* node = n->get_node();
+            if ( not( node )->is_frozen() )
+            {
+              update_node_( node, population );
+            }
           }
+          update_population_( population );
         }
-
+        sw_update_per_thread_.stop();
         sw_update_.stop();
 
+        // gather and deliver only at end of slice, i.e., end of min_delay step;
+        // must be decided before the barrier, as the master thread advances to_step_ afterwards
+        const bool gather_spike_data = to_step_ == kernel().connection_manager.get_min_delay()
+          and kernel().connection_manager.has_primary_connections();
+
         // parallel section ends, wait until all threads are done -> synchronize
         kernel().get_omp_synchronization_simulation_stopwatch().start();
 #pragma omp barrier
         kernel().get_omp_synchronization_simulation_stopwatch().stop();
 
+        if ( use_update_stealing_ )
+        {
+          kernel().event_delivery_manager.send_staged_spikes_to_devices( tid );
+        }
+
+        // all threads collocate spikes, the master thread communicates
+        if ( gather_spike_data )
+        {
+          sw_gather_spike_data_.start();
+          kernel().event_delivery_manager.gather_spike_data( tid );
+          sw_gather_spike_data_.stop();
+        }
+
         // the following block is executed by the master thread only
         // the other threads are enforced to wait at the end of the block
 #pragma omp master
         {
-          // gather and deliver only at end of slice, i.e., end of min_delay step
           if ( to_step_ == kernel().connection_manager.get_min_delay() )
           {
-            if ( kernel().connection_manager.has_primary_connections() )
-            {
-              sw_gather_spike_data_.start();
-              kernel().event_delivery_manager.gather_spike_data();
-              sw_gather_spike_data_.stop();
-            }
             if ( kernel().connection_manager.secondary_connections_exist() )
             {
               sw_gather_secondary_data_.start();
@@ -1075,9 +1279,23 @@ nest::SimulationManager::update_()
               sw_gather_secondary_data_.stop();
             }
           }
+          else if ( to_step_ == kernel().event_delivery_manager.get_pipeline_stage_end( from_step_ )
+            and kernel().connection_manager.has_primary_connections() )
+          {
+            // end of a pipeline stage within the slice, exchange overlaps with update of next stage
+            sw_gather_spike_data_.start();
+            kernel().event_delivery_manager.start_spike_data_exchange();
+            sw_gather_spike_data_.stop();
+          }
 
           advance_time_();
 
+          if ( use_update_stealing_ )
+          {
+            // all threads have passed the update phase, chunks can be handed out again
+            std::fill( next_stealable_chunk_.begin(), next_stealable_chunk_.end(), 0 );
+          }
+
           if ( print_time_ )
           {
             gettimeofday( &t_slice_end_, nullptr );
@@ -1130,6 +1348,14 @@ nest::SimulationManager::update_()
     }
   } // of omp parallel
 
+  // spike buffers must not be in use by MPI outside of simulation
+  if ( kernel().connection_manager.has_primary_connections() )
+  {
+    sw_gather_spike_data_.start();
+    kernel().event_delivery_manager.complete_spike_data_exchange();
+    sw_gather_spike_data_.stop();
+  }
+
   if ( update_time_limit_exceeded )
   {
     LOG( M_ERROR, "SimulationManager::update", "Update time limit exceeded." );
@@ -1168,11 +1394,12 @@ nest::SimulationManager::advance_time_()
   }
 
   long end_sim = from_step_ + to_do_;
+  const long stage_end = kernel().event_delivery_manager.get_pipeline_stage_end( from_step_ );
 
-  if ( kernel().connection_manager.get_min_delay() < end_sim )
+  if ( stage_end < end_sim )
   {
-    // update to end of time slice
-    to_step_ = kernel().connection_manager.get_min_delay();
+    // update to end of time slice, or of pipeline stage if the slice is split into stages
+    to_step_ = stage_end;
   }
   else
   {
@@ -105,6 +105,11 @@ public:
    */
   size_t get_wfr_interpolation_order() const;
 
+  /**
+   * Returns true if idle threads update nodes placed on other threads.
+   */
+  bool use_update_stealing() const;
+
   /**
    * Get the time at the beginning of the current time slice.
    */
@@ -193,6 +198,37 @@ private:
   void call_update_(); //!< actually run simulation, aka wrap update_
   void update_();      //! actually perform simulation
   bool wfr_update_( Node* );
+
+  /**
+   * Update a group of nodes of one model and clear the group.
+   *
+   * Single nodes are updated by Node::update(), larger groups by Node::update_population().
+   */
+  void update_population_( std::vector< Node* >& population );
+
+  /**
+   * Update a node, or collect it for Node::update_population() if it supports the population update.
+   *
+   * Collected nodes are updated by update_population_() before a node of another model is updated.
+   */
+  void update_node_( Node* node, std::vector< Node* >& population );
+
+  /**
+   * Sort the local nodes of a thread into those supporting update stealing and the others.
+   *
+   * Nodes supporting update stealing are stored in stealable_nodes_, the others are appended to own_nodes.
+   * Frozen nodes are omitted.
+   */
+  void collect_stealable_nodes_( const size_t tid, std::vector< Node* >& own_nodes );
+
+  /**
+   * Update the stealable nodes of all threads in chunks.
+   *
+   * The thread takes chunks from its own nodes first and then steals chunks from the other threads, until no
+   * chunks are left.
+   */
+  void update_stealable_nodes_( const size_t tid, std::vector< Node* >& population );
+
   void advance_time_();   //!< Update time to next time step
   void print_progress_(); //!< TODO: Remove, replace by logging!
 
@@ -214,6 +250,11 @@ private:
                                    //!< simulation must not be resumed
   bool print_time_;                //!< Indicates whether time should be printed during
                                    //!< simulations (or not)
+  bool use_population_update_;     //!< Indicates whether consecutive nodes of one model
+                                   //!< are updated together by Node::update_population()
+  bool use_update_stealing_;       //!< Indicates whether idle threads update chunks of
+                                   //!< nodes placed on other threads
+  long stealing_chunk_size_;       //!< Number of nodes per chunk for update stealing
   bool use_wfr_;                   //!< Indicates wheter waveform relaxation is used
   double wfr_comm_interval_;       //!< Desired waveform relaxation communication
                                    //!< interval (in ms)
@@ -227,9 +268,19 @@ private:
   double min_update_time_;         //!< shortest update time seen so far (seconds)
   double max_update_time_;         //!< longest update time seen so far (seconds)
 
+  //! Nodes supporting update stealing per thread, excluding frozen nodes
+  std::vector< std::vector< Node* > > stealable_nodes_;
+
+  //! Index of the next chunk of stealable_nodes_ to update per thread, incremented atomically
+  std::vector< size_t > next_stealable_chunk_;
+
+  //! Number of chunks each thread updated for other threads since the last prepare()
+  std::vector< long > stolen_update_chunks_;
+
   // private stop watches for benchmarking purposes
   Stopwatch< StopwatchGranularity::Normal, StopwatchParallelism::MasterOnly > sw_simulate_;
   Stopwatch< StopwatchGranularity::Normal, StopwatchParallelism::Threaded > sw_communicate_prepare_;
+  Stopwatch< StopwatchGranularity::Normal, StopwatchParallelism::Threaded > sw_update_per_thread_;
   // intended for internal core developers, not for use in the public API
   Stopwatch< StopwatchGranularity::Detailed, StopwatchParallelism::MasterOnly > sw_gather_spike_data_;
   Stopwatch< StopwatchGranularity::Detailed, StopwatchParallelism::MasterOnly > sw_gather_secondary_data_;
@@ -336,6 +387,12 @@ SimulationManager::get_wfr_interpolation_order() const
   return wfr_interpolation_order_;
 }
 
+inline bool
+SimulationManager::use_update_stealing() const
+{
+  return use_update_stealing_;
+}
+
 inline Time
 SimulationManager::get_eprop_update_interval() const
 {
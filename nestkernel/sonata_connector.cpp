@@ -26,10 +26,12 @@
 #ifdef HAVE_HDF5
 
 // C++ includes:
+#include <algorithm>
 #include <cstdlib> // for div()
 
 // Includes from nestkernel:
 #include "kernel_manager.h"
+#include "mpi_manager_impl.h"
 #include "vp_manager_impl.h"
 
 // Includes from sli:
@@ -52,7 +54,7 @@ SonataConnector::SonataConnector( const DictionaryDatum& graph_specs, const long
 
 SonataConnector::~SonataConnector()
 {
-  edge_type_id_2_syn_spec_.clear();
+  edge_type_params_.clear();
 }
 
 void
@@ -146,8 +148,16 @@ SonataConnector::connect()
       get_attribute_( source_attribute_value_, src_node_id_dset_, "node_population" );
       get_attribute_( target_attribute_value_, tgt_node_id_dset_, "node_population" );
 
-      // Read datasets sequentially in chunks and connect
-      sequential_chunkwise_connector_();
+      if ( kernel().mpi_manager.get_num_processes() > 1 )
+      {
+        // Share reading the datasets between the MPI processes
+        parallel_chunkwise_connector_( pop_grp );
+      }
+      else
+      {
+        // Read datasets sequentially in chunks and connect
+        sequential_chunkwise_connector_();
+      }
 
       close_dsets_();
 
@@ -167,7 +177,16 @@ SonataConnector::open_file_( std::string& fname )
   H5::H5File* file = nullptr;
   try
   {
-    file = new H5::H5File( fname, H5F_ACC_RDONLY );
+    H5::FileAccPropList fapl;
+#if defined( HAVE_MPI ) && defined( H5_HAVE_PARALLEL )
+    if ( kernel().mpi_manager.get_num_processes() > 1 )
+    {
+      // Open the file with the MPI-IO driver and read datasets collectively
+      H5Pset_fapl_mpio( fapl.getId(), kernel().mpi_manager.get_communicator(), MPI_INFO_NULL );
+      H5Pset_dxpl_mpio( xfer_plist_.getId(), H5FD_MPIO_COLLECTIVE );
+    }
+#endif
+    file = new H5::H5File( fname, H5F_ACC_RDONLY, H5::FileCreatPropList::DEFAULT, fapl );
   }
   catch ( const H5::Exception& e )
   {
@@ -379,105 +398,384 @@ SonataConnector::sequential_chunkwise_connector_()
 void
 SonataConnector::connect_chunk_( const hsize_t hyperslab_size, const hsize_t offset )
 {
+  EdgeData edges;
+  read_edges_( edges, { { offset, hyperslab_size } } );
+  create_connections_( edges );
+}
 
-  // Read subsets
-  std::vector< unsigned long > src_node_id_data_subset( hyperslab_size );
-  std::vector< unsigned long > tgt_node_id_data_subset( hyperslab_size );
-  std::vector< unsigned long > edge_type_id_data_subset( hyperslab_size );
-  std::vector< double > syn_weight_data_subset;
-  std::vector< double > delay_data_subset;
+void
+SonataConnector::parallel_chunkwise_connector_( const H5::Group* pop_grp )
+{
+  const bool has_target_index = H5Lexists( pop_grp->getId(), "indices", H5P_DEFAULT ) > 0
+    and H5Lexists( pop_grp->getId(), "indices/target_to_source", H5P_DEFAULT ) > 0;
 
-  read_subset_( src_node_id_dset_, src_node_id_data_subset, H5::PredType::NATIVE_LONG, hyperslab_size, offset );
-  read_subset_( tgt_node_id_dset_, tgt_node_id_data_subset, H5::PredType::NATIVE_LONG, hyperslab_size, offset );
-  read_subset_( edge_type_id_dset_, edge_type_id_data_subset, H5::PredType::NATIVE_LONG, hyperslab_size, offset );
+  if ( has_target_index )
+  {
+    parallel_indexed_connector_( pop_grp );
+  }
+  else
+  {
+    parallel_block_connector_();
+  }
+}
 
-  if ( weight_dataset_exist_ )
+void
+SonataConnector::parallel_indexed_connector_( const H5::Group* pop_grp )
+{
+  const auto index_grp = open_group_( pop_grp, "indices/target_to_source" );
+
+  // node_id_to_range holds for each target the first and last+1 row in range_to_edge_id,
+  // range_to_edge_id holds for each range the first and last+1 row of the edges in the range
+  std::vector< long > node_id_to_range;
+  std::vector< long > range_to_edge_id;
+  H5::DataSet node_id_to_range_dset;
+  H5::DataSet range_to_edge_id_dset;
+  try
   {
-    syn_weight_data_subset.resize( hyperslab_size );
-    read_subset_( syn_weight_dset_, syn_weight_data_subset, H5::PredType::NATIVE_DOUBLE, hyperslab_size, offset );
+    node_id_to_range_dset = index_grp->openDataSet( "node_id_to_range" );
+    range_to_edge_id_dset = index_grp->openDataSet( "range_to_edge_id" );
   }
-  if ( delay_dataset_exist_ )
+  catch ( const H5::Exception& e )
   {
-    delay_data_subset.resize( hyperslab_size );
-    read_subset_( delay_dset_, delay_data_subset, H5::PredType::NATIVE_DOUBLE, hyperslab_size, offset );
+    throw KernelException(
+      "Could not open target_to_source index datasets in " + cur_fname_ + ": " + e.getDetailMsg() );
   }
 
-  std::vector< std::shared_ptr< WrappedThreadException > > exceptions_raised_( kernel().vp_manager.get_num_threads() );
+  // Both index datasets are small compared to the edge datasets and are read completely by all processes
+  const auto num_targets = read_index_( node_id_to_range_dset, node_id_to_range );
+  read_index_( range_to_edge_id_dset, range_to_edge_id );
+  node_id_to_range_dset.close();
+  range_to_edge_id_dset.close();
+  index_grp->close();
 
-  // Retrieve the correct NodeCollections
-  const auto nest_nodes = getValue< DictionaryDatum >( graph_specs_->lookup( "nodes" ) );
+  // Collect the rows of the edges of all local targets
+  const auto tgt_nc = get_node_population_( target_attribute_value_, "target_node_id" );
+  const auto tnode_begin = tgt_nc->begin();
+  std::vector< std::pair< hsize_t, hsize_t > > edge_ranges;
+  for ( hsize_t sonata_tgt_id = 0; sonata_tgt_id < num_targets; ++sonata_tgt_id )
+  {
+    const size_t tnode_id = ( *( tnode_begin + sonata_tgt_id ) ).node_id;
+    if ( not kernel().node_manager.is_local_node_id( tnode_id ) )
+    {
+      continue;
+    }
+
+    const long ranges_begin = node_id_to_range[ 2 * sonata_tgt_id ];
+    const long ranges_end = node_id_to_range[ 2 * sonata_tgt_id + 1 ];
+    for ( long range = ranges_begin; range < ranges_end; ++range )
+    {
+      const long first_edge = range_to_edge_id[ 2 * range ];
+      const long last_edge = range_to_edge_id[ 2 * range + 1 ];
+      if ( last_edge > first_edge )
+      {
+        edge_ranges.emplace_back( first_edge, last_edge - first_edge );
+      }
+    }
+  }
+
+  // Merge adjacent ranges to keep the number of selected hyperslabs small
+  std::sort( edge_ranges.begin(), edge_ranges.end() );
+  std::vector< std::pair< hsize_t, hsize_t > > merged_ranges;
+  for ( const auto& range : edge_ranges )
+  {
+    if ( not merged_ranges.empty() and merged_ranges.back().first + merged_ranges.back().second == range.first )
+    {
+      merged_ranges.back().second += range.second;
+    }
+    else
+    {
+      merged_ranges.push_back( range );
+    }
+  }
+
+  // Split ranges into chunks of at most hyperslab_size_ rows
+  std::vector< std::vector< std::pair< hsize_t, hsize_t > > > chunks( 1 );
+  hsize_t chunk_size = 0;
+  for ( auto range : merged_ranges )
+  {
+    while ( range.second > 0 )
+    {
+      if ( chunk_size == hyperslab_size_ )
+      {
+        chunks.emplace_back();
+        chunk_size = 0;
+      }
+      const hsize_t num_rows = std::min( range.second, hyperslab_size_ - chunk_size );
+      chunks.back().emplace_back( range.first, num_rows );
+      chunk_size += num_rows;
+      range.first += num_rows;
+      range.second -= num_rows;
+    }
+  }
 
-  NodeCollectionPTR src_nc;
+  // With collective reads, all processes must read the same number of chunks
+  std::vector< long > num_chunks( 1, chunks.size() );
+  kernel().mpi_manager.communicate_Allreduce_max_in_place( num_chunks );
+  chunks.resize( num_chunks[ 0 ] );
 
+  for ( const auto& chunk : chunks )
+  {
+    EdgeData edges;
+    read_edges_( edges, chunk );
+    create_connections_( edges );
+  }
+}
+
+void
+SonataConnector::parallel_block_connector_()
+{
+  const auto num_conn = get_nrows_( tgt_node_id_dset_ );
+  const size_t num_processes = kernel().mpi_manager.get_num_processes();
+  const size_t rank = kernel().mpi_manager.get_rank();
+
+  // Each process reads a contiguous block of rows
+  const hsize_t block_begin = num_conn * rank / num_processes;
+  const hsize_t block_end = num_conn * ( rank + 1 ) / num_processes;
+
+  // All processes take part in the same number of reads and exchanges
+  const hsize_t max_block_size = ( num_conn + num_processes - 1 ) / num_processes;
+  const hsize_t num_chunks = ( max_block_size + hyperslab_size_ - 1 ) / hyperslab_size_;
+
+  const auto tgt_nc = get_node_population_( target_attribute_value_, "target_node_id" );
+  const auto tnode_begin = tgt_nc->begin();
+
+  std::vector< size_t > target_rank;
+  std::vector< int > send_counts( num_processes );
+  std::vector< EdgeRecord > send_buffer;
+  std::vector< EdgeRecord > recv_buffer;
+
+  for ( hsize_t chunk = 0; chunk < num_chunks; ++chunk )
+  {
+    const hsize_t chunk_begin = std::min( block_begin + chunk * hyperslab_size_, block_end );
+    const hsize_t chunk_end = std::min( chunk_begin + hyperslab_size_, block_end );
+
+    EdgeData edges;
+    if ( chunk_end > chunk_begin )
+    {
+      read_edges_( edges, { { chunk_begin, chunk_end - chunk_begin } } );
+    }
+    else
+    {
+      read_edges_( edges, {} );
+    }
+    const size_t num_edges = edges.target_node_ids.size();
+
+    // Sort edges by the rank owning their target
+    target_rank.resize( num_edges );
+    std::fill( send_counts.begin(), send_counts.end(), 0 );
+    for ( size_t i = 0; i < num_edges; ++i )
+    {
+      const size_t tnode_id = ( *( tnode_begin + edges.target_node_ids[ i ] ) ).node_id;
+      target_rank[ i ] = kernel().mpi_manager.get_process_id_of_node_id( tnode_id );
+      ++send_counts[ target_rank[ i ] ];
+    }
+
+    std::vector< size_t > send_position( num_processes, 0 );
+    for ( size_t r = 1; r < num_processes; ++r )
+    {
+      send_position[ r ] = send_position[ r - 1 ] + send_counts[ r - 1 ];
+    }
+
+    send_buffer.resize( num_edges );
+    for ( size_t i = 0; i < num_edges; ++i )
+    {
+      EdgeRecord& record = send_buffer[ send_position[ target_rank[ i ] ]++ ];
+      record.source_node_id = edges.source_node_ids[ i ];
+      record.target_node_id = edges.target_node_ids[ i ];
+      record.edge_type_id = edges.edge_type_ids[ i ];
+      record.syn_weight = weight_dataset_exist_ ? edges.syn_weights[ i ] : 0.0;
+      record.delay = delay_dataset_exist_ ? edges.delays[ i ] : 0.0;
+    }
+
+    kernel().mpi_manager.communicate_Alltoallv( send_buffer, send_counts, recv_buffer );
+
+    // Connect the edges received from all processes
+    EdgeData local_edges;
+    local_edges.source_node_ids.reserve( recv_buffer.size() );
+    local_edges.target_node_ids.reserve( recv_buffer.size() );
+    local_edges.edge_type_ids.reserve( recv_buffer.size() );
+    for ( const auto& record : recv_buffer )
+    {
+      local_edges.source_node_ids.push_back( record.source_node_id );
+      local_edges.target_node_ids.push_back( record.target_node_id );
+      local_edges.edge_type_ids.push_back( record.edge_type_id );
+      if ( weight_dataset_exist_ )
+      {
+        local_edges.syn_weights.push_back( record.syn_weight );
+      }
+      if ( delay_dataset_exist_ )
+      {
+        local_edges.delays.push_back( record.delay );
+      }
+    }
+
+    create_connections_( local_edges );
+  }
+}
+
+hsize_t
+SonataConnector::read_index_( const H5::DataSet& dataset, std::vector< long >& data_buf )
+{
   try
   {
-    src_nc = getValue< NodeCollectionPTR >( nest_nodes->lookup( source_attribute_value_ ) );
+    H5::DataSpace dspace = dataset.getSpace();
+    if ( dspace.getSimpleExtentNdims() != 2 )
+    {
+      throw KernelException( "Index datasets in " + cur_fname_ + " must be of shape N x 2" );
+    }
+    hsize_t dims[ 2 ];
+    dspace.getSimpleExtentDims( dims, NULL );
+    dspace.close();
+    if ( dims[ 1 ] != 2 )
+    {
+      throw KernelException( "Index datasets in " + cur_fname_ + " must be of shape N x 2" );
+    }
+
+    data_buf.resize( 2 * dims[ 0 ] );
+    if ( dims[ 0 ] > 0 )
+    {
+      dataset.read( data_buf.data(), H5::PredType::NATIVE_LONG, H5::DataSpace::ALL, H5::DataSpace::ALL, xfer_plist_ );
+    }
+    return dims[ 0 ];
+  }
+  catch ( const H5::Exception& e )
+  {
+    throw KernelException( "Unable to read index datasets in " + cur_fname_ + ": " + e.getDetailMsg() );
   }
-  catch ( const TypeMismatch& e )
+}
+
+void
+SonataConnector::read_edges_( EdgeData& edges, const std::vector< std::pair< hsize_t, hsize_t > >& ranges )
+{
+  read_ranges_( src_node_id_dset_, edges.source_node_ids, H5::PredType::NATIVE_LONG, ranges );
+  read_ranges_( tgt_node_id_dset_, edges.target_node_ids, H5::PredType::NATIVE_LONG, ranges );
+  read_ranges_( edge_type_id_dset_, edges.edge_type_ids, H5::PredType::NATIVE_LONG, ranges );
+
+  if ( weight_dataset_exist_ )
   {
-    throw KernelException(
-      "Unable to find source node population '" + source_attribute_value_ + "' in node collection dictionary. Error caused "
-      "by the population name specified by attribute of source_node_id dataset in "
-      + cur_fname_ );
+    read_ranges_( syn_weight_dset_, edges.syn_weights, H5::PredType::NATIVE_DOUBLE, ranges );
+  }
+  if ( delay_dataset_exist_ )
+  {
+    read_ranges_( delay_dset_, edges.delays, H5::PredType::NATIVE_DOUBLE, ranges );
   }
+}
+
+NodeCollectionPTR
+SonataConnector::get_node_population_( const std::string& population_name, const std::string& dset_name )
+{
+  const auto nest_nodes = getValue< DictionaryDatum >( graph_specs_->lookup( "nodes" ) );
 
-  NodeCollectionPTR tgt_nc;
   try
   {
-    tgt_nc = getValue< NodeCollectionPTR >( nest_nodes->lookup( target_attribute_value_ ) );
+    return getValue< NodeCollectionPTR >( nest_nodes->lookup( population_name ) );
   }
   catch ( const TypeMismatch& e )
   {
-    throw KernelException(
-      "Unable to find target node population '" + target_attribute_value_ + "' in node collection dictionary. Error caused "
-      "by the population name specified by attribute of target_node_id dataset in "
-      + cur_fname_ );
+    const std::string kind = dset_name == "source_node_id" ? "source" : "target";
+    throw KernelException( "Unable to find " + kind + " node population '" + population_name
+      + "' in node collection dictionary. Error caused by the population name specified by attribute of " + dset_name
+      + " dataset in " + cur_fname_ );
   }
+}
+
+void
+SonataConnector::create_connections_( const EdgeData& edges )
+{
+  const size_t num_threads = kernel().vp_manager.get_num_threads();
+  const size_t num_edges = edges.target_node_ids.size();
+
+  std::vector< std::shared_ptr< WrappedThreadException > > exceptions_raised_( num_threads );
+
+  // Retrieve the correct NodeCollections
+  const auto src_nc = get_node_population_( source_attribute_value_, "source_node_id" );
+  const auto tgt_nc = get_node_population_( target_attribute_value_, "target_node_id" );
 
   const auto snode_begin = src_nc->begin();
   const auto tnode_begin = tgt_nc->begin();
 
+  // Each thread sorts one chunk of the edges by the thread owning their target. Edges with
+  // targets on other processes are dropped. For each chunk, edge_indices[ chunk ][ tid ] holds
+  // the indices of the edges thread tid connects, in the order in which they appear in edges.
+  std::vector< std::vector< std::vector< size_t > > > edge_indices(
+    num_threads, std::vector< std::vector< size_t > >( num_threads ) );
+
 #pragma omp parallel
   {
     const auto tid = kernel().vp_manager.get_thread_id();
-    RngPtr rng = get_vp_specific_rng( tid );
 
     try
     {
-      // Iterate the datasets and create the connections
-      for ( hsize_t i = 0; i < hyperslab_size; ++i )
-      {
-
-        const auto sonata_tgt_id = tgt_node_id_data_subset[ i ];
-        const size_t tnode_id = ( *( tnode_begin + sonata_tgt_id ) ).node_id;
+      const size_t chunk_begin = num_edges * tid / num_threads;
+      const size_t chunk_end = num_edges * ( tid + 1 ) / num_threads;
 
-        if ( not kernel().vp_manager.is_node_id_vp_local( tnode_id ) )
+      for ( size_t i = chunk_begin; i < chunk_end; ++i )
+      {
+        const size_t tnode_id = ( *( tnode_begin + edges.target_node_ids[ i ] ) ).node_id;
+        const size_t vp = kernel().vp_manager.node_id_to_vp( tnode_id );
+        if ( kernel().vp_manager.is_local_vp( vp ) )
         {
-          continue;
+          edge_indices[ tid ][ kernel().vp_manager.vp_to_thread( vp ) ].push_back( i );
         }
+      }
+    }
+    catch ( std::exception& err )
+    {
+      // We must create a new exception here, err's lifetime ends at the end of the catch block.
+      exceptions_raised_.at( tid ) = std::shared_ptr< WrappedThreadException >( new WrappedThreadException( err ) );
+    }
 
-        const auto sonata_src_id = src_node_id_data_subset[ i ];
-        const size_t snode_id = ( *( snode_begin + sonata_src_id ) ).node_id;
-
-        Node* target = kernel().node_manager.get_node_or_proxy( tnode_id, tid );
-        const size_t target_thread = target->get_thread();
-
-        const auto edge_type_id = edge_type_id_data_subset[ i ];
-        const auto syn_spec = getValue< DictionaryDatum >( cur_edge_params_->lookup( std::to_string( edge_type_id ) ) );
-        const double weight =
-          get_syn_property_( syn_spec, i, weight_dataset_exist_, syn_weight_data_subset, names::weight );
-        const double delay = get_syn_property_( syn_spec, i, delay_dataset_exist_, delay_data_subset, names::delay );
+  } // end parallel region
 
-        get_synapse_params_( snode_id, *target, target_thread, rng, edge_type_id );
+  // Check if any exceptions have been raised
+  for ( size_t thr = 0; thr < num_threads; ++thr )
+  {
+    if ( exceptions_raised_.at( thr ).get() )
+    {
+      throw WrappedThreadException( *( exceptions_raised_.at( thr ) ) );
+    }
+  }
 
-        kernel().connection_manager.connect( snode_id,
-          target,
-          target_thread,
-          edge_type_id_2_syn_model_.at( edge_type_id ),
-          edge_type_id_2_param_dicts_.at( edge_type_id ).at( tid ),
-          delay,
-          weight );
+#pragma omp parallel
+  {
+    const auto tid = kernel().vp_manager.get_thread_id();
+    RngPtr rng = get_vp_specific_rng( tid );
 
+    try
+    {
+      // Iterate the edges of local targets of this thread and create the connections
+      for ( size_t chunk = 0; chunk < num_threads; ++chunk )
+      {
+        for ( const size_t i : edge_indices[ chunk ][ tid ] )
+        {
+          const size_t tnode_id = ( *( tnode_begin + edges.target_node_ids[ i ] ) ).node_id;
+          const size_t snode_id = ( *( snode_begin + edges.source_node_ids[ i ] ) ).node_id;
+
+          Node* target = kernel().node_manager.get_node_or_proxy( tnode_id, tid );
+          const size_t target_thread = target->get_thread();
+
+          const auto edge_type_id = edges.edge_type_ids[ i ];
+          const auto edge_type_it = edge_type_params_.find( edge_type_id );
+          if ( edge_type_it == edge_type_params_.end() )
+          {
+            throw KernelException( "Edge type id " + std::to_string( edge_type_id ) + " in " + cur_fname_
+              + " has no entry in syn_specs" );
+          }
+          const EdgeTypeParams& edge_type = edge_type_it->second;
+
+          const double weight = weight_dataset_exist_ ? edges.syn_weights[ i ] : edge_type.weight;
+          const double delay = delay_dataset_exist_ ? edges.delays[ i ] : edge_type.delay;
+
+          get_synapse_params_( snode_id, *target, target_thread, rng, edge_type );
+
+          kernel().connection_manager.connect( snode_id,
+            target,
+            target_thread,
+            edge_type.synapse_model_id,
+            edge_type.param_dicts[ tid ],
+            delay,
+            weight );
+        }
       } // end for
     }   // end try
 
@@ -490,7 +788,7 @@ SonataConnector::connect_chunk_( const hsize_t hyperslab_size, const hsize_t off
   } // end parallel region
 
   // Check if any exceptions have been raised
-  for ( size_t thr = 0; thr < kernel().vp_manager.get_num_threads(); ++thr )
+  for ( size_t thr = 0; thr < num_threads; ++thr )
   {
     if ( exceptions_raised_.at( thr ).get() )
     {
@@ -562,6 +860,52 @@ SonataConnector::read_subset_( const H5::DataSet& dataset,
   }
 }
 
+template < typename T >
+void
+SonataConnector::read_ranges_( const H5::DataSet& dataset,
+  std::vector< T >& data_buf,
+  H5::PredType datatype,
+  const std::vector< std::pair< hsize_t, hsize_t > >& ranges )
+{
+  hsize_t num_rows = 0;
+  for ( const auto& range : ranges )
+  {
+    num_rows += range.second;
+  }
+  data_buf.resize( num_rows );
+
+  // HDF5 requires a valid buffer and a memory space with non-zero size also if nothing is read
+  T dummy {};
+  T* buf = num_rows > 0 ? data_buf.data() : &dummy;
+  const hsize_t mspace_size = std::max( num_rows, static_cast< hsize_t >( 1 ) );
+
+  try
+  {
+    H5::DataSpace mspace( 1, &mspace_size, NULL );
+    H5::DataSpace dspace = dataset.getSpace();
+    if ( ranges.empty() )
+    {
+      mspace.selectNone();
+      dspace.selectNone();
+    }
+    else
+    {
+      dspace.selectHyperslab( H5S_SELECT_SET, &ranges[ 0 ].second, &ranges[ 0 ].first );
+      for ( size_t i = 1; i < ranges.size(); ++i )
+      {
+        dspace.selectHyperslab( H5S_SELECT_OR, &ranges[ i ].second, &ranges[ i ].first );
+      }
+    }
+    dataset.read( buf, datatype, mspace, dspace, xfer_plist_ );
+    mspace.close();
+    dspace.close();
+  }
+  catch ( const H5::Exception& e )
+  {
+    throw KernelException( "Unable to read datasets in " + cur_fname_ + ": " + e.getDetailMsg() );
+  }
+}
+
 void
 SonataConnector::create_edge_type_id_2_syn_spec_( DictionaryDatum edge_params )
 {
@@ -575,7 +919,6 @@ SonataConnector::create_edge_type_id_2_syn_spec_( DictionaryDatum edge_params )
     const size_t synapse_model_id = kernel().model_manager.get_synapse_model_id( syn_name );
 
     set_synapse_params_( d, synapse_model_id, type_id );
-    edge_type_id_2_syn_model_[ type_id ] = synapse_model_id;
   }
 }
 
@@ -583,7 +926,16 @@ void
 SonataConnector::set_synapse_params_( DictionaryDatum syn_dict, size_t synapse_model_id, int type_id )
 {
   DictionaryDatum syn_defaults = kernel().model_manager.get_connector_defaults( synapse_model_id );
-  ConnParameterMap synapse_params;
+  std::vector< Name > param_names;
+
+  EdgeTypeParams& edge_type = edge_type_params_[ type_id ];
+  edge_type.synapse_model_id = synapse_model_id;
+
+  // weight and delay are only looked up here, as they are the same for all edges of the type
+  edge_type.weight =
+    syn_dict->known( names::weight ) ? static_cast< double >( ( *syn_dict )[ names::weight ] ) : numerics::nan;
+  edge_type.delay =
+    syn_dict->known( names::delay ) ? static_cast< double >( ( *syn_dict )[ names::delay ] ) : numerics::nan;
 
   for ( Dictionary::const_iterator default_it = syn_defaults->begin(); default_it != syn_defaults->end(); ++default_it )
   {
@@ -595,16 +947,17 @@ SonataConnector::set_synapse_params_( DictionaryDatum syn_dict, size_t synapse_m
 
     if ( syn_dict->known( param_name ) )
     {
-
-      synapse_params[ param_name ] = std::shared_ptr< ConnParameter >(
-        ConnParameter::create( ( *syn_dict )[ param_name ], kernel().vp_manager.get_num_threads() ) );
+      param_names.push_back( param_name );
+      edge_type.params.push_back( std::shared_ptr< ConnParameter >(
+        ConnParameter::create( ( *syn_dict )[ param_name ], kernel().vp_manager.get_num_threads() ) ) );
     }
   }
 
   // Now create dictionary with dummy values that we will use to pass settings to the synapses created. We
-  // create it here once to avoid re-creating the object over and over again.
-  edge_type_id_2_param_dicts_[ type_id ].resize( kernel().vp_manager.get_num_threads(), nullptr );
-  edge_type_id_2_syn_spec_[ type_id ] = synapse_params;
+  // create it here once to avoid re-creating the object over and over again. The datums holding the values
+  // are stored alongside, so that they can be set without looking them up in the dictionary for each edge.
+  edge_type.param_dicts.resize( kernel().vp_manager.get_num_threads(), nullptr );
+  edge_type.param_datums.resize( kernel().vp_manager.get_num_threads() );
 
   // TODO: Once NEST is SLIless, the below loop over threads should be parallelizable. In order to parallelize, the
   // change would be to replace the for loop with #pragma omp parallel and get the thread id (tid) inside the parallel
@@ -613,18 +966,19 @@ SonataConnector::set_synapse_params_( DictionaryDatum syn_dict, size_t synapse_m
   // Note that this also applies to the equivalent loop in conn_builder.cpp
   for ( size_t tid = 0; tid < kernel().vp_manager.get_num_threads(); ++tid )
   {
-    edge_type_id_2_param_dicts_[ type_id ][ tid ] = new Dictionary;
+    edge_type.param_dicts[ tid ] = new Dictionary;
 
-    for ( auto param : synapse_params )
+    for ( size_t i = 0; i < edge_type.params.size(); ++i )
     {
-      if ( param.second->provides_long() )
+      if ( edge_type.params[ i ]->provides_long() )
       {
-        ( *edge_type_id_2_param_dicts_.at( type_id ).at( tid ) )[ param.first ] = Token( new IntegerDatum( 0 ) );
+        ( *edge_type.param_dicts[ tid ] )[ param_names[ i ] ] = Token( new IntegerDatum( 0 ) );
       }
       else
       {
-        ( *edge_type_id_2_param_dicts_.at( type_id ).at( tid ) )[ param.first ] = Token( new DoubleDatum( 0.0 ) );
+        ( *edge_type.param_dicts[ tid ] )[ param_names[ i ] ] = Token( new DoubleDatum( 0.0 ) );
       }
+      edge_type.param_datums[ tid ].push_back( ( *edge_type.param_dicts[ tid ] )[ param_names[ i ] ].datum() );
     }
   }
 }
@@ -634,62 +988,37 @@ SonataConnector::get_synapse_params_( size_t snode_id,
   Node& target,
   size_t target_thread,
   RngPtr rng,
-  int edge_type_id )
+  const EdgeTypeParams& edge_type )
 {
-  for ( auto const& syn_param : edge_type_id_2_syn_spec_.at( edge_type_id ) )
+  for ( size_t i = 0; i < edge_type.params.size(); ++i )
   {
-    const Name param_name = syn_param.first;
-    const auto param = syn_param.second;
+    const auto& param = edge_type.params[ i ];
 
+    // change value of dictionary entry without allocating new datum
     if ( param->provides_long() )
     {
-      // change value of dictionary entry without allocating new datum
-      IntegerDatum* dd = static_cast< IntegerDatum* >(
-        ( ( *edge_type_id_2_param_dicts_.at( edge_type_id ).at( target_thread ) )[ param_name ] ).datum() );
+      IntegerDatum* dd = static_cast< IntegerDatum* >( edge_type.param_datums[ target_thread ][ i ] );
       ( *dd ) = param->value_int( target_thread, rng, snode_id, &target );
     }
     else
     {
-      // change value of dictionary entry without allocating new datum
-      DoubleDatum* dd = static_cast< DoubleDatum* >(
-        ( ( *edge_type_id_2_param_dicts_.at( edge_type_id ).at( target_thread ) )[ param_name ] ).datum() );
+      DoubleDatum* dd = static_cast< DoubleDatum* >( edge_type.param_datums[ target_thread ][ i ] );
       ( *dd ) = param->value_double( target_thread, rng, snode_id, &target );
     }
   }
 }
 
-double
-SonataConnector::get_syn_property_( const DictionaryDatum& syn_spec,
-  hsize_t index,
-  const bool dataset_exists,
-  std::vector< double >& data,
-  const Name& name )
-{
-  if ( dataset_exists )
-  {
-    return data[ index ];
-  }
-  else if ( syn_spec->known( name ) )
-  {
-    return static_cast< double >( ( *syn_spec )[ name ] );
-  }
-  // default value is NaN
-  return numerics::nan;
-}
-
 void
 SonataConnector::reset_params_()
 {
-  edge_type_id_2_syn_model_.clear();
-  for ( auto syn_params_vec_map : edge_type_id_2_syn_spec_ )
+  for ( auto& edge_type : edge_type_params_ )
   {
-    for ( auto syn_params : syn_params_vec_map.second )
+    for ( auto& param : edge_type.second.params )
     {
-      syn_params.second->reset();
+      param->reset();
     }
   }
-  edge_type_id_2_syn_spec_.clear();
-  edge_type_id_2_param_dicts_.clear();
+  edge_type_params_.clear();
 }
 
 } // end namespace nest
@@ -62,6 +62,13 @@ namespace nest
  * serialize function calls. Since HDF5 does not provide support for
  * thread-parallel reading, only one thread per MPI process reads connectivity
  * data, before all threads create connections in parallel.
+ *
+ * @note With more than one MPI process, each process reads only part of the
+ * edges. If an edge population provides the `indices/target_to_source` index,
+ * each process reads only the edges of its local targets. Otherwise, each
+ * process reads a contiguous block of rows and sends the edges to the
+ * processes owning their targets. If NEST is linked against a parallel HDF5
+ * library, the files are opened with the MPI-IO driver and read collectively.
  */
 class SonataConnector
 {
@@ -82,6 +89,43 @@ public:
   void connect();
 
 private:
+  //! Connectivity data of a set of edges, with one entry per edge in each vector
+  struct EdgeData
+  {
+    std::vector< unsigned long > source_node_ids;
+    std::vector< unsigned long > target_node_ids;
+    std::vector< unsigned long > edge_type_ids;
+    std::vector< double > syn_weights; //!< only filled if weights are given as dataset
+    std::vector< double > delays;      //!< only filled if delays are given as dataset
+  };
+
+  //! Synapse properties of an edge type, resolved once per edge file
+  struct EdgeTypeParams
+  {
+    size_t synapse_model_id;
+    double weight; //!< weight given in syn_specs, NaN if not given
+    double delay;  //!< delay given in syn_specs, NaN if not given
+
+    //! Additional synapse parameters given in syn_specs
+    std::vector< std::shared_ptr< ConnParameter > > params;
+
+    //! Param dictionaries (one per thread) passed on when creating connections
+    std::vector< DictionaryDatum > param_dicts;
+
+    //! For each thread, the datums in param_dicts holding the values of params, in the same order
+    std::vector< std::vector< Datum* > > param_datums;
+  };
+
+  //! Data of a single edge, used to send edges to the process owning their target
+  struct EdgeRecord
+  {
+    unsigned long source_node_id;
+    unsigned long target_node_id;
+    unsigned long edge_type_id;
+    double syn_weight;
+    double delay;
+  };
+
   /**
    * @brief Open an HDF5 edge file.
    *
@@ -160,7 +204,8 @@ private:
   /**
    * @brief Set synapse parameters.
    *
-   * Set synapse parameters in edge_type_id_2_syn_spec_ and edge_type_id_2_param_dicts_.
+   * Resolve the synapse model, weight, delay and additional parameters of an
+   * edge type and store them in edge_type_params_.
    *
    * @param syn_dict Synapse dictionary from which to set synapse params.
    * @param synapse_model_id Model id of synapse
@@ -177,28 +222,13 @@ private:
    * @param target target node
    * @param target_thread thread of target
    * @param rng rng pointer of target thread
-   * @param edge_type_id type id of current edge to be connected
-   */
-  void get_synapse_params_( size_t snode_id, Node& target, size_t target_thread, RngPtr rng, int edge_type_id );
-
-  /**
-   * @brief Get synapse property.
-   *
-   * The synapse property, i.e., synaptic weight or delay, is either set
-   * from a HDF5 dataset or CSV entry. Default value is NaN.
-   *
-   * @param syn_spec synapse specification dictionary
-   * @param index the index to access in data
-   * @param dataset_exists bool indicating whether dataset exists
-   * @param data data from synaptic property HDF5 dataset
-   * @param name name of the synaptic property
-   * @return double
+   * @param edge_type synapse properties of the type of the current edge to be connected
    */
-  double get_syn_property_( const DictionaryDatum& syn_spec,
-    hsize_t index,
-    const bool dataset_exists,
-    std::vector< double >& data,
-    const Name& name );
+  void get_synapse_params_( size_t snode_id,
+    Node& target,
+    size_t target_thread,
+    RngPtr rng,
+    const EdgeTypeParams& edge_type );
 
   /**
    * @brief Manage the sequential chunkwise connections to be created.
@@ -212,6 +242,69 @@ private:
    */
   void connect_chunk_( const hsize_t hyperslab_size, const hsize_t offset );
 
+  /**
+   * @brief Manage the connections to be created if several MPI processes share the reading.
+   *
+   * Uses parallel_indexed_connector_() if the population group provides the
+   * target_to_source index, otherwise parallel_block_connector_().
+   *
+   * @param pop_grp Population group pointer.
+   */
+  void parallel_chunkwise_connector_( const H5::Group* pop_grp );
+
+  /**
+   * @brief Read and connect only the edges of local targets.
+   *
+   * Uses the target_to_source index of the population to find the rows of
+   * the edges of local targets, which are read in chunks of at most
+   * hyperslab_size_ rows.
+   *
+   * @param pop_grp Population group pointer.
+   */
+  void parallel_indexed_connector_( const H5::Group* pop_grp );
+
+  /**
+   * @brief Read a block of rows and send the edges to the processes owning their targets.
+   *
+   * Each process reads a contiguous block of rows in chunks of at most
+   * hyperslab_size_ rows. After each chunk, edges are exchanged with one
+   * Alltoallv and each process connects the edges it received.
+   */
+  void parallel_block_connector_();
+
+  /**
+   * @brief Read an index dataset of shape N x 2 completely.
+   * @param dataset Index dataset to read.
+   * @param data_buf Buffer to store the rows of the index one after the other.
+   * @return Number of rows N.
+   */
+  hsize_t read_index_( const H5::DataSet& dataset, std::vector< long >& data_buf );
+
+  /**
+   * @brief Read the edges in the given row ranges of the datasets.
+   * @param edges Buffer to store the edges in.
+   * @param ranges Sorted, disjoint row ranges given as pairs of offset and number of rows.
+   */
+  void read_edges_( EdgeData& edges, const std::vector< std::pair< hsize_t, hsize_t > >& ranges );
+
+  /**
+   * @brief Create the connections of the given edges with local targets.
+   *
+   * The edges are first sorted by the thread owning their target, so that
+   * each thread only visits the edges it creates connections for.
+   *
+   * @param edges Edges to connect.
+   */
+  void create_connections_( const EdgeData& edges );
+
+  /**
+   * @brief Get the NodeCollection of a node population.
+   * @param population_name Name of the node population.
+   * @param dset_name Name of the dataset the population name was read from, for error messages.
+   * @return NodeCollection of the population.
+   */
+  NodeCollectionPTR get_node_population_( const std::string& population_name, const std::string& dset_name );
+
   /**
    * @brief Read subset of dataset into memory.
    * @tparam T
@@ -228,6 +321,24 @@ private:
     hsize_t hyperslab_size,
     hsize_t offset );
 
+  /**
+   * @brief Read several row ranges of a dataset into memory.
+   *
+   * The selection may be empty, so that all processes can take part in
+   * collective reads.
+   *
+   * @tparam T
+   * @param dataset HDF5 dataset to read.
+   * @param data_buf Buffer to store data in memory, resized to the total number of rows.
+   * @param datatype Type of data in dataset.
+   * @param ranges Sorted, disjoint row ranges given as pairs of offset and number of rows.
+   */
+  template < typename T >
+  void read_ranges_( const H5::DataSet& dataset,
+    std::vector< T >& data_buf,
+    H5::PredType datatype,
+    const std::vector< std::pair< hsize_t, hsize_t > >& ranges );
+
   /**
    * @brief Find the number and names of edge groups.
    *
@@ -261,8 +372,6 @@ private:
    */
   void reset_params_();
 
-  typedef std::map< Name, std::shared_ptr< ConnParameter > > ConnParameterMap;
-
   //! synapse-specific parameters that should be skipped when we set default synapse parameters
   std::set< Name > skip_syn_params_;
 
@@ -287,14 +396,11 @@ private:
   //! Current edge parameters
   DictionaryDatum cur_edge_params_;
 
-  //! Map from edge type id (SONATA specification) to synapse model
-  std::map< int, size_t > edge_type_id_2_syn_model_;
-
-  //! Map from edge type id (SONATA specification) to synapse dictionary with ConnParameter's
-  std::map< int, ConnParameterMap > edge_type_id_2_syn_spec_;
+  //! Map from edge type id (SONATA specification) to synapse properties of the edge type
+  std::map< int, EdgeTypeParams > edge_type_params_;
 
-  //! Map from edge type id (SONATA specification) to param dictionaries (one per thread) used when creating connections
-  std::map< int, std::vector< DictionaryDatum > > edge_type_id_2_param_dicts_;
+  //! Transfer properties for reading datasets, collective if files are read with MPI-IO
+  H5::DSetMemXferPropList xfer_plist_;
 
   //! Datasets
   std::string cur_fname_;
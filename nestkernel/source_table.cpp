@@ -21,6 +21,7 @@
  */
 
 // C++ includes:
+#include <algorithm>
 #include <iostream>
 
 // Includes from nestkernel:
@@ -47,6 +48,8 @@ nest::SourceTable::initialize()
   const size_t num_threads = kernel().vp_manager.get_num_threads();
   sources_.resize( num_threads );
   is_cleared_.initialize( num_threads, false );
+  compressed_sources_.resize( num_threads );
+  is_compressed_.initialize( num_threads, false );
   saved_entry_point_.initialize( num_threads, false );
   current_positions_.resize( num_threads );
   saved_positions_.resize( num_threads );
@@ -56,6 +59,7 @@ nest::SourceTable::initialize()
   {
     const size_t tid = kernel().vp_manager.get_thread_id();
     sources_.at( tid ).resize( 0 );
+    compressed_sources_.at( tid ).resize( 0 );
     resize_sources();
     compressible_sources_.at( tid ).resize( 0 );
   } // of omp parallel
@@ -74,10 +78,12 @@ nest::SourceTable::finalize()
   }
 
   sources_.clear();
+  compressed_sources_.clear();
   current_positions_.clear();
   saved_positions_.clear();
   compressible_sources_.clear();
   compressed_spike_data_map_.clear();
+  first_new_source_index_.clear();
 }
 
 bool
@@ -86,9 +92,71 @@ nest::SourceTable::is_cleared() const
   return is_cleared_.all_true();
 }
 
+void
+nest::SourceTable::compress( const size_t tid )
+{
+  if ( is_compressed_[ tid ].is_true() )
+  {
+    return;
+  }
+
+  compressed_sources_[ tid ].resize( sources_[ tid ].size() );
+  for ( synindex syn_id = 0; syn_id < sources_[ tid ].size(); ++syn_id )
+  {
+    auto& runs = compressed_sources_[ tid ][ syn_id ];
+    runs.clear();
+
+    // entries can only be merged if they are identical, including their flags
+    size_t lcid = 0;
+    for ( const Source& source : sources_[ tid ][ syn_id ] )
+    {
+      ++lcid;
+      if ( not runs.empty() and runs.back().first.get_node_id() == source.get_node_id()
+        and runs.back().first.is_processed() == source.is_processed()
+        and runs.back().first.is_primary() == source.is_primary() )
+      {
+        runs.back().second = lcid;
+      }
+      else
+      {
+        runs.emplace_back( source, lcid );
+      }
+    }
+    runs.shrink_to_fit();
+    sources_[ tid ][ syn_id ].clear();
+  }
+
+  is_compressed_.set_true( tid );
+}
+
+void
+nest::SourceTable::expand_compressed_sources_( const size_t tid )
+{
+  for ( synindex syn_id = 0; syn_id < compressed_sources_[ tid ].size(); ++syn_id )
+  {
+    BlockVector< Source >& sources = sources_[ tid ][ syn_id ];
+    assert( sources.size() == 0 );
+
+    size_t lcid = 0;
+    for ( const auto& run : compressed_sources_[ tid ][ syn_id ] )
+    {
+      for ( ; lcid < run.second; ++lcid )
+      {
+        sources.push_back( run.first );
+      }
+    }
+
+    // release memory, clear() would retain the capacity
+    std::vector< std::pair< Source, size_t > >().swap( compressed_sources_[ tid ][ syn_id ] );
+  }
+
+  is_compressed_.set_false( tid );
+}
+
 std::vector< BlockVector< nest::Source > >&
 nest::SourceTable::get_thread_local_sources( const size_t tid )
 {
+  decompress_( tid );
   return sources_[ tid ];
 }
 
@@ -159,12 +227,18 @@ nest::SourceTable::get_node_id( const size_t tid, const synindex syn_id, const s
   {
     throw KernelException( "Cannot use SourceTable::get_node_id when get_keep_source_table is false" );
   }
+  if ( is_compressed_[ tid ].is_true() )
+  {
+    return find_compressed_run_( tid, syn_id, lcid ).first.get_node_id();
+  }
   return sources_[ tid ][ syn_id ][ lcid ].get_node_id();
 }
 
 size_t
 nest::SourceTable::remove_disabled_sources( const size_t tid, const synindex syn_id )
 {
+  decompress_( tid );
+
   if ( sources_[ tid ].size() <= syn_id )
   {
     return invalid_index; // no source table entry for this synapse model
@@ -197,21 +271,22 @@ nest::SourceTable::remove_disabled_sources( const size_t tid, const synindex syn
 
 void
 nest::SourceTable::compute_buffer_pos_for_unique_secondary_sources( const size_t tid,
-  std::map< size_t, size_t >& buffer_pos_of_source_node_id_syn_id )
+  std::vector< std::pair< size_t, size_t > >& buffer_pos_of_source_node_id_syn_id )
 {
-  // set of unique sources & synapse types, required to determine
+  // vector of unique sources & synapse types, required to determine
   // secondary events MPI buffer positions
   // initialized and deleted by thread 0 in this method
-  static std::set< std::pair< size_t, size_t > >* unique_secondary_source_node_id_syn_id;
+  static std::vector< std::pair< size_t, size_t > >* unique_secondary_source_node_id_syn_id;
 #pragma omp single
   {
-    unique_secondary_source_node_id_syn_id = new std::set< std::pair< size_t, size_t > >();
+    unique_secondary_source_node_id_syn_id = new std::vector< std::pair< size_t, size_t > >();
   }
 
-  // collect all unique pairs of source node ID and synapse-type id
-  // corresponding to continuous-data connections on this MPI rank;
-  // using a set makes sure secondary events are not duplicated for
-  // targets on the same process, but different threads
+  // collect all pairs of source node ID and synapse-type id
+  // corresponding to continuous-data connections on this thread;
+  // duplicates are removed locally before merging the pairs of all
+  // threads
+  std::vector< std::pair< size_t, size_t > > local_source_node_id_syn_id;
   for ( size_t syn_id = 0; syn_id < sources_[ tid ].size(); ++syn_id )
   {
     const ConnectorModel& conn_model = kernel().model_manager.get_connection_model( syn_id, tid );
@@ -223,34 +298,49 @@ nest::SourceTable::compute_buffer_pos_for_unique_secondary_sources( const size_t
             source_cit != sources_[ tid ][ syn_id ].end();
             ++source_cit )
       {
-#pragma omp critical
-        {
-          ( *unique_secondary_source_node_id_syn_id ).insert( std::make_pair( source_cit->get_node_id(), syn_id ) );
-        }
+        local_source_node_id_syn_id.emplace_back( source_cit->get_node_id(), syn_id );
       }
     }
   }
+  std::sort( local_source_node_id_syn_id.begin(), local_source_node_id_syn_id.end() );
+  local_source_node_id_syn_id.erase(
+    std::unique( local_source_node_id_syn_id.begin(), local_source_node_id_syn_id.end() ),
+    local_source_node_id_syn_id.end() );
+
+#pragma omp critical
+  {
+    unique_secondary_source_node_id_syn_id->insert( unique_secondary_source_node_id_syn_id->end(),
+      local_source_node_id_syn_id.begin(),
+      local_source_node_id_syn_id.end() );
+  }
   kernel().get_omp_synchronization_construction_stopwatch().start();
 #pragma omp barrier
   kernel().get_omp_synchronization_construction_stopwatch().stop();
 
 #pragma omp single
   {
+    // make sure secondary events are not duplicated for targets on
+    // the same process, but different threads
+    std::sort( unique_secondary_source_node_id_syn_id->begin(), unique_secondary_source_node_id_syn_id->end() );
+    unique_secondary_source_node_id_syn_id->erase(
+      std::unique( unique_secondary_source_node_id_syn_id->begin(), unique_secondary_source_node_id_syn_id->end() ),
+      unique_secondary_source_node_id_syn_id->end() );
+
     // compute receive buffer positions for all unique pairs of source
-    // node ID and synapse-type id on this MPI rank
+    // node ID and synapse-type id on this MPI rank; since the pairs are
+    // sorted, so are their packed representations
     std::vector< int > recv_counts_secondary_events_in_int_per_rank( kernel().mpi_manager.get_num_processes(), 0 );
 
-    for ( std::set< std::pair< size_t, size_t > >::const_iterator cit =
-            ( *unique_secondary_source_node_id_syn_id ).begin();
-          cit != ( *unique_secondary_source_node_id_syn_id ).end();
-          ++cit )
+    buffer_pos_of_source_node_id_syn_id.reserve( unique_secondary_source_node_id_syn_id->size() );
+    for ( const auto& source_node_id_syn_id : *unique_secondary_source_node_id_syn_id )
     {
-      const size_t source_rank = kernel().mpi_manager.get_process_id_of_node_id( cit->first );
-      const size_t event_size = kernel().model_manager.get_secondary_event_prototype( cit->second, tid ).size();
+      const size_t source_rank = kernel().mpi_manager.get_process_id_of_node_id( source_node_id_syn_id.first );
+      const size_t event_size =
+        kernel().model_manager.get_secondary_event_prototype( source_node_id_syn_id.second, tid ).size();
 
-      buffer_pos_of_source_node_id_syn_id.insert(
-        std::make_pair( pack_source_node_id_and_syn_id( cit->first, cit->second ),
-          recv_counts_secondary_events_in_int_per_rank[ source_rank ] ) );
+      buffer_pos_of_source_node_id_syn_id.emplace_back(
+        pack_source_node_id_and_syn_id( source_node_id_syn_id.first, source_node_id_syn_id.second ),
+        recv_counts_secondary_events_in_int_per_rank[ source_rank ] );
 
       recv_counts_secondary_events_in_int_per_rank[ source_rank ] += event_size;
     }
@@ -272,7 +362,12 @@ void
 nest::SourceTable::resize_sources()
 {
   kernel().vp_manager.assert_thread_parallel();
-  sources_.at( kernel().vp_manager.get_thread_id() ).resize( kernel().model_manager.get_num_connection_models() );
+  const size_t tid = kernel().vp_manager.get_thread_id();
+  sources_.at( tid ).resize( kernel().model_manager.get_num_connection_models() );
+  if ( is_compressed_[ tid ].is_true() )
+  {
+    compressed_sources_.at( tid ).resize( kernel().model_manager.get_num_connection_models() );
+  }
 }
 
 bool
@@ -434,24 +529,54 @@ nest::SourceTable::resize_compressible_sources()
   for ( size_t tid = 0; tid < static_cast< size_t >( compressible_sources_.size() ); ++tid )
   {
     compressible_sources_[ tid ].clear();
-    compressible_sources_[ tid ].resize(
-      kernel().model_manager.get_num_connection_models(), std::map< size_t, SpikeData >() );
+    compressible_sources_[ tid ].resize( kernel().model_manager.get_num_connection_models() );
+  }
+}
+
+void
+nest::SourceTable::resize_compressed_spike_data(
+  std::vector< std::vector< std::vector< SpikeData > > >& compressed_spike_data,
+  const std::vector< bool >& syn_ids )
+{
+  const size_t num_synapse_models = kernel().model_manager.get_num_connection_models();
+  compressed_spike_data.resize( num_synapse_models );
+  compressed_spike_data_map_.resize( num_synapse_models );
+
+  for ( synindex syn_id = 0; syn_id < num_synapse_models; ++syn_id )
+  {
+    if ( syn_ids[ syn_id ] )
+    {
+      compressed_spike_data[ syn_id ].clear();
+      compressed_spike_data_map_[ syn_id ].clear();
+    }
+  }
+
+  first_new_source_index_.resize( num_synapse_models );
+  for ( synindex syn_id = 0; syn_id < num_synapse_models; ++syn_id )
+  {
+    first_new_source_index_[ syn_id ] = compressed_spike_data_map_[ syn_id ].size();
   }
 }
 
 void
-nest::SourceTable::collect_compressible_sources( const size_t tid )
+nest::SourceTable::collect_compressible_sources( const size_t tid, const std::vector< bool >& syn_ids )
 {
   for ( synindex syn_id = 0; syn_id < sources_[ tid ].size(); ++syn_id )
   {
+    if ( not syn_ids[ syn_id ] )
+    {
+      continue;
+    }
+
     size_t lcid = 0;
     auto& syn_sources = sources_[ tid ][ syn_id ];
+    auto& syn_compressible_sources = compressible_sources_[ tid ][ syn_id ];
     while ( lcid < syn_sources.size() )
     {
       const size_t old_source_node_id = syn_sources[ lcid ].get_node_id();
-      const std::pair< size_t, SpikeData > source_node_id_to_spike_data =
-        std::make_pair( old_source_node_id, SpikeData( tid, syn_id, lcid, 0 ) );
-      compressible_sources_[ tid ][ syn_id ].insert( source_node_id_to_spike_data );
+      // Sources are sorted, so each source node ID is appended once and in increasing order.
+      assert( syn_compressible_sources.empty() or syn_compressible_sources.back().first < old_source_node_id );
+      syn_compressible_sources.emplace_back( old_source_node_id, SpikeData( tid, syn_id, lcid, 0 ) );
 
       // For all subsequent connections with same source, set "has more targets" on preceding connection.
       // Requires sorted connections.
@@ -510,51 +635,89 @@ nest::SourceTable::dump_compressible_sources() const
 }
 
 void
-nest::SourceTable::fill_compressed_spike_data(
-  std::vector< std::vector< std::vector< SpikeData > > >& compressed_spike_data )
+nest::SourceTable::fill_compressed_spike_data( const size_t tid,
+  std::vector< std::vector< std::vector< SpikeData > > >& compressed_spike_data,
+  const std::vector< bool >& syn_ids )
 {
-  const size_t num_synapse_models = kernel().model_manager.get_num_connection_models();
-  compressed_spike_data.clear();
-  compressed_spike_data.resize( num_synapse_models );
-  compressed_spike_data_map_.clear();
-  compressed_spike_data_map_.resize( num_synapse_models, std::map< size_t, CSDMapEntry >() );
+  const size_t num_threads = compressible_sources_.size();
 
   // For each synapse type, and for each source neuron with at least one local target,
   // store in compressed_spike_data one SpikeData entry for each local thread that
   // owns a local target. In compressed_spike_data_map_ store index into compressed_spike_data[syn_id]
-  // where data for a given source is stored.
-
-  // TODO: I believe that at this point compressible_sources_ is ordered by source gid.
-  //       Maybe one can exploit that to avoid searching with find() below.
-  for ( synindex syn_id = 0; syn_id < kernel().model_manager.get_num_connection_models(); ++syn_id )
+  // where data for a given source is stored. Synapse types are independent of each other and
+  // are distributed over threads.
+  for ( synindex syn_id = tid; syn_id < compressed_spike_data_map_.size(); syn_id += num_threads )
   {
-    for ( size_t target_thread = 0; target_thread < static_cast< size_t >( compressible_sources_.size() );
-          ++target_thread )
+    if ( not syn_ids[ syn_id ] )
     {
-      for ( const auto& connection : compressible_sources_[ target_thread ][ syn_id ] )
-      {
-        const auto source_gid = connection.first;
+      continue;
+    }
 
-        if ( compressed_spike_data_map_[ syn_id ].find( source_gid ) == compressed_spike_data_map_[ syn_id ].end() )
-        {
-          // Set up entry for new source
-          const auto new_source_index = compressed_spike_data[ syn_id ].size();
+    auto& csd_map = compressed_spike_data_map_[ syn_id ];
+    using CSDMapItem = std::pair< size_t, CSDMapEntry >;
+    const auto source_less = []( const CSDMapItem& lhs, const CSDMapItem& rhs ) { return lhs.first < rhs.first; };
 
-          compressed_spike_data[ syn_id ].emplace_back( kernel().vp_manager.get_num_threads(),
-            SpikeData( invalid_targetindex, invalid_synindex, invalid_lcid, 0 ) );
+    // Entries kept from earlier updates are sorted by source node ID and keep
+    // their source index, since the presynaptic side already addresses them.
+    const auto num_old_sources = csd_map.size();
+    assert( num_old_sources == first_new_source_index_[ syn_id ] );
 
-          compressed_spike_data_map_[ syn_id ].insert(
-            std::make_pair( source_gid, CSDMapEntry( new_source_index, target_thread ) ) );
+    // Collect the sources of all threads that are not in the map yet, sorted by
+    // source node ID and, for equal sources, by thread. Keeping only the first
+    // entry of each source yields the first thread with a target of this source,
+    // in thread order.
+    for ( size_t target_thread = 0; target_thread < num_threads; ++target_thread )
+    {
+      for ( const auto& connection : compressible_sources_[ target_thread ][ syn_id ] )
+      {
+        const CSDMapItem item( connection.first, CSDMapEntry( 0, target_thread ) );
+        if ( not std::binary_search( csd_map.begin(), csd_map.begin() + num_old_sources, item, source_less ) )
+        {
+          csd_map.push_back( item );
         }
+      }
+    }
+    const auto source_then_thread_less = []( const CSDMapItem& lhs, const CSDMapItem& rhs )
+    {
+      return lhs.first < rhs.first
+        or ( lhs.first == rhs.first and lhs.second.get_target_thread() < rhs.second.get_target_thread() );
+    };
+    const auto same_source = []( const CSDMapItem& lhs, const CSDMapItem& rhs ) { return lhs.first == rhs.first; };
+    const auto new_sources_begin = csd_map.begin() + num_old_sources;
+    std::sort( new_sources_begin, csd_map.end(), source_then_thread_less );
+    csd_map.erase( std::unique( new_sources_begin, csd_map.end(), same_source ), csd_map.end() );
+    csd_map.shrink_to_fit();
+
+    // Source indices of new sources follow the order of their source node IDs
+    for ( size_t source_index = num_old_sources; source_index < csd_map.size(); ++source_index )
+    {
+      csd_map[ source_index ].second = CSDMapEntry( source_index, csd_map[ source_index ].second.get_target_thread() );
+    }
+    std::inplace_merge( csd_map.begin(), csd_map.begin() + num_old_sources, csd_map.end(), source_less );
 
-        const auto source_index = compressed_spike_data_map_[ syn_id ].find( source_gid )->second.get_source_index();
+    // Connections of existing sources may have moved while sorting, so all entries are filled anew
+    compressed_spike_data[ syn_id ].assign( csd_map.size(),
+      std::vector< SpikeData >( num_threads, SpikeData( invalid_targetindex, invalid_synindex, invalid_lcid, 0 ) ) );
 
-        assert( compressed_spike_data[ syn_id ][ source_index ][ target_thread ].get_lcid() == invalid_lcid );
+    // Both the sources of each thread and the map are sorted by source node ID,
+    // so the map entry of each connection is found by advancing through the map.
+    for ( size_t target_thread = 0; target_thread < num_threads; ++target_thread )
+    {
+      size_t map_idx = 0;
+      for ( const auto& connection : compressible_sources_[ target_thread ][ syn_id ] )
+      {
+        while ( csd_map[ map_idx ].first < connection.first )
+        {
+          ++map_idx;
+        }
+        assert( csd_map[ map_idx ].first == connection.first );
+        auto& spike_data = compressed_spike_data[ syn_id ][ csd_map[ map_idx ].second.get_source_index() ];
+        assert( spike_data[ target_thread ].get_lcid() == invalid_lcid );
 
-        compressed_spike_data[ syn_id ][ source_index ][ target_thread ] = connection.second;
+        spike_data[ target_thread ] = connection.second;
       } // for connection
 
-      compressible_sources_[ target_thread ][ syn_id ].clear();
+      std::vector< std::pair< size_t, SpikeData > >().swap( compressible_sources_[ target_thread ][ syn_id ] );
 
     } // for target_thread
   }   // for syn_id
@@ -27,8 +27,7 @@
 #include <algorithm>
 #include <cassert>
 #include <iostream>
-#include <map>
-#include <set>
+#include <utility>
 #include <vector>
 
 // Includes from nestkernel:
@@ -99,6 +98,10 @@ using success_csdmapentry_size = StaticAssert< sizeof( CSDMapEntry ) == 8 >::suc
  * After all connections have been created, the information stored in
  * this structure is transferred to the presynaptic side and the
  * sources vector can be cleared.
+ *
+ * If the sources are kept, they can instead be compressed into runs
+ * of consecutive entries with the same source, which are expanded again
+ * once connections are added, removed or restructured.
  */
 class SourceTable
 {
@@ -115,6 +118,20 @@ private:
    */
   PerThreadBoolIndicator is_cleared_;
 
+  /**
+   * Run-length encoded sources, arranged like sources_. Each run stores
+   * the source entry and the local connection id one past its last
+   * entry, i.e., the cumulative number of entries up to and including
+   * the run. Sorted sources have at most one run per source node.
+   */
+  std::vector< std::vector< std::vector< std::pair< Source, size_t > > > > compressed_sources_;
+
+  /**
+   * Whether the sources of a thread are stored in compressed_sources_
+   * instead of sources_.
+   */
+  PerThreadBoolIndicator is_compressed_;
+
   //! Needed during readout of sources_.
   std::vector< SourceTablePosition > current_positions_;
   //! Needed during readout of sources_.
@@ -171,6 +188,23 @@ private:
     const size_t source_rank,
     TargetData& next_target_data ) const;
 
+  /**
+   * Restores sources_ from compressed_sources_ if the sources of this
+   * thread are compressed.
+   */
+  void decompress_( const size_t tid );
+
+  //! Restores sources_ from compressed_sources_, see decompress_().
+  void expand_compressed_sources_( const size_t tid );
+
+  /**
+   * Returns the run in compressed_sources_ that contains the given
+   * local connection id.
+   */
+  const std::pair< Source, size_t >& find_compressed_run_( const size_t tid,
+    const synindex syn_id,
+    const size_t lcid ) const;
+
   /**
    * A structure to temporarily hold information about all process
    * local targets will be addressed by incoming spikes.
@@ -178,10 +212,10 @@ private:
    * Data from this structure is transferred to the compressed_spike_data_
    * structure of ConnectionManager during construction of the
    * postsynaptic connection infrastructure. Arranged as a two
-   * dimensional vector (thread|synapse) with an inner map (source
-   * node id -> spike data).
+   * dimensional vector (thread|synapse) with an inner vector of
+   * (source node id, spike data) pairs sorted by source node id.
    */
-  std::vector< std::vector< std::map< size_t, SpikeData > > > compressible_sources_;
+  std::vector< std::vector< std::vector< std::pair< size_t, SpikeData > > > > compressible_sources_;
 
   /**
    * A structure to temporarily store locations of "unpacked spikes"
@@ -191,9 +225,24 @@ private:
    * Data from this structure is transferred to the
    * presynaptic side during construction of the presynaptic
    * connection infrastructure. Arranged as a one-dimensional vector
-   * over synapse ids with an inner map (source node id -> (source_index+target_thread).
+   * over synapse ids with an inner vector of (source node id, (source_index+target_thread))
+   * pairs sorted by source node id.
+   *
+   * Flat sorted vectors are used instead of maps, because they require no
+   * per-entry allocation and pointer overhead, which dominates memory and
+   * construction time for large numbers of sources.
    */
-  std::vector< std::map< size_t, CSDMapEntry > > compressed_spike_data_map_;
+  std::vector< std::vector< std::pair< size_t, CSDMapEntry > > > compressed_spike_data_map_;
+
+  /**
+   * For each synapse type, the first source index added in the current
+   * update of the connection infrastructure.
+   *
+   * Entries with smaller source indices were communicated to the
+   * presynaptic side in an earlier update and keep their source index,
+   * so they are not exchanged again.
+   */
+  std::vector< size_t > first_new_source_index_;
 
 public:
   SourceTable();
@@ -214,6 +263,11 @@ public:
    */
   void add_source( const size_t tid, const synindex syn_id, const size_t node_id, const bool is_primary );
 
+  /**
+   * Reserves space for count further sources in sources_.
+   */
+  void reserve( const size_t tid, const synindex syn_id, const size_t count );
+
   /**
    * Clears sources_.
    */
@@ -224,6 +278,14 @@ public:
    */
   bool is_cleared() const;
 
+  /**
+   * Replaces sources_ by run-length encoded compressed_sources_.
+   *
+   * Must only be called once all sources of this thread have been
+   * processed.
+   */
+  void compress( const size_t tid );
+
   /**
    * Returns the next target data, according to the current_positions_.
    */
@@ -272,10 +334,11 @@ public:
   SourceTablePosition find_maximal_position() const;
 
   /**
-   * Resets all processed flags. Needed for restructuring connection
-   * tables, e.g., during structural plasticity update.
+   * Resets the processed flags of all synapse types flagged in syn_ids.
+   * Needed for restructuring connection tables, e.g., during structural
+   * plasticity update.
    */
-  void reset_processed_flags( const size_t tid );
+  void reset_processed_flags( const size_t tid, const std::vector< bool >& syn_ids );
 
   /**
    * Removes all entries marked as processed.
@@ -294,7 +357,7 @@ public:
    * connections.
    */
   void compute_buffer_pos_for_unique_secondary_sources( const size_t tid,
-    std::map< size_t, size_t >& buffer_pos_of_source_node_id_syn_id_ );
+    std::vector< std::pair< size_t, size_t > >& buffer_pos_of_source_node_id_syn_id_ );
 
   /**
    * Finds the first entry in sources_ at the given thread id and
@@ -343,11 +406,18 @@ public:
   size_t pack_source_node_id_and_syn_id( const size_t source_node_id, const synindex syn_id ) const;
 
   void resize_compressible_sources();
-
-  // creates maps of sources with more than one thread-local target
-  void collect_compressible_sources( const size_t tid );
-  // fills the compressed_spike_data structure in ConnectionManager
-  void fill_compressed_spike_data( std::vector< std::vector< std::vector< SpikeData > > >& compressed_spike_data );
+  // resizes the compressed_spike_data structure in ConnectionManager and compressed_spike_data_map_, clearing the
+  // entries of the synapse types flagged in syn_ids; entries of other synapse types are kept and extended
+  void resize_compressed_spike_data( std::vector< std::vector< std::vector< SpikeData > > >& compressed_spike_data,
+    const std::vector< bool >& syn_ids );
+
+  // creates sorted vectors of sources with more than one thread-local target for the synapse types flagged in syn_ids
+  void collect_compressible_sources( const size_t tid, const std::vector< bool >& syn_ids );
+  // fills the compressed_spike_data structure in ConnectionManager for the synapse types flagged in syn_ids,
+  // appending sources not yet in compressed_spike_data_map_; synapse types are distributed over threads
+  void fill_compressed_spike_data( const size_t tid,
+    std::vector< std::vector< std::vector< SpikeData > > >& compressed_spike_data,
+    const std::vector< bool >& syn_ids );
 
   void clear_compressed_spike_data_map();
 
@@ -360,10 +430,19 @@ public:
 inline void
 SourceTable::add_source( const size_t tid, const synindex syn_id, const size_t node_id, const bool is_primary )
 {
+  decompress_( tid );
   const Source src( node_id, is_primary );
   sources_[ tid ][ syn_id ].push_back( src );
 }
 
+inline void
+SourceTable::reserve( const size_t tid, const synindex syn_id, const size_t count )
+{
+  decompress_( tid );
+  BlockVector< Source >& sources = sources_[ tid ][ syn_id ];
+  sources.reserve( sources.size() + count );
+}
+
 inline void
 SourceTable::clear( const size_t tid )
 {
@@ -372,6 +451,8 @@ SourceTable::clear( const size_t tid )
     it->clear();
   }
   sources_[ tid ].clear();
+  compressed_sources_[ tid ].clear();
+  is_compressed_.set_false( tid );
   is_cleared_.set_true( tid );
 }
 
@@ -451,13 +532,20 @@ SourceTable::reset_entry_point( const size_t tid )
 }
 
 inline void
-SourceTable::reset_processed_flags( const size_t tid )
+SourceTable::reset_processed_flags( const size_t tid, const std::vector< bool >& syn_ids )
 {
-  for ( std::vector< BlockVector< Source > >::iterator it = sources_[ tid ].begin(); it != sources_[ tid ].end(); ++it )
+  decompress_( tid );
+
+  for ( synindex syn_id = 0; syn_id < sources_[ tid ].size(); ++syn_id )
   {
-    for ( BlockVector< Source >::iterator iit = it->begin(); iit != it->end(); ++iit )
+    if ( not syn_ids[ syn_id ] )
+    {
+      continue;
+    }
+
+    for ( Source& source : sources_[ tid ][ syn_id ] )
     {
-      iit->set_processed( false );
+      source.set_processed( false );
     }
   }
 }
@@ -473,6 +561,29 @@ SourceTable::no_targets_to_process( const size_t tid )
 inline size_t
 SourceTable::find_first_source( const size_t tid, const synindex syn_id, const size_t snode_id ) const
 {
+  if ( is_compressed_[ tid ].is_true() )
+  {
+    // binary search in runs of sorted sources, the first entry of a run
+    // starts where the previous run ends
+    const auto& runs = compressed_sources_[ tid ][ syn_id ];
+    const auto run_before_node_id = []( const std::pair< Source, size_t >& run, const size_t node_id )
+    {
+      return run.first.get_node_id() < node_id;
+    };
+    auto run = std::lower_bound( runs.begin(), runs.end(), snode_id, run_before_node_id );
+
+    while ( run != runs.end() )
+    {
+      if ( run->first.get_node_id() == snode_id and not run->first.is_disabled() )
+      {
+        return run == runs.begin() ? 0 : ( run - 1 )->second;
+      }
+      ++run;
+    }
+
+    return invalid_index;
+  }
+
   // binary search in sorted sources
   const BlockVector< Source >::const_iterator begin = sources_[ tid ][ syn_id ].begin();
   const BlockVector< Source >::const_iterator end = sources_[ tid ][ syn_id ].end();
@@ -499,6 +610,7 @@ SourceTable::disable_connection( const size_t tid, const synindex syn_id, const
 {
   // disabling a source changes its node ID to 2^62 -1
   // source here
+  decompress_( tid );
   assert( not sources_[ tid ][ syn_id ][ lcid ].is_disabled() );
   sources_[ tid ][ syn_id ][ lcid ].disable();
 }
@@ -509,6 +621,15 @@ SourceTable::get_source_node_ids( const size_t tid,
   const std::vector< size_t >& source_lcids,
   std::vector< size_t >& sources )
 {
+  if ( is_compressed_[ tid ].is_true() )
+  {
+    for ( const size_t lcid : source_lcids )
+    {
+      sources.push_back( find_compressed_run_( tid, syn_id, lcid ).first.get_node_id() );
+    }
+    return;
+  }
+
   for ( std::vector< size_t >::const_iterator cit = source_lcids.begin(); cit != source_lcids.end(); ++cit )
   {
     sources.push_back( sources_[ tid ][ syn_id ][ *cit ].get_node_id() );
@@ -520,6 +641,19 @@ SourceTable::num_unique_sources( const size_t tid, const synindex syn_id ) const
 {
   size_t n = 0;
   size_t last_source = 0;
+  if ( is_compressed_[ tid ].is_true() )
+  {
+    for ( const auto& run : compressed_sources_[ tid ][ syn_id ] )
+    {
+      if ( last_source != run.first.get_node_id() )
+      {
+        last_source = run.first.get_node_id();
+        ++n;
+      }
+    }
+    return n;
+  }
+
   for ( BlockVector< Source >::const_iterator cit = sources_[ tid ][ syn_id ].begin();
         cit != sources_[ tid ][ syn_id ].end();
         ++cit )
@@ -543,12 +677,35 @@ SourceTable::pack_source_node_id_and_syn_id( const size_t source_node_id, const
   return ( source_node_id << 8 ) + syn_id;
 }
 
+inline void
+SourceTable::decompress_( const size_t tid )
+{
+  if ( is_compressed_[ tid ].is_true() )
+  {
+    expand_compressed_sources_( tid );
+  }
+}
+
+inline const std::pair< Source, size_t >&
+SourceTable::find_compressed_run_( const size_t tid, const synindex syn_id, const size_t lcid ) const
+{
+  // first run that ends after lcid
+  const auto& runs = compressed_sources_[ tid ][ syn_id ];
+  const auto run = std::upper_bound( runs.begin(),
+    runs.end(),
+    lcid,
+    []( const size_t lcid, const std::pair< Source, size_t >& run ) { return lcid < run.second; } );
+  assert( run != runs.end() );
+  return *run;
+}
+
 inline void
 SourceTable::clear_compressed_spike_data_map()
 {
   for ( auto& source_index_map : compressed_spike_data_map_ )
   {
-    source_index_map.clear();
+    // release memory, clear() would retain the capacity
+    std::vector< std::pair< size_t, CSDMapEntry > >().swap( source_index_map );
   }
 }
 
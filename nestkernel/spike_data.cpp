@@ -0,0 +1,118 @@
+/*
+ *  spike_data.cpp
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "spike_data.h"
+
+// C++ includes:
+#include <algorithm>
+
+namespace nest
+{
+
+// Layout for a single thread, synapse type and lag, set_layout() is called before spikes are exchanged
+unsigned int CompactSpikeData::lag_shift_ = NUM_BITS_MARKER_SPIKE_DATA;
+unsigned int CompactSpikeData::tid_shift_ = NUM_BITS_MARKER_SPIKE_DATA;
+unsigned int CompactSpikeData::syn_id_shift_ = NUM_BITS_MARKER_SPIKE_DATA;
+unsigned int CompactSpikeData::lcid_shift_ = NUM_BITS_MARKER_SPIKE_DATA;
+uint32_t CompactSpikeData::lag_mask_ = 0;
+uint32_t CompactSpikeData::tid_mask_ = 0;
+uint32_t CompactSpikeData::syn_id_mask_ = 0;
+uint32_t CompactSpikeData::lcid_mask_ = generate_max_value( NUM_BITS_LCID );
+
+unsigned int
+CompactSpikeData::num_bits_( size_t value )
+{
+  unsigned int num_bits = 0;
+  while ( value > 0 )
+  {
+    value >>= 1;
+    ++num_bits;
+  }
+  return num_bits;
+}
+
+bool
+CompactSpikeData::set_layout( const size_t max_lag,
+  const size_t max_tid,
+  const size_t max_syn_id,
+  const size_t max_lcid )
+{
+  const unsigned int num_bits_lag = num_bits_( max_lag );
+  const unsigned int num_bits_tid = num_bits_( max_tid );
+  const unsigned int num_bits_syn_id = num_bits_( max_syn_id );
+  const unsigned int num_bits_used = NUM_BITS_MARKER_SPIKE_DATA + num_bits_lag + num_bits_tid + num_bits_syn_id;
+
+  // The local connection index needs at least one bit and gets all remaining ones
+  const unsigned int num_bits_lcid = std::max( 1U, num_bits_( max_lcid ) );
+  if ( num_bits_used + num_bits_lcid > NUM_BITS_COMPACT_SPIKE_DATA )
+  {
+    return false;
+  }
+
+  lag_shift_ = NUM_BITS_MARKER_SPIKE_DATA;
+  tid_shift_ = lag_shift_ + num_bits_lag;
+  syn_id_shift_ = tid_shift_ + num_bits_tid;
+  lcid_shift_ = syn_id_shift_ + num_bits_syn_id;
+  lag_mask_ = generate_max_value( num_bits_lag );
+  tid_mask_ = generate_max_value( num_bits_tid );
+  syn_id_mask_ = generate_max_value( num_bits_syn_id );
+  lcid_mask_ = generate_max_value(
+    std::min( NUM_BITS_COMPACT_SPIKE_DATA - num_bits_used, static_cast< unsigned int >( NUM_BITS_LCID ) ) );
+
+  return true;
+}
+
+bool
+CompactSpikeData::fits_layout( const size_t max_lag,
+  const size_t max_tid,
+  const size_t max_syn_id,
+  const size_t max_lcid )
+{
+  return max_lag <= lag_mask_ and max_tid <= tid_mask_ and max_syn_id <= syn_id_mask_ and max_lcid <= lcid_mask_;
+}
+
+SpikeData
+CompactSpikeData::expand() const
+{
+  if ( is_complete_marker() or is_invalid_marker() )
+  {
+    SpikeData spike_data;
+    if ( is_complete_marker() )
+    {
+      spike_data.set_complete_marker();
+    }
+    else
+    {
+      spike_data.set_invalid_marker();
+    }
+    return spike_data;
+  }
+
+  SpikeData spike_data( get_tid(), get_syn_id(), get_lcid(), get_lag() );
+  if ( is_end_marker() )
+  {
+    spike_data.set_end_marker();
+  }
+  return spike_data;
+}
+
+} // namespace nest
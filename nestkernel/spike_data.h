@@ -123,10 +123,22 @@ public:
 
   /**
    * Sets lcid value.
+   */
+  void set_lcid( size_t );
+
+  /**
+   * Returns the largest number of spikes the sending rank needs to transmit to any rank.
+   *
+   * @note Only meaningful in endpos entries with COMPLETE or INVALID marker, see above.
+   */
+  size_t get_local_max_spikes_per_rank() const;
+
+  /**
+   * Sets the largest number of spikes this rank needs to transmit to any rank.
    *
    * @note Allows each rank to send the locally required buffer size per rank.
    */
-  void set_lcid( size_t );
+  void set_local_max_spikes_per_rank( size_t );
 
   /**
    * Returns lag in min-delay interval.
@@ -281,6 +293,18 @@ SpikeData::set_lcid( size_t value )
   lcid_ = value;
 }
 
+inline size_t
+SpikeData::get_local_max_spikes_per_rank() const
+{
+  return lcid_;
+}
+
+inline void
+SpikeData::set_local_max_spikes_per_rank( size_t value )
+{
+  set_lcid( value );
+}
+
 inline unsigned int
 SpikeData::get_lag() const
 {
@@ -469,6 +493,229 @@ OffGridSpikeData::get_offset() const
 }
 
 
+/**
+ * Used to communicate spikes in 32 bits if all fields fit.
+ *
+ * The word holds marker, lag, thread index, synapse-type index and local connection index, from the least
+ * significant bit upwards. The width of all fields except the marker is set at run time by set_layout() from the
+ * largest values that can occur in a simulation, and is the same on all ranks. The local connection index takes
+ * all remaining bits, up to NUM_BITS_LCID, so that connections can be added without changing the layout.
+ *
+ * Entries carrying only the local_max_spikes_per_rank (see above) use all bits above the marker for this value.
+ *
+ * @see SpikeData
+ */
+class CompactSpikeData
+{
+private:
+  static constexpr unsigned int NUM_BITS_COMPACT_SPIKE_DATA = 32;
+  static constexpr uint32_t MARKER_MASK = generate_max_value( NUM_BITS_MARKER_SPIKE_DATA );
+
+  static unsigned int lag_shift_;
+  static unsigned int tid_shift_;
+  static unsigned int syn_id_shift_;
+  static unsigned int lcid_shift_;
+  static uint32_t lag_mask_;
+  static uint32_t tid_mask_;
+  static uint32_t syn_id_mask_;
+  static uint32_t lcid_mask_;
+
+  uint32_t data_;
+
+  uint32_t get_field_( const unsigned int shift, const uint32_t mask ) const;
+  void set_field_( const unsigned int shift, const uint32_t mask, const size_t value );
+
+  //! Returns the number of bits required to represent value.
+  static unsigned int num_bits_( size_t value );
+
+public:
+  CompactSpikeData();
+  CompactSpikeData( const CompactSpikeData& rhs ) = default;
+  CompactSpikeData& operator=( const CompactSpikeData& rhs ) = default;
+
+  //! Encodes entry of a spike register or of the send buffer in full encoding.
+  CompactSpikeData& operator=( const SpikeData& rhs );
+
+  /**
+   * Sets field widths so that the given maximal values can be represented.
+   *
+   * @returns false, leaving the layout unchanged, if the fields do not fit into 32 bits.
+   */
+  static bool set_layout( const size_t max_lag, const size_t max_tid, const size_t max_syn_id, const size_t max_lcid );
+
+  //! Returns whether the given maximal values can be represented in the current layout.
+  static bool fits_layout( const size_t max_lag, const size_t max_tid, const size_t max_syn_id, const size_t max_lcid );
+
+  template < class TargetT >
+  void set( const TargetT& target, const unsigned int lag );
+
+  /**
+   * Returns entry in full encoding.
+   *
+   * @note The local_max_spikes_per_rank of entries with COMPLETE or INVALID marker is not retained, since it is
+   *       only required while spikes are exchanged.
+   */
+  SpikeData expand() const;
+
+  size_t get_lcid() const;
+  void set_lcid( size_t );
+  size_t get_local_max_spikes_per_rank() const;
+  void set_local_max_spikes_per_rank( size_t );
+  unsigned int get_lag() const;
+  size_t get_tid() const;
+  synindex get_syn_id() const;
+  unsigned int get_marker() const;
+  void reset_marker();
+  void set_complete_marker();
+  void set_end_marker();
+  void set_invalid_marker();
+  bool is_complete_marker() const;
+  bool is_end_marker() const;
+  bool is_invalid_marker() const;
+  double get_offset() const;
+};
+
+//! check legal size
+using success_compact_spike_data_size = StaticAssert< sizeof( CompactSpikeData ) == 4 >::success;
+
+inline CompactSpikeData::CompactSpikeData()
+  : data_( SPIKE_DATA_ID_DEFAULT )
+{
+}
+
+inline uint32_t
+CompactSpikeData::get_field_( const unsigned int shift, const uint32_t mask ) const
+{
+  return ( data_ >> shift ) & mask;
+}
+
+inline void
+CompactSpikeData::set_field_( const unsigned int shift, const uint32_t mask, const size_t value )
+{
+  assert( value <= mask );
+  data_ = ( data_ & ~( mask << shift ) ) | ( static_cast< uint32_t >( value ) << shift );
+}
+
+inline CompactSpikeData&
+CompactSpikeData::operator=( const SpikeData& rhs )
+{
+  data_ = rhs.get_marker();
+  set_field_( lag_shift_, lag_mask_, rhs.get_lag() );
+  set_field_( tid_shift_, tid_mask_, rhs.get_tid() );
+  set_field_( syn_id_shift_, syn_id_mask_, rhs.get_syn_id() );
+  set_field_( lcid_shift_, lcid_mask_, rhs.get_lcid() );
+  return *this;
+}
+
+template < class TargetT >
+inline void
+CompactSpikeData::set( const TargetT& target, const unsigned int lag )
+{
+  data_ = SPIKE_DATA_ID_DEFAULT;
+  set_field_( lag_shift_, lag_mask_, lag );
+  set_field_( tid_shift_, tid_mask_, target.get_tid() );
+  set_field_( syn_id_shift_, syn_id_mask_, target.get_syn_id() );
+  set_field_( lcid_shift_, lcid_mask_, target.get_lcid() );
+}
+
+inline size_t
+CompactSpikeData::get_lcid() const
+{
+  return get_field_( lcid_shift_, lcid_mask_ );
+}
+
+inline void
+CompactSpikeData::set_lcid( size_t value )
+{
+  set_field_( lcid_shift_, lcid_mask_, value );
+}
+
+inline size_t
+CompactSpikeData::get_local_max_spikes_per_rank() const
+{
+  return data_ >> NUM_BITS_MARKER_SPIKE_DATA;
+}
+
+inline void
+CompactSpikeData::set_local_max_spikes_per_rank( size_t value )
+{
+  assert( value < ( 1UL << ( NUM_BITS_COMPACT_SPIKE_DATA - NUM_BITS_MARKER_SPIKE_DATA ) ) );
+  data_ = ( data_ & MARKER_MASK ) | ( static_cast< uint32_t >( value ) << NUM_BITS_MARKER_SPIKE_DATA );
+}
+
+inline unsigned int
+CompactSpikeData::get_lag() const
+{
+  return get_field_( lag_shift_, lag_mask_ );
+}
+
+inline size_t
+CompactSpikeData::get_tid() const
+{
+  return get_field_( tid_shift_, tid_mask_ );
+}
+
+inline synindex
+CompactSpikeData::get_syn_id() const
+{
+  return get_field_( syn_id_shift_, syn_id_mask_ );
+}
+
+inline unsigned int
+CompactSpikeData::get_marker() const
+{
+  return data_ & MARKER_MASK;
+}
+
+inline void
+CompactSpikeData::reset_marker()
+{
+  data_ = ( data_ & ~MARKER_MASK ) | SPIKE_DATA_ID_DEFAULT;
+}
+
+inline void
+CompactSpikeData::set_complete_marker()
+{
+  data_ = ( data_ & ~MARKER_MASK ) | SPIKE_DATA_ID_COMPLETE;
+}
+
+inline void
+CompactSpikeData::set_end_marker()
+{
+  data_ = ( data_ & ~MARKER_MASK ) | SPIKE_DATA_ID_END;
+}
+
+inline void
+CompactSpikeData::set_invalid_marker()
+{
+  data_ = ( data_ & ~MARKER_MASK ) | SPIKE_DATA_ID_INVALID;
+}
+
+inline bool
+CompactSpikeData::is_complete_marker() const
+{
+  return get_marker() == SPIKE_DATA_ID_COMPLETE;
+}
+
+inline bool
+CompactSpikeData::is_end_marker() const
+{
+  return get_marker() == SPIKE_DATA_ID_END;
+}
+
+inline bool
+CompactSpikeData::is_invalid_marker() const
+{
+  return get_marker() == SPIKE_DATA_ID_INVALID;
+}
+
+inline double
+CompactSpikeData::get_offset() const
+{
+  return 0;
+}
+
+
 /**
  * Combine target rank and spike data information for storage in emitted_spikes_register.
  *
@@ -476,12 +723,19 @@ OffGridSpikeData::get_offset() const
  */
 struct SpikeDataWithRank
 {
+  SpikeDataWithRank(); //!< only used to allocate registers
   SpikeDataWithRank( const Target& target, const size_t lag );
 
   const size_t rank;          //!< rank of target neuron
   const SpikeData spike_data; //! data on spike transmitted
 };
 
+inline SpikeDataWithRank::SpikeDataWithRank()
+  : rank( 0 )
+  , spike_data()
+{
+}
+
 inline SpikeDataWithRank::SpikeDataWithRank( const Target& target, const size_t lag )
   : rank( target.get_rank() )
   , spike_data( target, lag )
@@ -495,12 +749,19 @@ inline SpikeDataWithRank::SpikeDataWithRank( const Target& target, const size_t
  */
 struct OffGridSpikeDataWithRank
 {
+  OffGridSpikeDataWithRank(); //!< only used to allocate registers
   OffGridSpikeDataWithRank( const Target& target, const size_t lag, const double offset );
 
   const size_t rank;                 //!< rank of target neuron
   const OffGridSpikeData spike_data; //! data on spike transmitted
 };
 
+inline OffGridSpikeDataWithRank::OffGridSpikeDataWithRank()
+  : rank( 0 )
+  , spike_data()
+{
+}
+
 inline OffGridSpikeDataWithRank::OffGridSpikeDataWithRank( const Target& target, const size_t lag, const double offset )
   : rank( target.get_rank() )
   , spike_data( target, lag, offset )
@@ -37,6 +37,17 @@ struct SynIdDelay
   bool more_targets : 1;
   bool disabled : 1;
 
+  /**
+   * Only used to allocate storage for connectors that keep SynIdDelay entries in a separate array.
+   */
+  SynIdDelay()
+    : delay( 0 )
+    , syn_id( invalid_synindex )
+    , more_targets( false )
+    , disabled( false )
+  {
+  }
+
   explicit SynIdDelay( double d )
     : syn_id( invalid_synindex )
     , more_targets( false )
@@ -20,6 +20,11 @@
  *
  */
 
+// C++ includes:
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
 // Includes from nestkernel:
 #include "target_table.h"
 #include "kernel_manager.h"
@@ -32,55 +37,162 @@ nest::TargetTable::initialize()
 {
   const size_t num_threads = kernel().vp_manager.get_num_threads();
   targets_.resize( num_threads );
+  target_offsets_.resize( num_threads );
+  new_target_lids_.resize( num_threads );
   secondary_send_buffer_pos_.resize( num_threads );
+  secondary_syn_ids_.resize( num_threads );
+  secondary_offsets_.resize( num_threads );
+  new_secondary_send_buffer_pos_.resize( num_threads );
 
 #pragma omp parallel
   {
     const size_t tid = kernel().vp_manager.get_thread_id();
-    targets_[ tid ] = std::vector< std::vector< Target > >();
-    secondary_send_buffer_pos_[ tid ] = std::vector< std::vector< std::vector< size_t > > >();
+    targets_[ tid ] = std::vector< Target >();
+    target_offsets_[ tid ] = std::vector< size_t >();
+    new_target_lids_[ tid ] = std::vector< uint32_t >();
+    secondary_send_buffer_pos_[ tid ] = std::vector< size_t >();
+    secondary_syn_ids_[ tid ] = std::vector< synindex >();
+    secondary_offsets_[ tid ] = std::vector< size_t >();
+    new_secondary_send_buffer_pos_[ tid ] = std::vector< std::tuple< size_t, synindex, size_t > >();
   } // of omp parallel
 }
 
 void
 nest::TargetTable::finalize()
 {
-  std::vector< std::vector< std::vector< Target > > >().swap( targets_ );
-  std::vector< std::vector< std::vector< std::vector< size_t > > > >().swap( secondary_send_buffer_pos_ );
+  std::vector< std::vector< Target > >().swap( targets_ );
+  std::vector< std::vector< size_t > >().swap( target_offsets_ );
+  std::vector< std::vector< uint32_t > >().swap( new_target_lids_ );
+  std::vector< std::vector< size_t > >().swap( secondary_send_buffer_pos_ );
+  std::vector< std::vector< synindex > >().swap( secondary_syn_ids_ );
+  std::vector< std::vector< size_t > >().swap( secondary_offsets_ );
+  std::vector< std::vector< std::tuple< size_t, synindex, size_t > > >().swap( new_secondary_send_buffer_pos_ );
 }
 
 void
 nest::TargetTable::prepare( const size_t tid )
+{
+  new_target_lids_[ tid ].clear();
+  new_secondary_send_buffer_pos_[ tid ].clear();
+}
+
+void
+nest::TargetTable::compress( const size_t tid )
+{
+  compress_targets_( tid );
+  compress_secondary_send_buffer_pos_( tid );
+}
+
+void
+nest::TargetTable::compress_targets_( const size_t tid )
 {
   // add one to max_num_local_nodes to avoid possible overflow in case
   // of rounding errors
   const size_t num_local_nodes = kernel().node_manager.get_max_num_local_nodes() + 1;
 
-  targets_[ tid ].resize( num_local_nodes );
+  std::vector< Target >& targets = targets_[ tid ];
+  std::vector< size_t >& offsets = target_offsets_[ tid ];
+  std::vector< uint32_t >& positions = new_target_lids_[ tid ];
+
+  if ( positions.empty() and offsets.size() == num_local_nodes + 1 )
+  {
+    return;
+  }
+
+  const size_t num_old_targets = offsets.empty() ? 0 : offsets.back();
+  assert( num_old_targets + positions.size() == targets.size() );
+  assert( targets.size() <= std::numeric_limits< uint32_t >::max() );
+
+  // count existing and new targets of each neuron to determine the new offsets
+  std::vector< size_t > new_offsets( std::max( num_local_nodes + 1, offsets.size() ), 0 );
+  for ( size_t lid = 0; lid + 1 < offsets.size(); ++lid )
+  {
+    new_offsets[ lid + 1 ] = offsets[ lid + 1 ] - offsets[ lid ];
+  }
+  for ( const uint32_t lid : positions )
+  {
+    assert( lid + 1 < new_offsets.size() );
+    ++new_offsets[ lid + 1 ];
+  }
+  std::partial_sum( new_offsets.begin(), new_offsets.end(), new_offsets.begin() );
 
-  secondary_send_buffer_pos_[ tid ].resize( num_local_nodes );
+  // determine the new position of each target, placing existing targets of
+  // each neuron before the new ones; positions of new targets replace their
+  // local ids
+  std::vector< size_t > next_position( new_offsets.begin(), new_offsets.end() - 1 );
+  positions.insert( positions.begin(), num_old_targets, 0 );
+  for ( size_t lid = 0; lid + 1 < offsets.size(); ++lid )
+  {
+    for ( size_t i = offsets[ lid ]; i < offsets[ lid + 1 ]; ++i )
+    {
+      positions[ i ] = next_position[ lid ]++;
+    }
+  }
+  for ( size_t i = num_old_targets; i < positions.size(); ++i )
+  {
+    positions[ i ] = next_position[ positions[ i ] ]++;
+  }
 
-  for ( size_t lid = 0; lid < num_local_nodes; ++lid )
+  // move targets along the cycles of the permutation
+  for ( size_t i = 0; i < targets.size(); ++i )
   {
-    // resize to maximal possible synapse-type index
-    secondary_send_buffer_pos_[ tid ][ lid ].resize( kernel().model_manager.get_num_connection_models() );
+    while ( positions[ i ] != i )
+    {
+      const uint32_t pos = positions[ i ];
+      std::swap( targets[ i ], targets[ pos ] );
+      std::swap( positions[ i ], positions[ pos ] );
+    }
   }
+
+  // targets were appended with geometric growth, release the spare capacity
+  targets.shrink_to_fit();
+  offsets.swap( new_offsets );
+  std::vector< uint32_t >().swap( positions );
 }
 
 void
-nest::TargetTable::compress_secondary_send_buffer_pos( const size_t tid )
+nest::TargetTable::compress_secondary_send_buffer_pos_( const size_t tid )
 {
-  for ( std::vector< std::vector< std::vector< size_t > > >::iterator it = secondary_send_buffer_pos_[ tid ].begin();
-        it != secondary_send_buffer_pos_[ tid ].end();
-        ++it )
+  const size_t num_local_nodes = kernel().node_manager.get_max_num_local_nodes() + 1;
+
+  std::vector< size_t >& positions = secondary_send_buffer_pos_[ tid ];
+  std::vector< synindex >& syn_ids = secondary_syn_ids_[ tid ];
+  std::vector< size_t >& offsets = secondary_offsets_[ tid ];
+  std::vector< std::tuple< size_t, synindex, size_t > >& new_positions = new_secondary_send_buffer_pos_[ tid ];
+
+  if ( new_positions.empty() and offsets.size() == num_local_nodes + 1 )
   {
-    for ( std::vector< std::vector< size_t > >::iterator iit = it->begin(); iit != it->end(); ++iit )
+    return;
+  }
+
+  // sorting by local id, synapse type and position groups the positions of
+  // each neuron by synapse type and makes identical positions adjacent
+  for ( size_t lid = 0; lid + 1 < offsets.size(); ++lid )
+  {
+    for ( size_t i = offsets[ lid ]; i < offsets[ lid + 1 ]; ++i )
     {
-      std::sort( iit->begin(), iit->end() );
-      const std::vector< size_t >::iterator new_it = std::unique( iit->begin(), iit->end() );
-      iit->resize( std::distance( iit->begin(), new_it ) );
+      new_positions.emplace_back( lid, syn_ids[ i ], positions[ i ] );
     }
   }
+  std::sort( new_positions.begin(), new_positions.end() );
+  new_positions.erase( std::unique( new_positions.begin(), new_positions.end() ), new_positions.end() );
+
+  std::vector< size_t >( std::max( num_local_nodes + 1, offsets.size() ), 0 ).swap( offsets );
+  positions.resize( new_positions.size() );
+  syn_ids.resize( new_positions.size() );
+  for ( size_t i = 0; i < new_positions.size(); ++i )
+  {
+    const size_t lid = std::get< 0 >( new_positions[ i ] );
+    assert( lid + 1 < offsets.size() );
+    ++offsets[ lid + 1 ];
+    syn_ids[ i ] = std::get< 1 >( new_positions[ i ] );
+    positions[ i ] = std::get< 2 >( new_positions[ i ] );
+  }
+  std::partial_sum( offsets.begin(), offsets.end(), offsets.begin() );
+
+  positions.shrink_to_fit();
+  syn_ids.shrink_to_fit();
+  std::vector< std::tuple< size_t, synindex, size_t > >().swap( new_positions );
 }
 
 void
@@ -88,14 +200,14 @@ nest::TargetTable::add_target( const size_t tid, const size_t target_rank, const
 {
   const size_t lid = target_data.get_source_lid();
 
-  vector_util::grow( targets_[ tid ][ lid ] );
-
   if ( target_data.is_primary() )
   {
     const TargetDataFields& target_fields = target_data.target_data;
 
-    targets_[ tid ][ lid ].push_back(
-      Target( target_fields.get_tid(), target_rank, target_fields.get_syn_id(), target_fields.get_lcid() ) );
+    vector_util::grow( targets_[ tid ] );
+    targets_[ tid ].emplace_back(
+      target_fields.get_tid(), target_rank, target_fields.get_syn_id(), target_fields.get_lcid() );
+    new_target_lids_[ tid ].push_back( lid );
   }
   else
   {
@@ -104,7 +216,44 @@ nest::TargetTable::add_target( const size_t tid, const size_t target_rank, const
       + kernel().mpi_manager.get_send_displacement_secondary_events_in_int( target_rank );
     const synindex syn_id = secondary_fields.get_syn_id();
 
-    assert( syn_id < secondary_send_buffer_pos_[ tid ][ lid ].size() );
-    secondary_send_buffer_pos_[ tid ][ lid ][ syn_id ].push_back( send_buffer_pos );
+    assert( syn_id < kernel().model_manager.get_num_connection_models() );
+    new_secondary_send_buffer_pos_[ tid ].emplace_back( lid, syn_id, send_buffer_pos );
+  }
+}
+
+void
+nest::TargetTable::remove_targets( const size_t tid, const std::vector< bool >& syn_ids )
+{
+  std::vector< Target >& targets = targets_[ tid ];
+  std::vector< size_t >& offsets = target_offsets_[ tid ];
+
+  // compact targets in place, updating the end offset of each neuron
+  size_t num_kept = 0;
+  size_t begin = 0;
+  for ( size_t lid = 0; lid + 1 < offsets.size(); ++lid )
+  {
+    const size_t end = offsets[ lid + 1 ];
+    for ( size_t i = begin; i < end; ++i )
+    {
+      if ( not syn_ids[ targets[ i ].get_syn_id() ] )
+      {
+        targets[ num_kept++ ] = targets[ i ];
+      }
+    }
+    begin = end;
+    offsets[ lid + 1 ] = num_kept;
+  }
+  targets.resize( num_kept );
+}
+
+void
+nest::TargetTable::get_target_ranks( std::vector< int >& is_target_rank ) const
+{
+  for ( const auto& targets_of_thread : targets_ )
+  {
+    for ( const auto& target : targets_of_thread )
+    {
+      is_target_rank[ target.get_rank() ] = 1;
+    }
   }
 }
@@ -24,11 +24,17 @@
 #define TARGET_TABLE_H
 
 // C++ includes:
+#include <algorithm>
 #include <cassert>
+#include <cstdint>
 #include <iostream>
 #include <map>
+#include <tuple>
 #include <vector>
 
+// Includes from libnestutil:
+#include "vector_util.h"
+
 // Includes from nestkernel:
 #include "nest_types.h"
 #include "spike_data.h"
@@ -47,26 +53,68 @@ class TargetTable
 {
 private:
   /**
-   * Stores targets of local neurons
+   * Stores targets of local neurons in compressed sparse row layout
+   *
+   * For each thread, the targets of the local neuron with local id lid
+   * are stored in targets_[ tid ] at positions
+   * [ target_offsets_[ tid ][ lid ], target_offsets_[ tid ][ lid + 1 ] ).
+   */
+  std::vector< std::vector< Target > > targets_;
+
+  /**
+   * Offsets of the targets of each local neuron in targets_.
    *
-   * Three dimensional objects:
+   * Two dimensional object:
    *   - first dim: threads
-   *   - second dim: local neurons
-   *   - third dim: targets
+   *   - second dim: local neurons plus one
+   */
+  std::vector< std::vector< size_t > > target_offsets_;
+
+  /**
+   * Local ids of the sources of the targets added during the current
+   * exchange of target data.
+   *
+   * The added targets are appended to targets_ behind the targets in
+   * compressed sparse row layout, so that no separate staging copy of
+   * the targets is needed. compress() moves them to their place.
    */
-  std::vector< std::vector< std::vector< Target > > > targets_;
+  std::vector< std::vector< uint32_t > > new_target_lids_;
 
   /**
    * Stores MPI send buffer positions for secondary targets of local
-   * neurons.
+   * neurons in compressed sparse row layout.
    *
-   * Four dimensional object:
-   *   - first dim: threads
-   *   - second dim: local neurons
-   *   - third dim: synapse types
-   *   - fourth dim: MPI send buffer positions
+   * The positions of each local neuron are sorted by synapse type,
+   * with secondary_syn_ids_ holding the synapse type of each position.
+   * Offsets of each local neuron are stored in secondary_offsets_.
+   */
+  std::vector< std::vector< size_t > > secondary_send_buffer_pos_;
+  std::vector< std::vector< synindex > > secondary_syn_ids_;
+  std::vector< std::vector< size_t > > secondary_offsets_;
+
+  /**
+   * Secondary targets added during the current exchange of target data,
+   * as tuples of local id of the source, synapse type and MPI send buffer
+   * position. Merged into secondary_send_buffer_pos_ by compress().
    */
-  std::vector< std::vector< std::vector< std::vector< size_t > > > > secondary_send_buffer_pos_;
+  std::vector< std::vector< std::tuple< size_t, synindex, size_t > > > new_secondary_send_buffer_pos_;
+
+  /**
+   * Moves the targets added since the last call to their place in
+   * targets_, preserving the order in which targets were added.
+   *
+   * Targets are permuted in place, so the only additional memory is one
+   * 32-bit position per target. At most 2^32 - 1 targets per thread are
+   * supported.
+   */
+  void compress_targets_( const size_t tid );
+
+  /**
+   * Merges new_secondary_send_buffer_pos_ into secondary_send_buffer_pos_
+   * and removes identical MPI send buffer positions to avoid writing
+   * data multiple times.
+   */
+  void compress_secondary_send_buffer_pos_( const size_t tid );
 
 public:
   /**
@@ -80,12 +128,14 @@ public:
   void finalize();
 
   /**
-   * Adjusts targets_ to number of local nodes.
+   * Prepares the addition of targets during the exchange of target data.
    */
   void prepare( const size_t tid );
 
   /**
-   * Adds entry to targets_.
+   * Adds entry to targets_ or new_secondary_send_buffer_pos_.
+   *
+   * Added targets become visible after the next call to compress().
    */
   void add_target( const size_t tid, const size_t target_rank, const TargetData& target_data );
 
@@ -93,46 +143,83 @@ public:
    * Returns all targets of a neuron. Used for filling
    * EventDeliveryManager::emitted_spikes_register_.
    */
-  const std::vector< Target >& get_targets( const size_t tid, const size_t lid ) const;
+  vector_util::ConstSpan< Target > get_targets( const size_t tid, const size_t lid ) const;
 
   /**
    * Returns all MPI send buffer positions of a neuron.
    *
    * Used to fill MPI buffer in EventDeliveryManager.
    */
-  const std::vector< size_t >&
+  vector_util::ConstSpan< size_t >
   get_secondary_send_buffer_positions( const size_t tid, const size_t lid, const synindex syn_id ) const;
 
+  /**
+   * Sets is_target_rank[ rank ] to 1 for all ranks on which local neurons
+   * have primary targets.
+   *
+   * Used to determine the neighbourhood for the exchange of spikes.
+   */
+  void get_target_ranks( std::vector< int >& is_target_rank ) const;
+
   /**
    * Clears all entries of targets_.
    */
   void clear( const size_t tid );
 
   /**
-   * Removes identical MPI send buffer positions to avoid writing
-   * data multiple times.
+   * Removes all primary targets with a synapse type flagged in syn_ids.
+   */
+  void remove_targets( const size_t tid, const std::vector< bool >& syn_ids );
+
+  /**
+   * Converts all targets added since the last call into the compressed
+   * sparse row layout.
+   *
+   * Counts the targets of each local neuron to determine their offsets,
+   * then places all targets in one flat array per thread.
    */
-  void compress_secondary_send_buffer_pos( const size_t tid );
+  void compress( const size_t tid );
 };
 
-inline const std::vector< Target >&
+inline vector_util::ConstSpan< Target >
 TargetTable::get_targets( const size_t tid, const size_t lid ) const
 {
-  return targets_[ tid ][ lid ];
+  if ( lid + 1 >= target_offsets_[ tid ].size() )
+  {
+    return vector_util::ConstSpan< Target >();
+  }
+
+  const Target* const targets = targets_[ tid ].data();
+  return vector_util::ConstSpan< Target >(
+    targets + target_offsets_[ tid ][ lid ], targets + target_offsets_[ tid ][ lid + 1 ] );
 }
 
-inline const std::vector< size_t >&
+inline vector_util::ConstSpan< size_t >
 TargetTable::get_secondary_send_buffer_positions( const size_t tid, const size_t lid, const synindex syn_id ) const
 {
-  assert( syn_id < secondary_send_buffer_pos_[ tid ][ lid ].size() );
-  return secondary_send_buffer_pos_[ tid ][ lid ][ syn_id ];
+  if ( lid + 1 >= secondary_offsets_[ tid ].size() )
+  {
+    return vector_util::ConstSpan< size_t >();
+  }
+
+  // positions of each neuron are sorted by synapse type
+  const auto syn_ids_begin = secondary_syn_ids_[ tid ].begin();
+  const auto range = std::equal_range(
+    syn_ids_begin + secondary_offsets_[ tid ][ lid ], syn_ids_begin + secondary_offsets_[ tid ][ lid + 1 ], syn_id );
+
+  const size_t* const positions = secondary_send_buffer_pos_[ tid ].data();
+  return vector_util::ConstSpan< size_t >(
+    positions + ( range.first - syn_ids_begin ), positions + ( range.second - syn_ids_begin ) );
 }
 
 inline void
 TargetTable::clear( const size_t tid )
 {
-  targets_[ tid ].clear();
-  secondary_send_buffer_pos_[ tid ].clear();
+  std::vector< Target >().swap( targets_[ tid ] );
+  std::vector< size_t >().swap( target_offsets_[ tid ] );
+  std::vector< size_t >().swap( secondary_send_buffer_pos_[ tid ] );
+  std::vector< synindex >().swap( secondary_syn_ids_[ tid ] );
+  std::vector< size_t >().swap( secondary_offsets_[ tid ] );
 }
 
 } // namespace nest
@@ -156,6 +156,13 @@ public:
    */
   void record_data( long );
 
+  //! Returns true if at least one multimeter records from the node
+  bool
+  is_recording() const
+  {
+    return not data_loggers_.empty();
+  }
+
   //! Erase all existing data
   void reset();
 
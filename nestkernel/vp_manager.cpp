@@ -80,6 +80,33 @@ nest::VPManager::initialize( const bool adjust_number_of_threads_or_rng_only )
 void
 nest::VPManager::finalize( const bool )
 {
+  vp_ranges_.clear();
+}
+
+void
+nest::VPManager::assign_vps( const size_t first_node_id, const size_t last_node_id, const size_t first_vp )
+{
+  assert( first_node_id <= last_node_id );
+  assert( vp_ranges_.empty() or first_node_id == vp_ranges_.back().last_node_id + 1 );
+
+  if ( first_vp == node_id_to_vp( first_node_id ) )
+  {
+    // the round-robin order continues
+    if ( not vp_ranges_.empty() )
+    {
+      vp_ranges_.back().last_node_id = last_node_id;
+    }
+    return;
+  }
+
+  if ( vp_ranges_.empty() and first_node_id > 1 )
+  {
+    // all nodes created so far are assigned by node_id % num_vps
+    vp_ranges_.push_back( { 1, first_node_id - 1, 1 % get_num_virtual_processes(), 0 } );
+  }
+
+  const size_t first_lid = vp_ranges_.empty() ? 0 : node_id_to_lid( first_node_id - 1 ) + 1;
+  vp_ranges_.push_back( { first_node_id, last_node_id, first_vp, first_lid } );
 }
 
 size_t
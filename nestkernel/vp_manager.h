@@ -32,6 +32,9 @@
 // Includes from sli:
 #include "dictdatum.h"
 
+// C++ includes:
+#include <vector>
+
 #ifdef _OPENMP
 // C includes:
 #include <omp.h>
@@ -48,6 +51,19 @@ struct AssignedRanks
   size_t max_size;
 };
 
+/**
+ * Range of node IDs assigned to VPs round-robin, starting with the VP of the first node.
+ *
+ * Each range reserves ceil(n / num_vps) local IDs on every VP for its n node IDs.
+ */
+struct VPRange
+{
+  size_t first_node_id;
+  size_t last_node_id;
+  size_t first_vp;  //!< VP of the first node of the range
+  size_t first_lid; //!< first local ID reserved for the range on each VP
+};
+
 class VPManager : public ManagerInterface
 {
 public:
@@ -118,9 +134,22 @@ public:
    * t = (node_id div P) mod T, where P is the number of simulation processes and
    * T the number of threads. This may be used by Network::add_node()
    * if the user has not specified anything.
+   *
+   * If node IDs have been assigned to VPs by assign_vps() with a start that
+   * breaks the round-robin order, the VP is looked up in the ranges of node IDs.
    */
   size_t node_id_to_vp( const size_t node_id ) const;
 
+  /**
+   * Assign the node IDs of a call to Create to VPs round-robin, starting with the given VP.
+   *
+   * As long as every call continues the round-robin order of the previous one, node IDs
+   * are mapped to VPs by node_id % num_vps and no ranges are stored. Otherwise, a range
+   * is added, which node_id_to_vp(), node_id_to_lid() and lid_to_node_id() find by
+   * binary search.
+   */
+  void assign_vps( const size_t first_node_id, const size_t last_node_id, const size_t first_vp );
+
   /**
    * Convert a given VP ID to the corresponding thread ID
    */
@@ -170,8 +199,18 @@ public:
   AssignedRanks get_assigned_ranks( const size_t tid );
 
 private:
+  /**
+   * Return the range containing the given node ID.
+   *
+   * Node IDs beyond the last range are considered part of it.
+   */
+  const VPRange& get_vp_range_( const size_t node_id ) const;
+
   const bool force_singlethreading_;
   size_t n_threads_; //!< Number of threads per process.
+
+  //! Ranges of node IDs with their first VP, empty while all node IDs are assigned round-robin
+  std::vector< VPRange > vp_ranges_;
 };
 }
 
@@ -25,6 +25,9 @@
 
 #include "vp_manager.h"
 
+// C++ includes:
+#include <algorithm>
+
 // Includes from nestkernel:
 #include "kernel_manager.h"
 #include "mpi_manager.h"
@@ -39,10 +42,30 @@ VPManager::get_vp() const
   return kernel().mpi_manager.get_rank() + get_thread_id() * kernel().mpi_manager.get_num_processes();
 }
 
+inline const VPRange&
+VPManager::get_vp_range_( const size_t node_id ) const
+{
+  assert( not vp_ranges_.empty() );
+
+  // first range starting after node_id
+  const auto next_range = std::upper_bound( vp_ranges_.begin(),
+    vp_ranges_.end(),
+    node_id,
+    []( const size_t id, const VPRange& range ) { return id < range.first_node_id; } );
+
+  return next_range == vp_ranges_.begin() ? vp_ranges_.front() : *( next_range - 1 );
+}
+
 inline size_t
 VPManager::node_id_to_vp( const size_t node_id ) const
 {
-  return node_id % get_num_virtual_processes();
+  if ( vp_ranges_.empty() )
+  {
+    return node_id % get_num_virtual_processes();
+  }
+
+  const VPRange& range = get_vp_range_( node_id );
+  return ( range.first_vp + node_id - range.first_node_id ) % get_num_virtual_processes();
 }
 
 inline size_t
@@ -72,21 +95,44 @@ VPManager::thread_to_vp( const size_t tid ) const
 inline bool
 VPManager::is_node_id_vp_local( const size_t node_id ) const
 {
-  return ( node_id % get_num_virtual_processes() == static_cast< size_t >( get_vp() ) );
+  return ( node_id_to_vp( node_id ) == static_cast< size_t >( get_vp() ) );
 }
 
 inline size_t
 VPManager::node_id_to_lid( const size_t node_id ) const
 {
-  // starts at lid 0 for node_ids >= 1 (expected value for neurons, excl. node ID 0)
-  return std::ceil( static_cast< double >( node_id ) / get_num_virtual_processes() ) - 1;
+  if ( vp_ranges_.empty() )
+  {
+    // starts at lid 0 for node_ids >= 1 (expected value for neurons, excl. node ID 0)
+    return std::ceil( static_cast< double >( node_id ) / get_num_virtual_processes() ) - 1;
+  }
+
+  const VPRange& range = get_vp_range_( node_id );
+  return range.first_lid + ( node_id - range.first_node_id ) / get_num_virtual_processes();
 }
 
 inline size_t
 VPManager::lid_to_node_id( const size_t lid ) const
 {
   const size_t vp = get_vp();
-  return ( lid + static_cast< size_t >( vp == 0 ) ) * get_num_virtual_processes() + vp;
+  const size_t num_vps = get_num_virtual_processes();
+  if ( vp_ranges_.empty() )
+  {
+    return ( lid + static_cast< size_t >( vp == 0 ) ) * num_vps + vp;
+  }
+
+  // last range with local IDs reserved at or before lid
+  const auto next_range = std::upper_bound( vp_ranges_.begin(),
+    vp_ranges_.end(),
+    lid,
+    []( const size_t l, const VPRange& range ) { return l < range.first_lid; } );
+  assert( next_range != vp_ranges_.begin() );
+  const VPRange& range = *( next_range - 1 );
+
+  // the slot is unused on VPs that received fewer nodes of the range
+  const size_t node_id =
+    range.first_node_id + ( num_vps + vp - range.first_vp ) % num_vps + ( lid - range.first_lid ) * num_vps;
+  return node_id <= range.last_node_id ? node_id : 0;
 }
 
 inline size_t
@@ -0,0 +1,97 @@
+# -*- coding: utf-8 -*-
+#
+# spike_delivery_benchmark.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+r"""
+Spike delivery benchmark
+------------------------
+
+This script compares the two spike delivery modes of NEST for a random
+network of ``iaf_psc_alpha`` neurons driven by Poisson input:
+
+* delivery in the order in which spikes arrive from the MPI ranks
+  (``sort_spikes_by_target = False``, the default), and
+* target-sorted delivery, in which received spikes are first partitioned
+  by target thread and sorted by connection, so that each thread only
+  reads its own spikes (``sort_spikes_by_target = True``).
+
+For each mode, the network is simulated for several values of
+``spike_delivery_batch_size``. The script reports the wall-clock time
+of the simulation phase and, if NEST was built with detailed timers
+(``-Dwith-detailed-timers=ON``), the time spent in spike delivery.
+
+Differences between the modes grow with the number of threads per
+MPI process, so ``num_threads`` should be set to the number of cores
+available. Run with ``mpirun`` to include MPI communication.
+
+"""
+
+import nest
+
+###############################################################################
+# Parameters of the benchmark; changes should be made here
+
+params = {
+    "num_threads": 4,  # number of threads per MPI process
+    "num_neurons": 10000,  # total number of neurons
+    "indegree": 1000,  # number of incoming connections per neuron
+    "simtime": 200.0,  # simulated time in ms
+    "presimtime": 50.0,  # simulated time before measurement in ms
+    "batch_sizes": [4, 8, 16, 32],  # values for spike_delivery_batch_size
+}
+
+
+def run_benchmark(sort_spikes_by_target, batch_size):
+    """
+    Build and simulate the network and return measured times in seconds.
+    """
+
+    nest.ResetKernel()
+    nest.set_verbosity("M_WARNING")
+    nest.local_num_threads = params["num_threads"]
+    nest.sort_spikes_by_target = sort_spikes_by_target
+    nest.spike_delivery_batch_size = batch_size
+
+    neurons = nest.Create("iaf_psc_alpha", params["num_neurons"], params={"I_e": 350.0})
+    noise = nest.Create("poisson_generator", params={"rate": 5000.0})
+
+    nest.Connect(
+        neurons,
+        neurons,
+        {"rule": "fixed_indegree", "indegree": params["indegree"]},
+        {"synapse_model": "static_synapse", "weight": 0.1, "delay": 1.5},
+    )
+    nest.Connect(noise, neurons, syn_spec={"weight": 10.0})
+
+    nest.Simulate(params["presimtime"])
+    nest.Simulate(params["simtime"])
+
+    status = nest.GetKernelStatus()
+    return status["time_simulate"], status.get("time_deliver_spike_data", float("nan")), status["local_spike_counter"]
+
+
+###############################################################################
+# Run all combinations of delivery mode and batch size and print a table
+
+print(f"{'sorted':>8} {'batch':>6} {'T_sim [s]':>10} {'T_deliver [s]':>14} {'spikes':>8}")
+for sort_spikes_by_target in [False, True]:
+    for batch_size in params["batch_sizes"]:
+        t_sim, t_deliver, num_spikes = run_benchmark(sort_spikes_by_target, batch_size)
+        print(f"{str(sort_spikes_by_target):>8} {batch_size:>6} {t_sim:>10.3f} {t_deliver:>14.3f} {num_spikes:>8}")
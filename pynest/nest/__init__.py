@@ -226,6 +226,59 @@ class NestModule(types.ModuleType):
         "Maximal size of MPI buffers for communication of connections",
         default=16777216,
     )
+    neighbor_spike_exchange = KernelAttribute(
+        "bool",
+        (
+            "Whether each rank exchanges spikes only with the ranks it sends spikes to or receives "
+            + "spikes from, using an MPI neighbourhood collective instead of a dense alltoall. The "
+            + "neighbourhood is set up when the connection infrastructure is next updated"
+        ),
+        default=False,
+    )
+    neighbor_spike_exchange_max_density = KernelAttribute(
+        "float",
+        (
+            "If the fraction of pairs of ranks exchanging spikes exceeds this value, spikes are "
+            + "exchanged with a dense alltoall even if ``neighbor_spike_exchange`` is set"
+        ),
+        default=0.5,
+    )
+    neighbor_spike_exchange_active = KernelAttribute(
+        "bool",
+        "Whether spikes are currently exchanged using the MPI neighbourhood collective",
+        readonly=True,
+    )
+    neighbor_spike_exchange_bytes_saved = KernelAttribute(
+        "int",
+        (
+            "Number of bytes this rank did not send during spike exchange "
+            + "because of ``neighbor_spike_exchange``, compared to a dense alltoall"
+        ),
+        readonly=True,
+    )
+    hierarchical_target_data_exchange = KernelAttribute(
+        "bool",
+        (
+            "Whether connection information is exchanged in two levels during network construction. "
+            + "The ranks of each group first collect their data on the group leader, and only the "
+            + "leaders exchange data with each other, which reduces the number of messages between "
+            + "compute nodes"
+        ),
+        default=False,
+    )
+    hierarchical_target_data_exchange_group_size = KernelAttribute(
+        "int",
+        (
+            "Number of consecutive ranks per group in ``hierarchical_target_data_exchange``. "
+            + "If 0, ranks sharing memory on the same compute node form a group"
+        ),
+        default=0,
+    )
+    hierarchical_target_data_exchange_num_groups = KernelAttribute(
+        "int",
+        "Number of groups in the last hierarchical exchange of connection information, 0 if none",
+        readonly=True,
+    )
     spike_buffer_grow_extra = KernelAttribute(
         "float",
         "When spike exchange buffer is expanded, resize it to "
@@ -251,6 +304,72 @@ class NestModule(types.ModuleType):
         ),
         default=0.1,
     )
+    spike_buffer_predictive_sizing = KernelAttribute(
+        "bool",
+        (
+            "Whether to size spike exchange buffers by an exponential moving average of the largest "
+            + "number of spikes sent from any rank to any rank per time slice, instead of shrinking them "
+            + "according to ``spike_buffer_shrink_limit``. The average follows increases immediately "
+            + "and decays with ``spike_buffer_ema_weight`` afterwards. Buffers are resized every "
+            + "``spike_buffer_resize_interval`` slices to `(1 + spike_buffer_headroom) * average`, "
+            + "unless the current size exceeds this by no more than a factor of `1 + spike_buffer_headroom`. "
+            + "All pairs of ranks exchange chunks of the same size, so the pair with most spikes "
+            + "determines the size of all chunks"
+        ),
+        default=False,
+    )
+    spike_buffer_ema_weight = KernelAttribute(
+        "float",
+        "Weight of the most recent time slice in the moving average used by ``spike_buffer_predictive_sizing``",
+        default=0.1,
+    )
+    spike_buffer_headroom = KernelAttribute(
+        "float",
+        "Fraction of extra space above the moving average used by ``spike_buffer_predictive_sizing``",
+        default=0.5,
+    )
+    spike_buffer_resize_interval = KernelAttribute(
+        "int",
+        "Number of time slices between resizes with ``spike_buffer_predictive_sizing``",
+        default=10,
+    )
+    spike_buffer_overflows = KernelAttribute(
+        "int",
+        (
+            "Number of spike exchange rounds in which spikes did not fit into the buffers. "
+            + "Each overflow causes one retransmission round"
+        ),
+        readonly=True,
+    )
+    spike_exchange_rounds = KernelAttribute(
+        "int",
+        "Number of spike exchange rounds, including retransmissions after overflows",
+        readonly=True,
+    )
+    spike_buffer_thread_sections = KernelAttribute(
+        "bool",
+        (
+            "Whether to sort spikes by target thread in the spike exchange buffers, so that each "
+            + "thread only reads the section of the receive buffer addressed to it during delivery. "
+            + "Has no effect if ``use_compressed_spikes`` is set"
+        ),
+        default=False,
+    )
+    spike_buffer_encoding = KernelAttribute(
+        "bool",
+        (
+            "Whether to exchange spikes as byte streams in which lag, target thread, synapse type and "
+            + "the difference of local connection ids of consecutive spikes are encoded as variable-length "
+            + "integers. Encoding is switched off in time slices in which it does not reduce the amount "
+            + "of data sent and retried periodically. Not used with off-grid spikes or neighbourhood exchange"
+        ),
+        default=False,
+    )
+    spike_buffer_encoding_active = KernelAttribute(
+        "bool",
+        "Whether spikes were exchanged as encoded byte streams in the last time slice, see ``spike_buffer_encoding``",
+        readonly=True,
+    )
     spike_buffer_resize_log = KernelAttribute(
         "dict",
         (
@@ -261,6 +380,50 @@ class NestModule(types.ModuleType):
         ),
         readonly=True,
     )
+    spike_delivery_batch_size = KernelAttribute(
+        "int",
+        (
+            "Number of spikes read from the receive buffer in one batch before they are delivered. "
+            + "If ``sort_spikes_by_target`` is set, this is the number of spikes by which "
+            + "connections are prefetched ahead of delivery"
+        ),
+        default=8,
+    )
+    spike_exchange_pipeline_depth = KernelAttribute(
+        "int",
+        (
+            "Number of stages into which each ``min_delay`` time slice is split for the exchange of "
+            + "spikes. Spikes of each stage but the last are exchanged with a non-blocking collective "
+            + "while the next stage is updated. At most ``min_delay`` stages are used; pipelining is "
+            + "disabled with secondary connections, structural plasticity or MUSIC. Can only be set "
+            + "before the first call to ``Simulate``"
+        ),
+        default=1,
+    )
+    compact_spike_data = KernelAttribute(
+        "bool",
+        (
+            "Whether spikes may be exchanged in a 32-bit encoding. The encoding is used if lag, "
+            + "thread, synapse type and connection index fit into 32 bits on all ranks; it is chosen "
+            + "at the first call to ``Simulate`` and abandoned if later connections no longer fit. "
+            + "Not used with precise spike times or structural plasticity"
+        ),
+        default=False,
+    )
+    compact_spike_data_active = KernelAttribute(
+        "bool",
+        "Whether spikes are currently exchanged in the 32-bit encoding",
+        readonly=True,
+    )
+    sort_spikes_by_target = KernelAttribute(
+        "bool",
+        (
+            "Whether to partition received spikes by target thread and sort them by synapse type "
+            + "and connection before delivery. Each thread then only reads its own spikes and "
+            + "visits connections in the order in which they are stored"
+        ),
+        default=False,
+    )
 
     use_wfr = KernelAttribute("bool", "Whether to use waveform relaxation method", default=True)
     wfr_comm_interval = KernelAttribute(
@@ -315,6 +478,26 @@ class NestModule(types.ModuleType):
         ),
         default=True,
     )
+    radix_sort_connections = KernelAttribute(
+        "bool",
+        (
+            "Whether to sort connections by source with a radix sort over the source node IDs. "
+            + "The sort takes linear time and moves connections in place"
+        ),
+        default=False,
+    )
+    incremental_connection_update = KernelAttribute(
+        "bool",
+        (
+            "Whether to update the connection infrastructure only for synapse types whose"
+            + " connections have been created or removed since the last update. Adding"
+            + " secondary connections or nodes always triggers a full update. With"
+            + " ``use_compressed_spikes``, only sources without earlier connections of"
+            + " the same synapse type are communicated; the lookup table of sources"
+            + " needed for this is kept between updates, which costs memory"
+        ),
+        default=False,
+    )
     data_path = KernelAttribute(
         "str",
         "A path, where all data is written to, defaults to current directory",
@@ -326,6 +509,55 @@ class NestModule(types.ModuleType):
         "Whether to print progress information during the simulation",
         default=False,
     )
+    use_input_buffer_pools = KernelAttribute(
+        "bool",
+        (
+            "Whether to keep the input buffers of neurons in one contiguous pool per thread"
+            + " and model, if the model supports it"
+        ),
+        default=False,
+    )
+    use_population_update = KernelAttribute(
+        "bool",
+        (
+            "Whether to update consecutive neurons of one model together in a loop"
+            + " that the compiler can vectorise, if the model supports it"
+        ),
+        default=False,
+    )
+    use_update_stealing = KernelAttribute(
+        "bool",
+        (
+            "Whether threads that are done with their own nodes update chunks of"
+            + " nodes of other threads, if the model supports it"
+        ),
+        default=False,
+    )
+    update_stealing_chunk_size = KernelAttribute(
+        "int",
+        "Number of nodes per chunk handed out to threads if ``use_update_stealing`` is set",
+        default=64,
+    )
+    use_cost_balanced_placement = KernelAttribute(
+        "bool",
+        (
+            "Whether to place the neurons of each call to Create on the virtual processes so that"
+            + " the expected update cost given by ``model_update_costs`` is balanced"
+        ),
+        default=False,
+    )
+    model_update_costs = KernelAttribute(
+        "dict",
+        (
+            "Expected update cost per neuron for each model, used if ``use_cost_balanced_placement``"
+            + " is set. Models not listed have cost 1"
+        ),
+    )
+    vp_update_costs = KernelAttribute(
+        "list[float]",
+        "Expected update cost of the neurons placed on each virtual process",
+        readonly=True,
+    )
     network_size = KernelAttribute("int", "The number of nodes in the network", readonly=True)
     num_connections = KernelAttribute(
         "int",
@@ -358,6 +590,14 @@ class NestModule(types.ModuleType):
         ),
         readonly=True,
     )
+    local_target_data_counter = KernelAttribute(
+        "int",
+        (
+            "Number of target data sent by the given MPI process to the presynaptic side"
+            + " during the most recent update of the connection infrastructure"
+        ),
+        readonly=True,
+    )
     recording_backends = KernelAttribute(
         "list[str]",
         "List of available backends for recording devices",
@@ -378,6 +618,17 @@ class NestModule(types.ModuleType):
         "Whether to keep source table after connection setup is complete",
         default=True,
     )
+    compress_source_table = KernelAttribute(
+        "bool",
+        (
+            "Whether to keep the source table in run-length encoded form after connection setup is "
+            + "complete. Consecutive entries with the same source are stored once together with the "
+            + "number of entries, which reduces memory if neurons have several targets per thread and "
+            + "synapse type. The source table is expanded again when connections change. Only used "
+            + "if ``keep_source_table`` is set"
+        ),
+        default=False,
+    )
     min_update_time = KernelAttribute(
         "float",
         "Shortest wall-clock time measured so far for a full update step [seconds]",
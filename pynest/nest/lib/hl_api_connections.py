@@ -233,8 +233,9 @@ def Connect(pre, post, conn_spec=None, syn_spec=None, return_synapsecollection=F
         if "delays" in processed_syn_spec:
             raise ValueError("To specify delays, use 'delay' in syn_spec.")
 
-        weights = numpy.array(processed_syn_spec["weight"]) if "weight" in processed_syn_spec else None
-        delays = numpy.array(processed_syn_spec["delay"]) if "delay" in processed_syn_spec else None
+        # Avoid copies, so that large arrays can be passed on to the kernel as they are
+        weights = numpy.asarray(processed_syn_spec["weight"]) if "weight" in processed_syn_spec else None
+        delays = numpy.asarray(processed_syn_spec["delay"]) if "delay" in processed_syn_spec else None
 
         try:
             synapse_model = processed_syn_spec["synapse_model"]
@@ -422,6 +422,13 @@ class SonataNetwork:
         is modifiable so that the user is able to achieve a balance between
         the number of read operations and memory overhead.
 
+        With several MPI processes, the processes share the reading. If an
+        edge file provides the ``indices/target_to_source`` index, each
+        process only reads the edges of its local target nodes. Otherwise,
+        each process reads a block of rows and sends the edges to the
+        processes owning their targets. In both cases, the hyperslab size
+        limits the number of rows a process reads at once.
+
         Parameters
         ----------
         hdf5_hyperslab_size : int, optional
@@ -282,7 +282,11 @@ cdef class NESTEngine:
             raise exceptionCls('take_array_index', '') from None
 
     def connect_arrays(self, sources, targets, weights, delays, synapse_model, syn_param_keys, syn_param_values):
-        """Calls connect_arrays function, bypassing SLI to expose pointers to the NumPy arrays"""
+        """Calls connect_arrays function, bypassing SLI to expose pointers to the NumPy arrays
+
+        Contiguous arrays of type int64 for node IDs and float64 for all other values are passed
+        to the kernel without copying.
+        """
         if self.pEngine is NULL:
             raise NESTErrors.PyNESTError("engine uninitialized")
         if not HAVE_NUMPY:
@@ -311,7 +315,8 @@ cdef class NESTEngine:
             if not len(sources) == syn_param_values.shape[1]:
                 raise ValueError('syn_param_values must be a matrix with arrays of the same length as sources and targets.')
 
-        # Get pointers to the first element in each NumPy array
+        # Get pointers to the first element in each NumPy array. ascontiguousarray only copies
+        # arrays that are not contiguous or not of the requested type.
         cdef long[::1] sources_mv = numpy.ascontiguousarray(sources, dtype=int)
         cdef long* sources_ptr = &sources_mv[0]
 
@@ -26,6 +26,7 @@
 
 // Includes from cpptests
 #include "test_block_vector.h"
+#include "test_compact_spike_data.h"
 #include "test_enum_bitfield.h"
 #include "test_parameter.h"
 #include "test_sort.h"
@@ -27,6 +27,7 @@
 #include <boost/test/unit_test.hpp>
 
 // C++ includes:
+#include <algorithm>
 #include <vector>
 
 // Includes from libnestutil:
@@ -113,6 +114,38 @@ BOOST_AUTO_TEST_CASE( test_clear )
   BOOST_REQUIRE( n_elements == 0 );
 }
 
+BOOST_AUTO_TEST_CASE( test_reserve )
+{
+  BlockVector< int > block_vector;
+  std::vector< int > reference;
+  const int N = 3 * block_vector.get_max_block_size();
+  block_vector.push_back( -1 );
+  reference.push_back( -1 );
+
+  block_vector.reserve( N );
+  BOOST_REQUIRE( block_vector.size() == 1 );
+
+  for ( int i = 0; i < N; ++i )
+  {
+    block_vector.push_back( i );
+    reference.push_back( i );
+  }
+  BOOST_REQUIRE( block_vector.size() == reference.size() );
+  BOOST_REQUIRE( std::equal( block_vector.begin(), block_vector.end(), reference.begin() ) );
+
+  // Erasing from the back discards the remaining reserved blocks.
+  block_vector.erase( block_vector.begin() + 5, block_vector.end() );
+  reference.erase( reference.begin() + 5, reference.end() );
+  block_vector.reserve( N );
+  for ( int i = 0; i < N; ++i )
+  {
+    block_vector.push_back( i );
+    reference.push_back( i );
+  }
+  BOOST_REQUIRE( block_vector.size() == reference.size() );
+  BOOST_REQUIRE( std::equal( block_vector.begin(), block_vector.end(), reference.begin() ) );
+}
+
 BOOST_AUTO_TEST_CASE( test_erase )
 {
   int N = 10;
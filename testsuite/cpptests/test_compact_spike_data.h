@@ -0,0 +1,140 @@
+/*
+ *  test_compact_spike_data.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#ifndef TEST_COMPACT_SPIKE_DATA_H
+#define TEST_COMPACT_SPIKE_DATA_H
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+// C++ includes:
+#include <cstdlib>
+
+// Includes from nestkernel:
+#include "nest_types.h"
+#include "spike_data.h"
+
+namespace nest
+{
+
+/**
+ * Test cases: CompactSpikeData encoding
+ */
+BOOST_AUTO_TEST_SUITE( test_compact_spike_data )
+
+constexpr int NUM_COMPACT_TEST_TRIALS = 50U;
+
+BOOST_AUTO_TEST_CASE( test_compact_spike_data_round_trip )
+{
+  // 2 marker + 4 lag + 2 tid + 6 syn_id bits leave 18 bits for the lcid
+  const size_t max_lag = 9;
+  const size_t max_tid = 3;
+  const size_t max_syn_id = 40;
+  const size_t max_lcid = 100000;
+  BOOST_REQUIRE( CompactSpikeData::set_layout( max_lag, max_tid, max_syn_id, max_lcid ) );
+  BOOST_REQUIRE( CompactSpikeData::fits_layout( max_lag, max_tid, max_syn_id, ( 1 << 18 ) - 1 ) );
+  BOOST_REQUIRE( not CompactSpikeData::fits_layout( max_lag, max_tid, max_syn_id, 1 << 18 ) );
+
+  std::srand( 3456789 );
+  for ( int i = 0; i < NUM_COMPACT_TEST_TRIALS; ++i )
+  {
+    const unsigned int lag = std::rand() % ( max_lag + 1 );
+    const size_t tid = std::rand() % ( max_tid + 1 );
+    const synindex syn_id = std::rand() % ( max_syn_id + 1 );
+    const size_t lcid = std::rand() % ( max_lcid + 1 );
+
+    SpikeData spike_data( tid, syn_id, lcid, lag );
+    spike_data.set_end_marker();
+
+    CompactSpikeData compact_spike_data;
+    compact_spike_data = spike_data;
+
+    BOOST_REQUIRE( compact_spike_data.get_lag() == lag );
+    BOOST_REQUIRE( compact_spike_data.get_tid() == tid );
+    BOOST_REQUIRE( compact_spike_data.get_syn_id() == syn_id );
+    BOOST_REQUIRE( compact_spike_data.get_lcid() == lcid );
+    BOOST_REQUIRE( compact_spike_data.is_end_marker() );
+
+    const SpikeData expanded = compact_spike_data.expand();
+    BOOST_REQUIRE( expanded.get_lag() == lag );
+    BOOST_REQUIRE( expanded.get_tid() == tid );
+    BOOST_REQUIRE( expanded.get_syn_id() == syn_id );
+    BOOST_REQUIRE( expanded.get_lcid() == lcid );
+    BOOST_REQUIRE( expanded.is_end_marker() );
+  }
+}
+
+BOOST_AUTO_TEST_CASE( test_compact_spike_data_markers )
+{
+  BOOST_REQUIRE( CompactSpikeData::set_layout( 9, 3, 40, 100000 ) );
+
+  CompactSpikeData compact_spike_data;
+  compact_spike_data = SpikeData( 3, 40, 100000, 9 );
+  BOOST_REQUIRE( compact_spike_data.get_marker() == SPIKE_DATA_ID_DEFAULT );
+
+  compact_spike_data.set_invalid_marker();
+  BOOST_REQUIRE( compact_spike_data.is_invalid_marker() );
+  compact_spike_data.set_complete_marker();
+  BOOST_REQUIRE( compact_spike_data.is_complete_marker() );
+  compact_spike_data.reset_marker();
+  BOOST_REQUIRE( compact_spike_data.get_marker() == SPIKE_DATA_ID_DEFAULT );
+
+  // Setting the marker must not change any other field
+  BOOST_REQUIRE( compact_spike_data.get_lag() == 9 );
+  BOOST_REQUIRE( compact_spike_data.get_tid() == 3 );
+  BOOST_REQUIRE( compact_spike_data.get_syn_id() == 40 );
+  BOOST_REQUIRE( compact_spike_data.get_lcid() == 100000 );
+
+  // Buffer size information may exceed the width of the lcid field
+  const size_t local_max_spikes_per_rank = ( 1 << 29 ) + 1;
+  compact_spike_data.set_local_max_spikes_per_rank( local_max_spikes_per_rank );
+  compact_spike_data.set_complete_marker();
+  BOOST_REQUIRE( compact_spike_data.get_local_max_spikes_per_rank() == local_max_spikes_per_rank );
+  BOOST_REQUIRE( compact_spike_data.is_complete_marker() );
+  BOOST_REQUIRE( compact_spike_data.expand().is_complete_marker() );
+}
+
+BOOST_AUTO_TEST_CASE( test_compact_spike_data_overflow )
+{
+  BOOST_REQUIRE( CompactSpikeData::set_layout( 15, 0, 0, 10 ) );
+
+  // 2 marker + 14 lag + 10 tid + 6 syn_id bits leave no bit for the lcid
+  BOOST_REQUIRE( not CompactSpikeData::set_layout( 10000, 1000, 50, 0 ) );
+
+  // A failed attempt leaves the layout unchanged
+  BOOST_REQUIRE( CompactSpikeData::fits_layout( 15, 0, 0, 10 ) );
+  BOOST_REQUIRE( not CompactSpikeData::fits_layout( 16, 0, 0, 10 ) );
+  BOOST_REQUIRE( not CompactSpikeData::fits_layout( 15, 1, 0, 10 ) );
+  BOOST_REQUIRE( not CompactSpikeData::fits_layout( 15, 0, 1, 10 ) );
+
+  // The lcid field is never wider than in SpikeData
+  BOOST_REQUIRE( CompactSpikeData::set_layout( 0, 0, 0, 10 ) );
+  BOOST_REQUIRE( CompactSpikeData::fits_layout( 0, 0, 0, MAX_LCID ) );
+  BOOST_REQUIRE( not CompactSpikeData::fits_layout( 0, 0, 0, MAX_LCID + 1 ) );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace nest
+
+#endif /* TEST_COMPACT_SPIKE_DATA_H */
@@ -28,6 +28,8 @@
 
 // C++ includes:
 #include <algorithm>
+#include <cstdint>
+#include <cstdlib>
 #include <vector>
 
 // Includes from libnestutil:
@@ -232,6 +234,46 @@ BOOST_FIXTURE_TEST_CASE( test_boost_linear, fill_bv_vec_linear )
   BOOST_REQUIRE( std::equal( vec_sort_small.begin(), vec_sort_small.end(), bv_perm_small.begin() ) );
 }
 
+/**
+ * Tests whether sources with random node IDs, some of them disabled, are
+ * sorted stably by the radix sort, and whether a second vector is permuted
+ * alongside. Some node IDs require more than one radix sort pass.
+ */
+BOOST_AUTO_TEST_CASE( test_radix_sort_sources )
+{
+  const size_t N = 20000;
+
+  BlockVector< nest::Source > sources;
+  BlockVector< size_t > positions;
+  std::vector< nest::Source > unsorted_sources;
+  for ( size_t i = 0; i < N; ++i )
+  {
+    const uint64_t node_id = ( i % 3 == 0 ) ? 1 + std::rand() % 100 : 1 + std::rand() % 100000;
+    nest::Source source( node_id, true );
+    if ( i % 7 == 0 )
+    {
+      source.disable();
+    }
+    sources.push_back( source );
+    positions.push_back( i );
+    unsorted_sources.push_back( source );
+  }
+
+  nest::RadixSortBuffers buffers;
+  nest::radix_sort( buffers, sources, positions );
+
+  BOOST_REQUIRE( std::is_sorted( sources.begin(), sources.end() ) );
+  BOOST_REQUIRE( sources[ N - 1 ].is_disabled() );
+  for ( size_t i = 0; i < N; ++i )
+  {
+    BOOST_REQUIRE( sources[ i ] == unsorted_sources[ positions[ i ] ] );
+    if ( i > 0 and sources[ i ] == sources[ i - 1 ] )
+    {
+      BOOST_REQUIRE( positions[ i - 1 ] < positions[ i ] );
+    }
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 #endif /* TEST_SORT_H */
@@ -0,0 +1,67 @@
+# -*- coding: utf-8 -*-
+#
+# test_compressed_target_data_exchange.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Test that rebuilding the connection infrastructure with compressed spikes creates no duplicate targets.
+
+With one thread, the thread fills the target data of all processes. If the chunk of one process fills up
+before the others, the chunks of the other processes must still be terminated, as they contain target data
+of earlier rounds.
+"""
+
+import pytest
+import testnetwork
+
+import nest
+
+pytestmark = pytest.mark.skipif(nest.num_processes < 2, reason="Requires >= 2 MPI processes")
+
+
+def _simulate(compressed_spikes, incremental):
+    """
+    Add connections from further sources after a simulation and return the local spikes.
+    """
+
+    testnetwork.reset_kernel(1, 17, use_compressed_spikes=compressed_spikes, incremental_connection_update=incremental)
+
+    sgen = nest.Create("spike_generator", params={"spike_times": [10.0, 50.0]})
+    sources = nest.Create("parrot_neuron", 200)
+    new_sources = nest.Create("parrot_neuron", 10)
+    targets = nest.Create("parrot_neuron", 200)
+    srec = nest.Create("spike_recorder")
+    nest.Connect(sgen, sources + new_sources)
+    nest.Connect(targets, srec)
+
+    nest.Connect(sources, targets, {"rule": "fixed_indegree", "indegree": 10}, {"delay": 1.5})
+    nest.Simulate(30.0)
+    nest.Connect(new_sources, targets[:10], "one_to_one", {"delay": 1.0})
+    nest.Simulate(40.0)
+
+    return testnetwork.sorted_spikes(srec)
+
+
+@pytest.mark.parametrize("incremental", [False, True])
+def test_rebuild_with_compressed_spikes_gives_same_spikes(incremental):
+    spikes = _simulate(False, False)
+    spikes_compressed = _simulate(True, incremental)
+
+    assert len(spikes) > 0
+    assert spikes_compressed == spikes
@@ -0,0 +1,99 @@
+# -*- coding: utf-8 -*-
+#
+# test_cost_balanced_placement_mpi.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Test that cost-balanced placement of neurons across MPI processes simulates the same network as round-robin placement.
+"""
+
+import pytest
+import testnetwork
+
+import nest
+
+MPI = pytest.importorskip("mpi4py.MPI")
+
+pytestmark = pytest.mark.skipif(nest.num_processes < 4, reason="Requires >= 4 MPI processes")
+
+
+def _gather_sorted(local_items):
+    return sorted(item for items in MPI.COMM_WORLD.allgather(local_items) for item in items)
+
+
+def _simulate(balanced):
+    """
+    Simulate populations of an expensive and a cheap model created in turns.
+
+    Returns the placement of all neurons and the connections, spikes and membrane potentials of all processes.
+    """
+
+    testnetwork.reset_kernel(
+        1,
+        5,
+        use_cost_balanced_placement=balanced,
+        model_update_costs={"iaf_psc_exp": 10.0, "iaf_psc_alpha": 1.0},
+    )
+
+    expensive = nest.NodeCollection()
+    neurons = nest.NodeCollection()
+    for i in range(20):
+        new_expensive = nest.Create("iaf_psc_exp", 2, params={"I_e": 370.0 + i})
+        expensive += new_expensive
+        neurons += new_expensive + nest.Create("iaf_psc_alpha", 2, params={"I_e": 380.0 + i})
+
+    srec = nest.Create("spike_recorder")
+    mm = nest.Create("multimeter", params={"record_from": ["V_m"], "interval": 0.1})
+
+    nest.Connect(neurons, neurons, "all_to_all", {"weight": 2.0, "delay": 1.5})
+    nest.Connect(neurons, srec)
+    nest.Connect(mm, neurons[::3])
+
+    nest.Simulate(100.0)
+
+    local_neurons = nest.GetLocalNodeCollection(neurons)
+    local_expensive = nest.GetLocalNodeCollection(expensive)
+    return (
+        _gather_sorted(list(zip(local_neurons.tolist(), local_neurons.vp))),
+        _gather_sorted(list(zip(local_expensive.tolist(), local_expensive.vp))),
+        _gather_sorted(testnetwork.sorted_connections(["source", "target", "weight"], target=neurons)),
+        _gather_sorted(testnetwork.sorted_spikes(srec)),
+        _gather_sorted(testnetwork.sorted_potentials(mm)),
+    )
+
+
+def test_cost_balanced_placement_across_processes():
+    placement, expensive_placement, conns, spikes, vm = _simulate(False)
+    placement_b, expensive_placement_b, conns_b, spikes_b, vm_b = _simulate(True)
+
+    # with round-robin placement, all expensive neurons are on two VPs
+    num_vps = nest.total_num_virtual_procs
+    assert all(vp == node_id % num_vps for node_id, vp in placement)
+    assert len({vp for _, vp in expensive_placement}) == 2
+
+    # with balanced placement, each neuron is still local to exactly one process, but not on its round-robin VP
+    assert [node_id for node_id, _ in placement_b] == [node_id for node_id, _ in placement]
+    assert any(vp != node_id % num_vps for node_id, vp in placement_b)
+    assert len({vp for _, vp in expensive_placement_b}) == num_vps
+
+    assert len(conns) == len(placement) ** 2
+    assert len(spikes) > 0
+    assert conns_b == conns
+    assert spikes_b == spikes
+    assert vm_b == vm
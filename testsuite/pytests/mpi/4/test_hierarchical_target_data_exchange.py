@@ -0,0 +1,88 @@
+# -*- coding: utf-8 -*-
+#
+# test_hierarchical_target_data_exchange.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Test that the hierarchical exchange of target data builds the same network as the dense alltoall.
+"""
+
+import pytest
+import testnetwork
+
+import nest
+
+pytestmark = pytest.mark.skipif(nest.num_processes < 4, reason="Requires >= 4 MPI processes")
+
+
+def _simulate(hierarchical, group_size=0):
+    """
+    Simulate a randomly connected network and return its local connections and spikes.
+
+    Without compressed spikes, target data is exchanged for each connection.
+    """
+
+    testnetwork.reset_kernel(
+        1,
+        17,
+        use_compressed_spikes=False,
+        hierarchical_target_data_exchange=hierarchical,
+        hierarchical_target_data_exchange_group_size=group_size,
+    )
+
+    # small buffers require several rounds of target data exchange
+    nest.buffer_size_target_data = 4 * nest.num_processes
+
+    neurons = nest.Create("iaf_psc_alpha", 40, params={"I_e": 450.0, "V_m": nest.random.uniform(-70.0, -55.0)})
+    srec = nest.Create("spike_recorder")
+    nest.Connect(neurons, neurons, {"rule": "fixed_indegree", "indegree": 8}, {"weight": 20.0, "delay": 1.5})
+    nest.Connect(neurons, srec)
+    nest.Simulate(100.0)
+
+    return (
+        testnetwork.sorted_connections(["source", "target"], target=neurons),
+        testnetwork.sorted_spikes(srec),
+        nest.hierarchical_target_data_exchange_num_groups,
+    )
+
+
+@pytest.mark.parametrize("group_size, expected_num_groups", [(1, 4), (2, 2), (3, 2), (4, 1)])
+def test_hierarchical_exchange_gives_same_network(group_size, expected_num_groups):
+    conns, spikes, num_groups = _simulate(False)
+    conns_h, spikes_h, num_groups_h = _simulate(True, group_size)
+
+    assert num_groups == 0
+    assert num_groups_h == expected_num_groups
+    assert len(spikes) > 0
+    assert conns_h == conns
+    assert spikes_h == spikes
+
+
+def test_hierarchical_exchange_groups_ranks_by_shared_memory():
+    conns, spikes, _ = _simulate(False)
+    conns_h, spikes_h, num_groups_h = _simulate(True)
+
+    assert 1 <= num_groups_h <= nest.num_processes
+    assert conns_h == conns
+    assert spikes_h == spikes
+
+
+def test_hierarchical_exchange_group_size_must_be_non_negative():
+    with pytest.raises(nest.kernel.NESTErrors.BadProperty):
+        nest.hierarchical_target_data_exchange_group_size = -1
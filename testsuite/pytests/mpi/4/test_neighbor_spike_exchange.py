@@ -0,0 +1,84 @@
+# -*- coding: utf-8 -*-
+#
+# test_neighbor_spike_exchange.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Test that spike exchange with MPI neighbourhood collectives delivers the same spikes as the dense alltoall.
+"""
+
+import pytest
+
+import nest
+
+pytestmark = pytest.mark.skipif(nest.num_processes < 4, reason="Requires >= 4 MPI processes")
+
+
+def _simulate_ring(neighbor_spike_exchange, max_density=0.5):
+    """
+    Simulate a network in which each rank only sends spikes to itself and the next rank.
+
+    With one virtual process per rank, node ``i`` is placed on rank ``i % num_processes``,
+    so connecting node ``i`` to node ``i + num_sources + 1`` connects each rank to the next.
+    """
+
+    nest.ResetKernel()
+    nest.neighbor_spike_exchange = neighbor_spike_exchange
+    nest.neighbor_spike_exchange_max_density = max_density
+
+    num_sources = 4 * nest.num_processes
+    sources = nest.Create("iaf_psc_alpha", num_sources)
+    nest.Create("iaf_psc_alpha")  # shift targets by one node
+    targets = nest.Create("iaf_psc_alpha", num_sources)
+    noise = nest.Create("poisson_generator", params={"rate": 20000.0})
+    srec = nest.Create("spike_recorder")
+
+    nest.Connect(noise, sources, syn_spec={"weight": 10.0})
+    nest.Connect(sources, targets, "one_to_one", syn_spec={"weight": 2000.0})
+    nest.Connect(targets, srec)
+
+    nest.Simulate(200.0)
+
+    return srec.n_events, nest.neighbor_spike_exchange_active, nest.neighbor_spike_exchange_bytes_saved
+
+
+def test_neighbor_exchange_delivers_same_spikes():
+    n_events_dense, active_dense, saved_dense = _simulate_ring(False)
+    n_events_neighbor, active_neighbor, saved_neighbor = _simulate_ring(True)
+
+    assert not active_dense
+    assert saved_dense == 0
+    assert active_neighbor
+    assert saved_neighbor > 0
+    assert n_events_dense > 0
+    assert n_events_neighbor == n_events_dense
+
+
+def test_neighbor_exchange_falls_back_for_dense_rank_graph():
+    n_events_dense, _, _ = _simulate_ring(False)
+    n_events_fallback, active, saved = _simulate_ring(True, max_density=0.0)
+
+    assert not active
+    assert saved == 0
+    assert n_events_fallback == n_events_dense
+
+
+def test_neighbor_exchange_max_density_must_be_fraction():
+    with pytest.raises(nest.kernel.NESTErrors.BadProperty):
+        nest.neighbor_spike_exchange_max_density = 1.5
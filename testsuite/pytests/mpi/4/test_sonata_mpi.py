@@ -0,0 +1,133 @@
+# -*- coding: utf-8 -*-
+#
+# test_sonata_mpi.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Test that SONATA networks are built correctly when the edge files are read by several MPI processes.
+"""
+
+import shutil
+import tempfile
+from pathlib import Path
+
+import nest
+import pytest
+
+MPI = pytest.importorskip("mpi4py.MPI")
+
+# Skip all tests in this module if no HDF5 or OpenMP threads
+pytestmark = [
+    pytest.mark.skipif_missing_hdf5,
+    pytest.mark.skipif_missing_threads,
+    pytest.mark.skipif(nest.num_processes < 4, reason="Requires >= 4 MPI processes"),
+]
+
+# See test_sonata.py for the location of the example files
+for relpath in ["../../../../../doc/nest/examples/pynest", "../../../../pynest/examples"]:
+    sonata_path = Path(__file__).parent / relpath / "sonata_example" / "300_pointneurons"
+    config = sonata_path / "circuit_config.json"
+    sim_config = sonata_path / "simulation_config.json"
+    have_sonata_files = config.is_file() and sim_config.is_file()
+    if have_sonata_files:
+        break
+else:
+    have_sonata_files = False
+
+
+EXPECTED_NUM_CONNECTIONS = 48432
+EXPECTED_NUM_SPIKES = 18828
+
+
+# 2**10=1024 : each process reads the edges in several chunks
+# 2**20=1048576 : each process reads its edges at once
+@pytest.mark.parametrize("hyperslab_size", [2**10, 2**20])
+def test_SonataNetwork_mpi(hyperslab_size):
+    assert have_sonata_files, "SONATA files not found"
+
+    nest.ResetKernel()
+    nest.set(total_num_virtual_procs=nest.num_processes)
+    sonata_net = nest.SonataNetwork(config, sim_config)
+    node_collections = sonata_net.BuildNetwork(hdf5_hyperslab_size=hyperslab_size)
+
+    # Each process must only have created the connections to its local targets
+    local_targets = nest.GetLocalNodeCollection(node_collections["internal"])
+    assert set(nest.GetConnections().target) <= set(local_targets.tolist())
+
+    comm = MPI.COMM_WORLD
+    assert comm.allreduce(nest.num_connections) == EXPECTED_NUM_CONNECTIONS
+
+    srec = nest.Create("spike_recorder")
+    nest.Connect(node_collections["internal"], srec)
+    sonata_net.Simulate()
+    assert comm.allreduce(srec.n_events) == EXPECTED_NUM_SPIKES
+
+
+@pytest.fixture(scope="module")
+def config_without_index():
+    """
+    Copy the example network and remove the target_to_source index groups from its edge files.
+
+    Process 0 writes the copy to a directory that all processes read.
+    """
+
+    h5py = pytest.importorskip("h5py")
+    assert have_sonata_files, "SONATA files not found"
+
+    comm = MPI.COMM_WORLD
+    copy_path = None
+    if comm.rank == 0:
+        copy_path = Path(tempfile.mkdtemp()) / "300_pointneurons"
+        shutil.copytree(sonata_path, copy_path)
+        for edges_file in (copy_path / "network").glob("*_edges.h5"):
+            with h5py.File(edges_file, "r+") as f:
+                for pop_grp in f["edges"].values():
+                    del pop_grp["indices"]
+    copy_path = comm.bcast(copy_path, root=0)
+
+    yield copy_path / "circuit_config.json", copy_path / "simulation_config.json"
+
+    comm.barrier()
+    if comm.rank == 0:
+        shutil.rmtree(copy_path.parent)
+
+
+@pytest.mark.parametrize("hyperslab_size", [2**10, 2**20])
+def test_SonataNetwork_mpi_without_index(config_without_index, hyperslab_size):
+    """
+    Without index groups, the processes read the edge files in contiguous blocks and exchange the edges.
+    """
+
+    config, sim_config = config_without_index
+
+    nest.ResetKernel()
+    nest.set(total_num_virtual_procs=nest.num_processes)
+    sonata_net = nest.SonataNetwork(config, sim_config)
+    node_collections = sonata_net.BuildNetwork(hdf5_hyperslab_size=hyperslab_size)
+
+    local_targets = nest.GetLocalNodeCollection(node_collections["internal"])
+    assert set(nest.GetConnections().target) <= set(local_targets.tolist())
+
+    comm = MPI.COMM_WORLD
+    assert comm.allreduce(nest.num_connections) == EXPECTED_NUM_CONNECTIONS
+
+    srec = nest.Create("spike_recorder")
+    nest.Connect(node_collections["internal"], srec)
+    sonata_net.Simulate()
+    assert comm.allreduce(srec.n_events) == EXPECTED_NUM_SPIKES
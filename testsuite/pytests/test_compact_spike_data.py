@@ -0,0 +1,81 @@
+# -*- coding: utf-8 -*-
+#
+# test_compact_spike_data.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Test the exchange of spikes in the 32-bit encoding and the fallback to the full encoding.
+"""
+
+import nest
+
+
+def _simulate_with_added_connections(compact_spike_data):
+    """
+    Simulate, then add more connections than fit into the compact encoding and continue.
+
+    A delay of 1000 ms requires 14 bits for the lag, leaving at most 16 bits for the connection index.
+    The spike emitted by the source at 1900 ms is still in the receive buffers when connections are added.
+
+    Returns the number of recorded spikes and whether the compact encoding was used in both simulations.
+    """
+
+    nest.ResetKernel()
+    nest.compact_spike_data = compact_spike_data
+    nest.SetDefaults("static_synapse", {"delay": 1000.0})
+
+    sg = nest.Create("spike_generator", params={"spike_times": [100.0, 900.0, 1900.0]})
+    source = nest.Create("parrot_neuron")
+    targets = nest.Create("parrot_neuron", 10)
+    srec = nest.Create("spike_recorder")
+
+    nest.Connect(sg, source)
+    nest.Connect(source, targets)
+    nest.Connect(targets, srec)
+
+    nest.Simulate(2000.0)
+    active = [nest.compact_spike_data_active]
+
+    extra_targets = nest.Create("parrot_neuron", 10)
+    nest.Connect(source, extra_targets, {"rule": "fixed_outdegree", "outdegree": 2**16 + 1})
+
+    nest.Simulate(3000.0)
+    active.append(nest.compact_spike_data_active)
+
+    return srec.n_events, active
+
+
+def test_compact_spike_data_falls_back_to_full_encoding():
+    n_events_full, active_full = _simulate_with_added_connections(False)
+    n_events_compact, active_compact = _simulate_with_added_connections(True)
+
+    assert active_full == [False, False]
+    assert active_compact == [True, False]
+    assert n_events_full == 30
+    assert n_events_compact == n_events_full
+
+
+def test_compact_spike_data_not_used_for_precise_spikes():
+    nest.ResetKernel()
+
+    neurons = nest.Create("iaf_psc_exp_ps", 2)
+    nest.Connect(neurons, neurons)
+    nest.Simulate(10.0)
+
+    assert not nest.compact_spike_data_active
@@ -0,0 +1,93 @@
+# -*- coding: utf-8 -*-
+#
+# test_compress_source_table.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Test that keeping the source table in compressed form does not change the network.
+"""
+
+import pytest
+import testnetwork
+
+import nest
+
+
+def _simulate(compress_source_table, compressed_spikes, num_threads):
+    """
+    Simulate a network, query and change its connections, and simulate again.
+
+    Returns sorted connections after the first simulation, after changing connections
+    and the sorted spikes.
+    """
+
+    testnetwork.reset_kernel(
+        num_threads, 123, use_compressed_spikes=compressed_spikes, compress_source_table=compress_source_table
+    )
+
+    neurons = nest.Create("iaf_psc_alpha", 50, params={"I_e": 600.0})
+    srec = nest.Create("spike_recorder")
+    nest.Connect(neurons, srec)
+
+    # multapses ensure that sources have several entries per thread
+    nest.Connect(
+        neurons[:10],
+        neurons,
+        {"rule": "fixed_total_number", "N": 800},
+        {"weight": 10.0, "delay": testnetwork.grid_delays(1.0, 10)},
+    )
+    nest.Simulate(20.0)
+
+    keys = ["source", "target", "delay"]
+    conns = testnetwork.sorted_connections(keys, target=neurons)
+
+    # disconnecting requires connections sorted by source
+    if compressed_spikes:
+        nest.GetConnections(source=neurons[:3], target=neurons[::2]).disconnect()
+    nest.Connect(neurons[10:], neurons, {"rule": "fixed_indegree", "indegree": 2}, {"weight": 15.0})
+    nest.Simulate(20.0)
+
+    return conns, testnetwork.sorted_connections(keys, target=neurons), testnetwork.sorted_spikes(srec)
+
+
+@pytest.mark.parametrize("compressed_spikes", [True, False])
+@pytest.mark.parametrize("num_threads", [1, 2])
+def test_compressed_source_table_gives_same_network(compressed_spikes, num_threads):
+    reference = _simulate(False, compressed_spikes, num_threads)
+    compressed = _simulate(True, compressed_spikes, num_threads)
+
+    assert len(reference[0]) > 0
+    assert len(reference[2]) > 0
+    assert compressed == reference
+
+
+def test_compress_source_table_without_keeping_source_table():
+    """
+    Test that compression has no effect if the source table is not kept.
+    """
+
+    nest.ResetKernel()
+    nest.set(keep_source_table=False, compress_source_table=True)
+
+    neurons = nest.Create("iaf_psc_alpha", 5)
+    nest.Connect(neurons, neurons)
+    nest.Simulate(10.0)
+
+    with pytest.raises(nest.kernel.NESTError):
+        nest.GetConnections()
@@ -152,6 +152,48 @@ class TestConnectArrays(unittest.TestCase):
             self.assertEqual(conn_w, w)
             self.assertEqual(conn_d, d)
 
+    @unittest.skipIf(not HAVE_OPENMP, "NEST was compiled without multi-threading")
+    def test_connect_arrays_threaded_matches_connect(self):
+        """Connecting NumPy arrays with many threads creates the same connections as regular Connect"""
+        n = 50
+        rng = np.random.default_rng(123)
+        sources = rng.integers(1, n + 1, size=1000)
+        targets = rng.integers(1, n + 1, size=1000)
+        weights = rng.uniform(0.5, 1.5, size=1000)
+        delays = rng.choice([1.0, 2.0], size=1000)
+
+        def connections(use_arrays):
+            nest.ResetKernel()
+            nest.local_num_threads = 4
+            nest.Create("iaf_psc_alpha", n)
+            srec = nest.Create("spike_recorder")
+            pgen = nest.Create("poisson_generator")
+
+            # include connections from and to devices, which are created by all threads
+            all_sources = np.concatenate((sources, [srec.global_id - 1, pgen.global_id, pgen.global_id]))
+            all_targets = np.concatenate((targets, [srec.global_id, 1, 2]))
+            all_weights = np.concatenate((weights, [1.0, 2.0, 3.0]))
+            all_delays = np.concatenate((delays, [1.0, 1.0, 1.0]))
+
+            if use_arrays:
+                nest.Connect(
+                    all_sources,
+                    all_targets,
+                    "one_to_one",
+                    {"weight": all_weights, "delay": all_delays},
+                )
+            else:
+                for s, t, w, d in zip(all_sources, all_targets, all_weights, all_delays):
+                    nest.Connect(
+                        nest.NodeCollection([int(s)]), nest.NodeCollection([int(t)]), syn_spec={"weight": w, "delay": d}
+                    )
+
+            keys = ["source", "target", "target_thread", "port", "weight", "delay"]
+            conns = nest.GetConnections().get(keys)
+            return sorted(zip(*(conns[key] for key in keys)))
+
+        self.assertEqual(connections(True), connections(False))
+
     def test_connect_arrays_no_delays(self):
         """Connecting NumPy arrays without specifying delays"""
         n = 10
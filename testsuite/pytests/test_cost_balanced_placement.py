@@ -0,0 +1,173 @@
+# -*- coding: utf-8 -*-
+#
+# test_cost_balanced_placement.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Test that neurons are placed on virtual processes by the expected update cost of their models.
+"""
+
+import pytest
+
+import nest
+
+NUM_THREADS = 4
+
+
+def _create_network(balanced):
+    """
+    Create small populations of an expensive and a cheap model in turns.
+
+    With round-robin placement, the expensive neurons always end up on the same virtual processes.
+    """
+
+    nest.ResetKernel()
+    nest.local_num_threads = NUM_THREADS
+    nest.SetKernelStatus(
+        {"use_cost_balanced_placement": balanced, "model_update_costs": {"iaf_psc_exp": 10.0, "iaf_psc_alpha": 1.0}}
+    )
+
+    expensive = nest.NodeCollection()
+    cheap = nest.NodeCollection()
+    for i in range(20):
+        expensive += nest.Create("iaf_psc_exp", 2, params={"I_e": 370.0 + i})
+        cheap += nest.Create("iaf_psc_alpha", 2, params={"I_e": 380.0 + i})
+
+    return expensive, cheap
+
+
+def test_cost_balanced_placement_balances_vps():
+    expensive, cheap = _create_network(False)
+    costs_rr = nest.vp_update_costs
+    expensive_vps_rr = expensive.vp
+
+    expensive, cheap = _create_network(True)
+    costs = nest.vp_update_costs
+    expensive_vps = expensive.vp
+
+    assert sum(costs) == pytest.approx(sum(costs_rr))
+    assert max(costs) - min(costs) < max(costs_rr) - min(costs_rr)
+    assert max(costs) - min(costs) <= 10.0
+
+    # with round-robin placement, all expensive neurons are on two VPs
+    assert len(set(expensive_vps_rr)) == 2
+    assert len(set(expensive_vps)) == NUM_THREADS
+
+    # the expected costs match the neurons placed on each VP
+    cheap_vps = cheap.vp
+    for vp in range(NUM_THREADS):
+        assert costs[vp] == pytest.approx(10.0 * expensive_vps.count(vp) + cheap_vps.count(vp))
+
+
+def test_cost_balanced_placement_keeps_round_robin_for_equal_costs():
+    nest.ResetKernel()
+    nest.local_num_threads = NUM_THREADS
+    nest.use_cost_balanced_placement = True
+
+    for n in [3, 1, 6, 2, 5]:
+        nest.Create("iaf_psc_alpha", n)
+        nest.Create("iaf_psc_exp", n)
+
+    neurons = nest.GetNodes()
+    assert neurons.vp == tuple(node_id % NUM_THREADS for node_id in neurons.tolist())
+
+
+def test_consecutive_creates_of_one_model_continue_round_robin():
+    """
+    Consecutive Create calls of one model keep a fixed VP stride, so only the first call is placed by cost.
+    """
+
+    nest.ResetKernel()
+    nest.local_num_threads = NUM_THREADS
+    nest.SetKernelStatus({"use_cost_balanced_placement": True, "model_update_costs": {"iaf_psc_exp": 10.0}})
+
+    # leave the VPs after the round-robin start more expensive than the others
+    nest.Create("iaf_psc_alpha", 3)
+    nest.Create("iaf_psc_exp", 1)
+    nest.Create("iaf_psc_alpha", 2)
+
+    expensive = nest.NodeCollection()
+    for _ in range(10):
+        expensive += nest.Create("iaf_psc_exp", 3)
+
+    vps = expensive.vp
+    assert vps == tuple((vps[0] + i) % NUM_THREADS for i in range(len(vps)))
+
+    # the neurons of the model are spread evenly, but the costs of the other models are not compensated
+    counts = [vps.count(vp) for vp in range(NUM_THREADS)]
+    assert max(counts) - min(counts) == 1
+    costs = nest.vp_update_costs
+    assert max(costs) - min(costs) > 10.0
+
+
+def _simulate(balanced):
+    """
+    Simulate the network with deterministic input and return sorted spikes and membrane potentials.
+    """
+
+    expensive, cheap = _create_network(balanced)
+    neurons = expensive + cheap
+
+    srec = nest.Create("spike_recorder")
+    mm = nest.Create("multimeter", params={"record_from": ["V_m"], "interval": 0.1})
+
+    nest.Connect(neurons, neurons, "all_to_all", {"weight": 2.0, "delay": 1.5})
+    nest.Connect(neurons, srec)
+    nest.Connect(mm, neurons[::3])
+
+    nest.Simulate(100.0)
+
+    spikes = srec.events
+    vm = mm.events
+    return (
+        sorted(zip(spikes["times"], spikes["senders"])),
+        sorted(zip(vm["times"], vm["senders"], vm["V_m"])),
+        nest.GetConnections(target=srec).get("source"),
+    )
+
+
+def test_cost_balanced_placement_gives_same_results():
+    spikes, vm, sources = _simulate(False)
+    spikes_b, vm_b, sources_b = _simulate(True)
+
+    assert len(spikes) > 0
+    assert spikes_b == spikes
+    assert vm_b == vm
+    assert sorted(sources_b) == sorted(sources)
+
+
+def test_model_update_costs_must_be_positive():
+    nest.ResetKernel()
+
+    with pytest.raises(nest.kernel.NESTErrors.BadProperty):
+        nest.model_update_costs = {"iaf_psc_alpha": 0.0}
+
+
+def test_model_update_costs_need_known_models():
+    nest.ResetKernel()
+
+    with pytest.raises(nest.kernel.NESTErrors.UnknownModelName):
+        nest.model_update_costs = {"no_such_model": 2.0}
+
+
+def test_cost_balanced_placement_is_off_by_default():
+    nest.ResetKernel()
+
+    assert not nest.use_cost_balanced_placement
+    assert nest.model_update_costs == {}
@@ -0,0 +1,119 @@
+# -*- coding: utf-8 -*-
+#
+# test_generate_modelsmodule.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Test that the modelsmodule generator finds the models declared in a model header.
+
+The generator is part of the source tree only, so the tests are skipped if they
+run from an installed testsuite.
+"""
+
+import importlib.util
+from pathlib import Path
+from textwrap import dedent
+
+import pytest
+
+GENERATOR = Path(__file__).resolve().parents[2] / "build_support" / "generate_modelsmodule.py"
+
+pytestmark = pytest.mark.skipif(not GENERATOR.exists(), reason="modelsmodule generator not in source tree")
+
+
+@pytest.fixture
+def generator(tmp_path):
+    """
+    Return the generator module with its source directory set to a temporary directory.
+    """
+
+    spec = importlib.util.spec_from_file_location("generate_modelsmodule", GENERATOR)
+    module = importlib.util.module_from_spec(spec)
+    spec.loader.exec_module(module)
+    (tmp_path / "models").mkdir()
+    module.srcdir = str(tmp_path)
+    return module
+
+
+def _models_in(generator, model_file, header):
+    (Path(generator.srcdir) / "models" / f"{model_file}.h").write_text(dedent(header))
+    guards, models = generator.get_models_from_file(model_file)
+    return guards, list(models)
+
+
+def test_plain_model(generator):
+    header = """
+        class my_neuron : public ArchivingNode
+        {
+        };
+        """
+    assert _models_in(generator, "my_neuron", header) == ((), [("neuron", "my_neuron")])
+
+
+def test_typedef_of_model_template(generator):
+    header = """
+        template < typename T = double >
+        class my_neuron : public ArchivingNode
+        {
+        };
+
+        typedef my_neuron< float > my_neuron_f32;
+        """
+    assert _models_in(generator, "my_neuron", header) == ((), [("neuron", "my_neuron"), ("neuron", "my_neuron_f32")])
+
+
+def test_alias_template_of_model_template(generator):
+    header = """
+        template < typename targetidentifierT, typename weightT = double >
+        class my_synapse : public Connection< targetidentifierT >
+        {
+        };
+
+        template < typename targetidentifierT >
+        using my_synapse_f32 = my_synapse< targetidentifierT, float >;
+        """
+    assert _models_in(generator, "my_synapse", header) == (
+        (),
+        [("connection", "my_synapse"), ("connection", "my_synapse_f32")],
+    )
+
+
+def test_alias_of_other_template_is_ignored(generator):
+    header = """
+        class my_neuron : public ArchivingNode
+        {
+        };
+
+        typedef std::vector< double > my_buffer;
+        using my_other_buffer = std::vector< float >;
+        """
+    assert _models_in(generator, "my_neuron", header) == ((), [("neuron", "my_neuron")])
+
+
+def test_guarded_rate_typedefs(generator):
+    header = """
+        #ifdef HAVE_GSL
+        typedef rate_neuron_ipn< nonlinearities_my > my_rate_ipn;
+        typedef rate_transformer_node< nonlinearities_my > rate_transformer_my;
+        #endif
+        """
+    assert _models_in(generator, "my_rate", header) == (
+        ("HAVE_GSL",),
+        [("rate", "my_rate_ipn"), ("rate", "rate_transformer_my")],
+    )
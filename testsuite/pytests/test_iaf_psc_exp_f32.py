@@ -0,0 +1,124 @@
+# -*- coding: utf-8 -*-
+#
+# test_iaf_psc_exp_f32.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Test that iaf_psc_exp_f32 and static_synapse_f32 reproduce the results of their double-precision counterparts.
+"""
+
+import numpy as np
+import pytest
+
+import nest
+
+
+def _simulate(neuron_model, synapse_model, params, weight, noise_weight):
+    """
+    Simulate a recurrent network and return sorted spikes and membrane potentials.
+    """
+
+    nest.ResetKernel()
+    nest.local_num_threads = 2
+    nest.rng_seed = 42
+
+    neurons = nest.Create(neuron_model, 100, params=params)
+    noise = nest.Create("poisson_generator", params={"rate": 8000.0})
+    dc = nest.Create("dc_generator", params={"amplitude": 50.0, "start": 20.0, "stop": 60.0})
+    srec = nest.Create("spike_recorder")
+    mm = nest.Create("multimeter", params={"record_from": ["V_m"], "interval": 0.1})
+
+    nest.Connect(noise, neurons, syn_spec={"synapse_model": synapse_model, "weight": noise_weight})
+    nest.Connect(dc, neurons[:50])
+    nest.Connect(
+        neurons,
+        neurons,
+        {"rule": "fixed_indegree", "indegree": 10},
+        {"synapse_model": synapse_model, "weight": weight, "delay": 1.5},
+    )
+    nest.Connect(neurons, srec)
+    nest.Connect(mm, neurons[::7])
+
+    nest.Simulate(100.0)
+
+    spikes = srec.events
+    vm = mm.events
+    return (
+        sorted(zip(spikes["times"], spikes["senders"])),
+        sorted(zip(vm["times"], vm["senders"], vm["V_m"])),
+    )
+
+
+def test_iaf_psc_exp_f32_exact_for_representable_input():
+    """
+    Integer weights and small sums of input are exactly representable in single precision.
+    """
+
+    params = {"I_e": 300.0}
+    weight = nest.random.uniform_int(5) - 2.0
+
+    spikes, vm = _simulate("iaf_psc_exp", "static_synapse", params, weight, 10.0)
+    spikes_f32, vm_f32 = _simulate("iaf_psc_exp_f32", "static_synapse_f32", params, weight, 10.0)
+
+    assert len(spikes) > 0
+    assert spikes_f32 == spikes
+    assert vm_f32 == vm
+
+
+def test_iaf_psc_exp_f32_accuracy():
+    """
+    Without spikes, rounding the input to single precision only causes small deviations of the membrane potential.
+
+    Weights of the noise are not representable in single precision, the recurrent connections remain inactive.
+    """
+
+    params = {"I_e": 300.0, "V_th": 1000.0}
+    weight = nest.random.uniform(-3.3, 5.1)
+
+    _, vm = _simulate("iaf_psc_exp", "static_synapse", params, weight, 10.3)
+    _, vm_f32 = _simulate("iaf_psc_exp_f32", "static_synapse_f32", params, weight, 10.3)
+
+    times, senders, v = (np.array(x) for x in zip(*vm))
+    times_f32, senders_f32, v_f32 = (np.array(x) for x in zip(*vm_f32))
+
+    np.testing.assert_array_equal(times_f32, times)
+    np.testing.assert_array_equal(senders_f32, senders)
+    assert np.any(v_f32 != v)
+    np.testing.assert_allclose(v_f32, v, rtol=1e-5)
+
+
+def test_static_synapse_f32_weight():
+    nest.ResetKernel()
+
+    n = nest.Create("iaf_psc_exp_f32", 2)
+    nest.Connect(n[0], n[1], syn_spec={"synapse_model": "static_synapse_f32", "weight": 0.1})
+    nest.Connect(n[0], n[1], syn_spec={"synapse_model": "static_synapse_f32", "weight": 2.5})
+    conns = nest.GetConnections(synapse_model="static_synapse_f32")
+
+    assert conns.weight == [pytest.approx(0.1, rel=1e-7), 2.5]
+    assert conns.weight[0] == float(np.float32(0.1))
+
+    conns.weight = 0.3
+    assert conns.weight == [float(np.float32(0.3))] * 2
+
+
+def test_static_synapse_f32_hpc_is_smaller():
+    nest.ResetKernel()
+
+    assert nest.GetDefaults("static_synapse_f32_hpc", "sizeof") < nest.GetDefaults("static_synapse_hpc", "sizeof")
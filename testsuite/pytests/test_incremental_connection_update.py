@@ -0,0 +1,148 @@
+# -*- coding: utf-8 -*-
+#
+# test_incremental_connection_update.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Test that incremental updates of the connection infrastructure yield the same network as full updates.
+"""
+
+import pytest
+import testnetwork
+
+import nest
+
+
+def _simulate(incremental, compressed_spikes, num_threads):
+    """
+    Simulate a network while adding and removing connections between simulation phases.
+
+    Returns sorted connections and spikes.
+    """
+
+    testnetwork.reset_kernel(
+        num_threads, 99, use_compressed_spikes=compressed_spikes, incremental_connection_update=incremental
+    )
+
+    neurons = nest.Create("iaf_psc_alpha", 60, params={"I_e": 400.0})
+    nest.CopyModel("static_synapse", "static_synapse_b")
+    srec = nest.Create("spike_recorder")
+    nest.Connect(neurons, srec)
+
+    conn_spec = {"rule": "fixed_indegree", "indegree": 5}
+    nest.Connect(neurons, neurons, conn_spec, {"weight": 20.0, "delay": testnetwork.grid_delays(1.0, 20)})
+    nest.Connect(neurons, neurons, conn_spec, {"synapse_model": "static_synapse_b", "weight": 10.0, "delay": 1.5})
+    nest.Simulate(20.0)
+
+    # add connections of one synapse model only
+    conn_spec = {"rule": "fixed_indegree", "indegree": 2}
+    nest.Connect(neurons, neurons, conn_spec, {"synapse_model": "static_synapse_b", "weight": 30.0, "delay": 2.0})
+    nest.Simulate(20.0)
+
+    # add connections of both synapse models
+    nest.Connect(neurons[:20], neurons, conn_spec, {"weight": 25.0, "delay": 1.0})
+    nest.Connect(neurons[:20], neurons, conn_spec, {"synapse_model": "static_synapse_b", "weight": 25.0})
+    nest.Simulate(20.0)
+
+    # remove connections, then add connections again; disconnecting requires connections sorted by source
+    if compressed_spikes:
+        nest.GetConnections(source=neurons[:10], target=neurons, synapse_model="static_synapse").disconnect()
+    nest.Simulate(20.0)
+    nest.Connect(neurons, neurons, conn_spec, {"weight": 25.0, "delay": 1.0})
+    nest.Simulate(20.0)
+
+    return (
+        testnetwork.sorted_connections(["source", "target", "synapse_model", "delay"], target=neurons),
+        testnetwork.sorted_spikes(srec),
+    )
+
+
+@pytest.mark.parametrize("compressed_spikes", [True, False])
+@pytest.mark.parametrize("num_threads", [1, 3])
+def test_incremental_update_gives_same_network(compressed_spikes, num_threads):
+    conns, spikes = _simulate(False, compressed_spikes, num_threads)
+    conns_incremental, spikes_incremental = _simulate(True, compressed_spikes, num_threads)
+
+    assert len(spikes) > 0
+    assert conns_incremental == conns
+    assert spikes_incremental == spikes
+
+
+def test_incremental_update_with_secondary_connections():
+    """
+    Test that adding secondary connections falls back to a full update.
+    """
+
+    rates = {}
+    for incremental in [False, True]:
+        nest.ResetKernel()
+        nest.incremental_connection_update = incremental
+
+        neurons = nest.Create("lin_rate_ipn", 5, params={"mu": 1.0, "sigma": 0.0})
+        mm = nest.Create("multimeter", params={"record_from": ["rate"], "interval": 1.0})
+        nest.Connect(mm, neurons)
+        nest.Connect(neurons, neurons, {"rule": "fixed_indegree", "indegree": 2}, "rate_connection_instantaneous")
+        nest.Simulate(10.0)
+        nest.Connect(neurons, neurons, {"rule": "fixed_indegree", "indegree": 1}, "rate_connection_instantaneous")
+        nest.Simulate(10.0)
+        rates[incremental] = sorted(zip(mm.events["times"], mm.events["senders"], mm.events["rate"]))
+
+    assert rates[True] == rates[False]
+
+
+def _add_connections(incremental, num_threads):
+    """
+    Add connections of the dominant synapse model after a simulation under default kernel settings.
+
+    Returns the number of target data sent by the update after adding connections, and the spikes.
+    """
+
+    testnetwork.reset_kernel(num_threads, 99, incremental_connection_update=incremental)
+
+    neurons = nest.Create("iaf_psc_alpha", 200, params={"I_e": 400.0})
+    new_sources = nest.Create("iaf_psc_alpha", 10, params={"I_e": 400.0})
+    srec = nest.Create("spike_recorder")
+    nest.Connect(neurons, srec)
+
+    nest.Connect(neurons, neurons, {"rule": "fixed_indegree", "indegree": 10}, {"weight": 20.0, "delay": 1.5})
+    nest.Simulate(20.0)
+
+    # a few connections from existing and from new sources
+    nest.Connect(neurons[:10], neurons[10:20], "one_to_one", {"weight": 30.0, "delay": 1.0})
+    nest.Connect(new_sources, neurons[:10], "one_to_one", {"weight": 30.0, "delay": 1.0})
+    nest.Simulate(20.0)
+
+    return nest.local_target_data_counter, testnetwork.sorted_spikes(srec)
+
+
+@pytest.mark.parametrize("num_threads", [1, 3])
+def test_incremental_update_sends_fewer_target_data(num_threads):
+    """
+    Test that only target data of new sources are exchanged with compressed spikes, which are used by default.
+    """
+
+    num_target_data, spikes = _add_connections(False, num_threads)
+    assert nest.use_compressed_spikes
+    num_target_data_incremental, spikes_incremental = _add_connections(True, num_threads)
+
+    assert num_target_data_incremental < num_target_data
+    if nest.NumProcesses() == 1:
+        assert num_target_data_incremental == 10
+    assert len(spikes) > 0
+    assert spikes_incremental == spikes
@@ -0,0 +1,91 @@
+# -*- coding: utf-8 -*-
+#
+# test_input_buffer_pools.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Test that keeping input buffers in pools gives the same results as keeping them in the neurons.
+"""
+
+import pytest
+import testnetwork
+
+import nest
+
+
+def _simulate(model, use_pools, num_threads):
+    """
+    Simulate a network while creating neurons and switching pools on and off between simulation phases.
+
+    Long delays keep spikes in the input buffers across phases. Returns sorted spikes and membrane potentials.
+    """
+
+    testnetwork.reset_kernel(num_threads, 5)
+
+    # neurons of a model without pool separate the neurons of the pooled model
+    neurons = nest.Create(model, 100, params={"I_e": 300.0}) + nest.Create("iaf_psc_delta", 10, params={"I_e": 300.0})
+    neurons += nest.Create(model, 50, params={"I_e": 350.0})
+
+    noise = nest.Create("poisson_generator", params={"rate": 5000.0})
+    dc = nest.Create("dc_generator", params={"amplitude": 50.0})
+    srec = nest.Create("spike_recorder")
+    mm = nest.Create("multimeter", params={"record_from": ["V_m"], "interval": 0.1})
+
+    nest.Connect(noise, neurons, syn_spec={"weight": 10.0})
+    nest.Connect(dc, neurons[:100])
+    nest.Connect(neurons, neurons, {"rule": "fixed_indegree", "indegree": 10}, {"weight": -3.0, "delay": 4.0})
+    nest.Connect(neurons, neurons, {"rule": "fixed_indegree", "indegree": 10}, {"weight": 2.0, "delay": 1.0})
+    nest.Connect(neurons, srec)
+    nest.Connect(mm, neurons[:100:9])
+
+    nest.use_input_buffer_pools = use_pools
+    nest.Simulate(30.0)
+
+    # new neurons require new pools while spikes are pending
+    new_neurons = nest.Create(model, 20, params={"I_e": 400.0})
+    nest.Connect(noise, new_neurons, syn_spec={"weight": 10.0})
+    nest.Connect(neurons, new_neurons, {"rule": "fixed_indegree", "indegree": 5}, {"weight": 2.0, "delay": 3.0})
+    nest.Connect(new_neurons, srec)
+    nest.Simulate(30.0)
+
+    # input buffers are moved back into the neurons while spikes are pending
+    nest.use_input_buffer_pools = False
+    nest.Simulate(30.0)
+
+    nest.SetKernelStatus({"use_input_buffer_pools": use_pools, "use_population_update": True})
+    nest.Simulate(30.0)
+
+    return testnetwork.sorted_spikes(srec), testnetwork.sorted_potentials(mm)
+
+
+@pytest.mark.parametrize("num_threads", [1, 2])
+@pytest.mark.parametrize("model", ["iaf_psc_alpha", "iaf_psc_exp", "iaf_psc_exp_f32"])
+def test_input_buffer_pools_give_same_results(model, num_threads):
+    spikes, vm = _simulate(model, False, num_threads)
+    spikes_p, vm_p = _simulate(model, True, num_threads)
+
+    assert len(spikes) > 0
+    assert spikes_p == spikes
+    assert vm_p == vm
+
+
+def test_input_buffer_pools_are_off_by_default():
+    nest.ResetKernel()
+
+    assert not nest.use_input_buffer_pools
@@ -0,0 +1,96 @@
+# -*- coding: utf-8 -*-
+#
+# test_population_update.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Test that updating neurons of one model together gives the same results as updating them one by one.
+"""
+
+import pytest
+import testnetwork
+
+import nest
+
+
+def _simulate(model, population_update, num_threads, params=None):
+    """
+    Simulate a recurrent network of the given model and return sorted spikes and membrane potentials.
+
+    The network is larger than one block of the population update.
+    """
+
+    testnetwork.reset_kernel(num_threads, 123, use_population_update=population_update)
+
+    neurons = nest.Create(model, 300, params={"I_e": 300.0, "V_m": nest.random.uniform(-70.0, -55.0)})
+    if params:
+        neurons[::3].set(params)
+
+    # nodes that are not updated split the neurons into several groups
+    neurons[::50].frozen = True
+
+    # a device between neurons of one model splits the neurons updated together
+    nest.Create("parrot_neuron")
+    others = nest.Create(model, 20, params={"I_e": 400.0})
+
+    noise = nest.Create("poisson_generator", params={"rate": 8000.0})
+    dc = nest.Create("dc_generator", params={"amplitude": 100.0, "start": 20.0, "stop": 60.0})
+    srec = nest.Create("spike_recorder")
+    mm = nest.Create("multimeter", params={"record_from": ["V_m"], "interval": 0.1})
+
+    nest.Connect(noise, neurons + others, syn_spec={"weight": 10.0})
+    nest.Connect(dc, neurons[:100])
+    nest.Connect(
+        neurons + others,
+        neurons + others,
+        {"rule": "fixed_indegree", "indegree": 10},
+        {"weight": testnetwork.integer_weights(-2, 2), "delay": testnetwork.grid_delays(1.0, 10)},
+    )
+    nest.Connect(neurons + others, srec)
+    nest.Connect(mm, neurons[1:250:7])
+
+    nest.Simulate(100.0)
+
+    return testnetwork.sorted_spikes(srec), testnetwork.sorted_potentials(mm)
+
+
+@pytest.mark.parametrize("num_threads", [1, 2])
+@pytest.mark.parametrize(
+    "model, params",
+    [
+        ("iaf_psc_alpha", None),
+        ("iaf_psc_exp", None),
+        ("iaf_psc_exp", {"delta": 0.5, "rho": 0.01}),
+        ("iaf_psc_delta", None),
+        ("iaf_psc_delta", {"refractory_input": True}),
+    ],
+)
+def test_population_update_gives_same_results(model, params, num_threads):
+    spikes, vm = _simulate(model, False, num_threads, params)
+    spikes_p, vm_p = _simulate(model, True, num_threads, params)
+
+    assert len(spikes) > 0
+    assert spikes_p == spikes
+    assert vm_p == vm
+
+
+def test_population_update_is_off_by_default():
+    nest.ResetKernel()
+
+    assert not nest.use_population_update
@@ -0,0 +1,69 @@
+# -*- coding: utf-8 -*-
+#
+# test_radix_sort_connections.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Test that sorting connections with a radix sort yields the same network as the default sort.
+"""
+
+import pytest
+import testnetwork
+
+import nest
+
+
+def _simulate(radix_sort_connections, synapse_model, num_threads):
+    """
+    Simulate a random network, removing some connections between two simulation phases.
+
+    Returns sorted connections and spikes.
+    """
+
+    testnetwork.reset_kernel(num_threads, 4321, radix_sort_connections=radix_sort_connections)
+
+    neurons = nest.Create("iaf_psc_alpha", 50, params={"I_e": 420.0})
+    srec = nest.Create("spike_recorder")
+    nest.Connect(
+        neurons,
+        neurons,
+        {"rule": "fixed_indegree", "indegree": 10},
+        {"synapse_model": synapse_model, "weight": 20.0, "delay": testnetwork.grid_delays(1.0, 20)},
+    )
+    nest.Connect(neurons, srec)
+
+    nest.Simulate(50.0)
+    nest.GetConnections(source=neurons[::4], target=neurons).disconnect()
+    nest.Simulate(50.0)
+
+    return (
+        testnetwork.sorted_connections(["source", "target", "delay"], target=neurons),
+        testnetwork.sorted_spikes(srec),
+    )
+
+
+@pytest.mark.parametrize("synapse_model", ["static_synapse", "static_synapse_lbl"])
+@pytest.mark.parametrize("num_threads", [1, 2])
+def test_radix_sort_gives_same_network(synapse_model, num_threads):
+    conns, spikes = _simulate(False, synapse_model, num_threads)
+    conns_radix, spikes_radix = _simulate(True, synapse_model, num_threads)
+
+    assert len(spikes) > 0
+    assert conns_radix == conns
+    assert spikes_radix == spikes
@@ -23,6 +23,7 @@ from pathlib import Path
 
 import nest
 import pytest
+import testnetwork
 
 # Skip all tests in this module if no HDF5 or OpenMP threads
 pytestmark = [pytest.mark.skipif_missing_hdf5, pytest.mark.skipif_missing_threads]
@@ -78,3 +79,73 @@ def test_SonataNetwork(num_threads, hyperslab_size):
     spike_data = srec.events
     post_times = spike_data["times"]
     assert post_times.size == EXPECTED_NUM_SPIKES
+
+
+def _update_syn_specs(monkeypatch, sonata_net, update):
+    """
+    Apply update to the syn_specs of each edge file before the connections are created.
+    """
+
+    create_edges_maps = sonata_net._create_edges_maps
+
+    def create_updated_edges_maps():
+        create_edges_maps()
+        for edges_map in sonata_net._edges_maps:
+            update(edges_map["syn_specs"])
+
+    monkeypatch.setattr(sonata_net, "_create_edges_maps", create_updated_edges_maps)
+
+
+def test_SonataNetwork_edge_type_without_syn_spec(monkeypatch):
+    assert have_sonata_files, "SONATA files not found"
+
+    nest.ResetKernel()
+    sonata_net = nest.SonataNetwork(config, sim_config)
+    _update_syn_specs(monkeypatch, sonata_net, lambda syn_specs: syn_specs.pop(min(syn_specs)))
+
+    with pytest.raises(nest.kernel.NESTError, match="has no entry in syn_specs"):
+        sonata_net.BuildNetwork()
+
+
+def _connect_with_random_syn_param(monkeypatch, num_threads, hyperslab_size):
+    """
+    Build the network with a randomly drawn synapse parameter and return the sorted connections.
+    """
+
+    def use_random_tau_plus(syn_specs):
+        for syn_spec in syn_specs.values():
+            syn_spec["synapse_model"] = "stdp_synapse"
+            syn_spec["tau_plus"] = nest.random.uniform(10.0, 30.0)
+
+    testnetwork.reset_kernel(num_threads, 123)
+    sonata_net = nest.SonataNetwork(config, sim_config)
+    _update_syn_specs(monkeypatch, sonata_net, use_random_tau_plus)
+    sonata_net.BuildNetwork(hdf5_hyperslab_size=hyperslab_size)
+
+    return testnetwork.sorted_connections(["source", "target", "weight", "delay", "tau_plus"])
+
+
+def test_SonataNetwork_connections_do_not_depend_on_threads(monkeypatch):
+    """
+    Check connections and randomly drawn synapse parameters for different numbers of threads.
+
+    The parameters are drawn with the random number generator of the virtual process of the
+    target, so their values depend on the number of virtual processes. For a given number,
+    the edges of each thread are connected in the order of the edge file, so the values do
+    not depend on how the file is split into hyperslabs.
+    """
+
+    assert have_sonata_files, "SONATA files not found"
+
+    reference = None
+    for num_threads in NUM_THREADS:
+        conns = _connect_with_random_syn_param(monkeypatch, num_threads, HYPERSLAB_SIZES[0])
+        assert len(conns) == EXPECTED_NUM_CONNECTIONS
+        assert len({conn[4] for conn in conns}) > 1
+        assert all(10.0 <= conn[4] < 30.0 for conn in conns)
+        assert _connect_with_random_syn_param(monkeypatch, num_threads, HYPERSLAB_SIZES[1]) == conns
+
+        fixed_properties = [conn[:4] for conn in conns]
+        if reference is None:
+            reference = fixed_properties
+        assert fixed_properties == reference
@@ -0,0 +1,76 @@
+# -*- coding: utf-8 -*-
+#
+# test_spike_buffer_encoding.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Test that spikes exchanged as encoded byte streams are delivered like spikes exchanged in fixed-width buffers.
+"""
+
+import numpy as np
+
+import nest
+
+
+def _simulate_bursts(spike_buffer_encoding, off_grid=False):
+    """
+    Simulate parrot neurons that all spike at the same times and relay their spikes to a second population.
+
+    Returns the recorded spikes sorted by sender and time and whether encoding was active in the last slice.
+    """
+
+    nest.ResetKernel()
+    nest.local_num_threads = 2
+    nest.spike_buffer_encoding = spike_buffer_encoding
+
+    model = "parrot_neuron_ps" if off_grid else "parrot_neuron"
+    sg = nest.Create("spike_generator", params={"spike_times": np.arange(5.0, 100.0, 5.0), "precise_times": off_grid})
+    parrots = nest.Create(model, 500)
+    relays = nest.Create(model, 500)
+    srec = nest.Create("spike_recorder")
+
+    nest.Connect(sg, parrots)
+    nest.Connect(parrots, relays, "one_to_one", syn_spec={"delay": 2.0})
+    nest.Connect(relays, srec)
+
+    nest.Simulate(100.0)
+
+    events = srec.events
+    order = np.lexsort((events["times"], events["senders"]))
+    return events["senders"][order], events["times"][order], nest.spike_buffer_encoding_active
+
+
+def test_encoding_delivers_same_spikes():
+    senders_plain, times_plain, active_plain = _simulate_bursts(False)
+    senders_encoded, times_encoded, active_encoded = _simulate_bursts(True)
+
+    assert not active_plain
+    assert active_encoded
+    assert len(senders_plain) > 0
+    np.testing.assert_array_equal(senders_encoded, senders_plain)
+    np.testing.assert_array_equal(times_encoded, times_plain)
+
+
+def test_encoding_not_used_for_off_grid_spikes():
+    senders_plain, times_plain, _ = _simulate_bursts(False, off_grid=True)
+    senders_encoded, times_encoded, active = _simulate_bursts(True, off_grid=True)
+
+    assert not active
+    np.testing.assert_array_equal(senders_encoded, senders_plain)
+    np.testing.assert_array_equal(times_encoded, times_plain)
@@ -0,0 +1,85 @@
+# -*- coding: utf-8 -*-
+#
+# test_spike_buffer_sizing.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Test predictive sizing of spike exchange buffers.
+"""
+
+import numpy as np
+import pytest
+
+import nest
+
+
+def _simulate_bursts(predictive_sizing):
+    """
+    Simulate parrot neurons that all spike in short bursts separated by silent periods.
+
+    The bursts are relayed to a second population, so that spikes are exchanged via the spike buffers.
+
+    Returns the number of recorded spikes and the number of buffer overflows.
+    """
+
+    nest.ResetKernel()
+    nest.spike_buffer_predictive_sizing = predictive_sizing
+    nest.spike_buffer_ema_weight = 0.02
+    nest.spike_buffer_resize_interval = 5
+
+    burst_times = [t + dt for t in np.arange(10.0, 200.0, 10.0) for dt in (0.0, 0.1, 0.2)]
+    sg = nest.Create("spike_generator", params={"spike_times": burst_times})
+    parrots = nest.Create("parrot_neuron", 100)
+    relays = nest.Create("parrot_neuron", 100)
+    srec = nest.Create("spike_recorder")
+
+    nest.Connect(sg, parrots)
+    nest.Connect(parrots, relays, "one_to_one")
+    nest.Connect(relays, srec)
+
+    nest.Simulate(250.0)
+
+    return srec.n_events, nest.spike_buffer_overflows
+
+
+def test_predictive_sizing_avoids_overflows_for_bursts():
+    n_events_default, overflows_default = _simulate_bursts(False)
+    n_events_predictive, overflows_predictive = _simulate_bursts(True)
+
+    assert n_events_predictive == n_events_default
+    assert overflows_predictive < overflows_default
+
+
+def test_exchange_rounds_count_retransmissions():
+    _simulate_bursts(False)
+
+    num_slices = 250
+    assert nest.spike_buffer_overflows > 0
+    assert nest.spike_exchange_rounds == num_slices + nest.spike_buffer_overflows
+
+
+@pytest.mark.parametrize(
+    "param, value",
+    [("spike_buffer_ema_weight", 0.0), ("spike_buffer_headroom", -0.1), ("spike_buffer_resize_interval", 0)],
+)
+def test_invalid_sizing_parameters(param, value):
+    nest.ResetKernel()
+
+    with pytest.raises(nest.kernel.NESTErrors.BadProperty):
+        nest.SetKernelStatus({param: value})
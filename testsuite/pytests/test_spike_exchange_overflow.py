@@ -0,0 +1,131 @@
+# -*- coding: utf-8 -*-
+#
+# test_spike_exchange_overflow.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Test that all spikes are delivered if they do not fit into the spike exchange buffers.
+"""
+
+import pytest
+import testnetwork
+
+import nest
+
+NUM_NEURONS = 120
+NUM_BURSTS = 12
+
+
+def _simulate_growing_bursts(num_threads, parrot_model="parrot_neuron", **kernel_params):
+    """
+    Simulate bursts of growing size, separated by silent periods, and return the relayed spikes.
+
+    Burst k at 10 * k ms contains the spikes of the first 10 * k parrots. The buffers shrink in
+    the silent periods, so every burst overflows the spike exchange buffers. The spikes of each
+    burst are relayed to a second population one to one.
+    """
+
+    testnetwork.reset_kernel(num_threads, 11, **kernel_params)
+
+    spike_times = [[10.0 * k for k in range(1, NUM_BURSTS + 1) if i < 10 * k] for i in range(NUM_NEURONS)]
+    sgs = nest.Create(
+        "spike_generator", NUM_NEURONS, params=[{"spike_times": times, "precise_times": False} for times in spike_times]
+    )
+    parrots = nest.Create(parrot_model, NUM_NEURONS)
+    relays = nest.Create(parrot_model, NUM_NEURONS)
+    srec = nest.Create("spike_recorder")
+
+    nest.Connect(sgs, parrots, "one_to_one")
+    nest.Connect(parrots, relays, "one_to_one", {"delay": 2.0})
+    nest.Connect(relays, srec)
+
+    nest.Simulate(10.0 * NUM_BURSTS + 20.0)
+
+    return testnetwork.sorted_spikes(srec), nest.spike_buffer_overflows
+
+
+@pytest.mark.skipif_missing_threads
+@pytest.mark.parametrize("pipeline_depth", [1, 4])
+@pytest.mark.parametrize("grow_extra", [0.0, 0.5])
+def test_spike_registers_keep_spikes_in_overflow_rounds(pipeline_depth, grow_extra):
+    """
+    Spike registers must only be replaced by larger ones after all their spikes have been sent.
+    """
+
+    reference, _ = _simulate_growing_bursts(1, spike_buffer_shrink_limit=0.0)
+    spikes, overflows = _simulate_growing_bursts(
+        4, spike_exchange_pipeline_depth=pipeline_depth, spike_buffer_grow_extra=grow_extra
+    )
+
+    assert len(reference) == sum(min(10 * k, NUM_NEURONS) for k in range(1, NUM_BURSTS + 1))
+    assert overflows >= NUM_BURSTS
+    assert spikes == reference
+
+
+@pytest.mark.skipif_missing_threads
+@pytest.mark.parametrize("num_threads", [2, 3, 4])
+@pytest.mark.parametrize("parrot_model", ["parrot_neuron", "parrot_neuron_ps"])
+def test_parallel_collocation_with_overflow_rounds(num_threads, parrot_model):
+    """
+    After an overflow, spikes are collocated in parallel again in the next time slice.
+
+    Retransmission rounds collocate serially, so both paths must write the spikes of all threads.
+    With parrot_neuron_ps, spikes are sent with their offsets.
+    """
+
+    reference, _ = _simulate_growing_bursts(1, parrot_model, spike_buffer_shrink_limit=0.0)
+    spikes, overflows = _simulate_growing_bursts(num_threads, parrot_model)
+
+    assert overflows >= NUM_BURSTS
+    assert spikes == reference
+
+
+@pytest.mark.skipif_missing_threads
+@pytest.mark.parametrize("pipeline_depth", [1, 4])
+@pytest.mark.parametrize("parrot_model", ["parrot_neuron", "parrot_neuron_ps"])
+def test_spike_registers_shrink_and_grow_again(pipeline_depth, parrot_model):
+    """
+    Spike registers shrink after a burst once their high-water mark has decayed, and grow again in a later burst.
+
+    The silent period between the bursts spans several hundred time slices, so the high-water marks decay
+    several times before all neurons spike again.
+    """
+
+    def simulate(num_threads, **kernel_params):
+        testnetwork.reset_kernel(num_threads, 11, **kernel_params)
+
+        sgs = nest.Create(
+            "spike_generator", NUM_NEURONS, params={"spike_times": [10.0, 20.0, 900.0], "precise_times": False}
+        )
+        parrots = nest.Create(parrot_model, NUM_NEURONS)
+        relays = nest.Create(parrot_model, NUM_NEURONS)
+        srec = nest.Create("spike_recorder")
+
+        nest.Connect(sgs, parrots, "one_to_one")
+        nest.Connect(parrots, relays, "one_to_one", {"delay": 2.0})
+        nest.Connect(relays, srec)
+
+        nest.Simulate(920.0)
+        return testnetwork.sorted_spikes(srec)
+
+    reference = simulate(1)
+    spikes = simulate(4, spike_exchange_pipeline_depth=pipeline_depth)
+
+    assert len(reference) == 3 * NUM_NEURONS
+    assert spikes == reference
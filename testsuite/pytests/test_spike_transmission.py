@@ -51,17 +51,32 @@ class TestSpikeTransmission:
     t_arrival = t_spike + 2 * delay  # expected spike arrival time
 
     @classmethod
-    def _simulate_network(cls, n_pre, n_post, conn_rule, num_threads, compressed_spikes):
+    def _simulate_network(
+        cls,
+        n_pre,
+        n_post,
+        conn_rule,
+        num_threads,
+        compressed_spikes,
+        sort_spikes=False,
+        thread_sections=False,
+        pipeline_depth=1,
+        num_synapse_models=1,
+    ):
         """
         Simulate network for given parameters and return spike recorder events.
 
-        n_pre parrot neurons connected to n_post parrot neurons with given rule.
+        n_pre parrot neurons connected to n_post parrot neurons with given rule,
+        once for each of num_synapse_models copies of the static synapse.
         """
 
         nest.ResetKernel()
         nest.resolution = cls.dt
         nest.local_num_threads = num_threads
         nest.use_compressed_spikes = compressed_spikes
+        nest.sort_spikes_by_target = sort_spikes
+        nest.spike_buffer_thread_sections = thread_sections
+        nest.spike_exchange_pipeline_depth = pipeline_depth
 
         sg = nest.Create("spike_generator", params={"spike_times": [cls.t_spike]})
         sr = nest.Create("spike_recorder")
@@ -71,6 +86,9 @@ class TestSpikeTransmission:
 
         nest.Connect(sg, pre)
         nest.Connect(pre, post, conn_rule, syn_spec={"delay": cls.delay, "weight": 1})
+        for i in range(1, num_synapse_models):
+            nest.CopyModel("static_synapse", f"static_synapse_{i}")
+            nest.Connect(pre, post, conn_rule, syn_spec={"synapse_model": f"static_synapse_{i}", "delay": cls.delay})
         nest.Connect(post, sr)
 
         nest.Simulate(cls.t_spike + 3 * cls.delay)
@@ -145,3 +163,88 @@ class TestSpikeTransmission:
         )
         assert sorted(spike_data["senders"]) == sorted(num_neurons * post_pop.tolist())
         assert all(spike_data["times"] == self.t_arrival)
+
+    @pytest.mark.parametrize("compressed_spikes", [False, True])
+    @pytest.mark.parametrize("num_neurons", [4, 5])
+    @pytest.mark.parametrize("num_threads", THREAD_NUMBERS)
+    def test_all_to_all_target_sorted(self, compressed_spikes, num_neurons, num_threads):
+        """
+        Test for all-to-all connectivity with target-sorted spike delivery.
+
+        Connect num_neurons pre to num_neurons post with all-to-all rule.
+
+        Expectation: Each post neuron receives exactly one spike from each pre neuron.
+        """
+
+        post_pop, spike_data = self._simulate_network(
+            num_neurons, num_neurons, "all_to_all", num_threads, compressed_spikes, sort_spikes=True
+        )
+        assert sorted(spike_data["senders"]) == sorted(num_neurons * post_pop.tolist())
+        assert all(spike_data["times"] == self.t_arrival)
+
+    @pytest.mark.parametrize("sort_spikes", [False, True])
+    @pytest.mark.parametrize("num_neurons", [4, 5])
+    @pytest.mark.parametrize("num_threads", THREAD_NUMBERS)
+    def test_all_to_all_thread_sections(self, sort_spikes, num_neurons, num_threads):
+        """
+        Test for all-to-all connectivity with spike buffers sorted by target thread.
+
+        Connect num_neurons pre to num_neurons post with all-to-all rule.
+
+        Expectation: Each post neuron receives exactly one spike from each pre neuron.
+        """
+
+        post_pop, spike_data = self._simulate_network(
+            num_neurons, num_neurons, "all_to_all", num_threads, False, sort_spikes=sort_spikes, thread_sections=True
+        )
+        assert sorted(spike_data["senders"]) == sorted(num_neurons * post_pop.tolist())
+        assert all(spike_data["times"] == self.t_arrival)
+
+    @pytest.mark.parametrize("sort_spikes", [False, True])
+    @pytest.mark.parametrize("pipeline_depth", [2, 3, 4])
+    @pytest.mark.parametrize("num_threads", THREAD_NUMBERS)
+    def test_all_to_all_pipelined(self, sort_spikes, pipeline_depth, num_threads):
+        """
+        Test for all-to-all connectivity with spikes exchanged in pipeline stages within each time slice.
+
+        Connect 5 pre to 5 post with all-to-all rule.
+
+        Expectation: Each post neuron receives exactly one spike from each pre neuron.
+        """
+
+        num_neurons = 5
+        post_pop, spike_data = self._simulate_network(
+            num_neurons,
+            num_neurons,
+            "all_to_all",
+            num_threads,
+            False,
+            sort_spikes=sort_spikes,
+            pipeline_depth=pipeline_depth,
+        )
+        assert sorted(spike_data["senders"]) == sorted(num_neurons * post_pop.tolist())
+        assert all(spike_data["times"] == self.t_arrival)
+
+    @pytest.mark.parametrize("compressed_spikes", [False, True])
+    @pytest.mark.parametrize("num_synapse_models", [2, 5])
+    @pytest.mark.parametrize("num_threads", THREAD_NUMBERS)
+    def test_all_to_all_multiple_synapse_models(self, compressed_spikes, num_synapse_models, num_threads):
+        """
+        Test for all-to-all connectivity via several synapse models.
+
+        Connect 4 pre to 4 post with all-to-all rule once per synapse model.
+
+        Expectation: Each post neuron receives exactly one spike from each pre neuron per synapse model.
+        """
+
+        num_neurons = 4
+        post_pop, spike_data = self._simulate_network(
+            num_neurons,
+            num_neurons,
+            "all_to_all",
+            num_threads,
+            compressed_spikes,
+            num_synapse_models=num_synapse_models,
+        )
+        assert sorted(spike_data["senders"]) == sorted(num_synapse_models * num_neurons * post_pop.tolist())
+        assert all(spike_data["times"] == self.t_arrival)
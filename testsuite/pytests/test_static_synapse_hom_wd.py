@@ -0,0 +1,131 @@
+# -*- coding: utf-8 -*-
+#
+# test_static_synapse_hom_wd.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Test ``static_synapse_hom_wd``, which uses a common weight and delay for all connections.
+
+Networks connected with ``static_synapse_hom_w`` and the same delay for all connections serve as reference.
+"""
+
+import pytest
+import testnetwork
+
+import nest
+
+
+def _simulate(synapse_model, num_threads):
+    """
+    Simulate a randomly connected network and return its sorted connections and spikes.
+    """
+
+    testnetwork.reset_kernel(num_threads, 1234)
+    nest.SetDefaults(synapse_model, {"weight": 40.0, "delay": 1.5})
+
+    neurons = nest.Create("iaf_psc_alpha", 20, params={"I_e": 450.0})
+    srec = nest.Create("spike_recorder")
+    nest.Connect(neurons, neurons, {"rule": "fixed_indegree", "indegree": 5}, {"synapse_model": synapse_model})
+    nest.Connect(neurons, srec)
+    nest.Simulate(200.0)
+
+    return (
+        testnetwork.sorted_connections(["source", "target", "delay"], synapse_model=synapse_model),
+        testnetwork.sorted_spikes(srec),
+    )
+
+
+@pytest.mark.parametrize("synapse_model", ["static_synapse_hom_wd", "static_synapse_hom_wd_hpc"])
+@pytest.mark.parametrize("num_threads", [1, 2])
+def test_network_matches_static_synapse_hom_w(synapse_model, num_threads):
+    conns, spikes = _simulate(synapse_model, num_threads)
+    conns_ref, spikes_ref = _simulate("static_synapse_hom_w", num_threads)
+
+    assert len(spikes_ref) > 0
+    assert conns == conns_ref
+    assert spikes == spikes_ref
+
+
+def test_hpc_variant_uses_four_bytes_per_connection():
+    nest.ResetKernel()
+    neurons = nest.Create("iaf_psc_alpha", 2)
+    nest.Connect(neurons, neurons, syn_spec={"synapse_model": "static_synapse_hom_wd_hpc"})
+
+    assert nest.GetConnections().get("sizeof") == [4] * 4
+
+
+@pytest.mark.parametrize("syn_spec", [{"weight": 2.0}, {"delay": 2.0}])
+def test_individual_weight_and_delay_not_allowed(syn_spec):
+    nest.ResetKernel()
+    neurons = nest.Create("iaf_psc_alpha", 2)
+
+    with pytest.raises(nest.kernel.NESTError):
+        nest.Connect(neurons, neurons, syn_spec={"synapse_model": "static_synapse_hom_wd", **syn_spec})
+
+
+def test_delay_must_not_change_after_connecting():
+    nest.ResetKernel()
+    neurons = nest.Create("iaf_psc_alpha", 2)
+    nest.Connect(neurons, neurons, syn_spec={"synapse_model": "static_synapse_hom_wd"})
+    conns = nest.GetConnections()
+
+    with pytest.raises(nest.kernel.NESTErrors.BadProperty):
+        conns.set(delay=2.0)
+
+    nest.SetDefaults("static_synapse_hom_wd", {"delay": 2.0})
+    with pytest.raises(nest.kernel.NESTErrors.BadProperty):
+        nest.Connect(neurons, neurons, syn_spec={"synapse_model": "static_synapse_hom_wd"})
+
+
+def test_copied_models_have_separate_weight_and_delay():
+    nest.ResetKernel()
+    nest.CopyModel("static_synapse_hom_wd", "slow_synapse", {"weight": 2.0, "delay": 3.0})
+    neurons = nest.Create("iaf_psc_alpha", 2)
+    nest.Connect(neurons, neurons, syn_spec={"synapse_model": "static_synapse_hom_wd"})
+    nest.Connect(neurons, neurons, syn_spec={"synapse_model": "slow_synapse"})
+
+    assert nest.GetDefaults("static_synapse_hom_wd", ["weight", "delay"]) == (1.0, 1.0)
+    assert nest.GetDefaults("slow_synapse", ["weight", "delay"]) == (2.0, 3.0)
+    assert nest.GetConnections(synapse_model="static_synapse_hom_wd").delay == [1.0] * 4
+    assert nest.GetConnections(synapse_model="slow_synapse").delay == [3.0] * 4
+
+
+@pytest.mark.parametrize("synapse_model", ["static_synapse_hom_wd", "static_synapse_hom_wd_hpc"])
+def test_spikes_reach_remaining_targets_after_disconnect(synapse_model):
+    """
+    Disabled targets between remaining targets of a source must not end the delivery of its spikes.
+    """
+
+    nest.ResetKernel()
+    nest.use_compressed_spikes = True
+    sg = nest.Create("spike_generator", params={"spike_times": [5.0]})
+    source = nest.Create("parrot_neuron")
+    targets = nest.Create("parrot_neuron", 10)
+    srec = nest.Create("spike_recorder")
+    nest.Connect(sg, source)
+    nest.Connect(source, targets, syn_spec={"synapse_model": synapse_model})
+    nest.Connect(targets, srec)
+
+    removed = targets[1:9:2]
+    nest.GetConnections(source=source, target=removed).disconnect()
+    nest.Simulate(10.0)
+
+    remaining = sorted(set(targets.tolist()) - set(removed.tolist()))
+    assert sorted(nest.GetConnections(source=source).target) == remaining
+    assert sorted(srec.events["senders"]) == remaining
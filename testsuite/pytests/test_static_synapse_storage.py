@@ -0,0 +1,122 @@
+# -*- coding: utf-8 -*-
+#
+# test_static_synapse_storage.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Test the connector of ``static_synapse``, which stores targets, weights and delays in separate arrays.
+
+The labeled variant ``static_synapse_lbl`` stores full connection objects and serves as reference.
+"""
+
+import numpy as np
+import pytest
+import testnetwork
+
+import nest
+
+
+def _build_network(synapse_model, num_threads):
+    """
+    Connect neurons randomly with random weights and delays.
+    """
+
+    testnetwork.reset_kernel(num_threads, 1234)
+
+    neurons = nest.Create("iaf_psc_alpha", 20, params={"I_e": 420.0})
+    nest.Connect(
+        neurons,
+        neurons,
+        {"rule": "fixed_indegree", "indegree": 5},
+        {
+            "synapse_model": synapse_model,
+            "weight": nest.random.uniform(-50.0, 100.0),
+            "delay": nest.random.uniform(1.0, 3.0),
+        },
+    )
+
+    return neurons
+
+
+@pytest.mark.parametrize("num_threads", [1, 2])
+def test_connections_match_labeled_variant(num_threads):
+    keys = ["source", "target", "weight", "delay"]
+    _build_network("static_synapse", num_threads)
+    conns = testnetwork.sorted_connections(keys)
+
+    _build_network("static_synapse_lbl", num_threads)
+    conns_lbl = testnetwork.sorted_connections(keys)
+
+    assert len(conns) > 0
+    assert conns == conns_lbl
+
+
+@pytest.mark.parametrize("num_threads", [1, 2])
+def test_spikes_match_labeled_variant(num_threads):
+    spikes = {}
+    for synapse_model in ["static_synapse", "static_synapse_lbl"]:
+        neurons = _build_network(synapse_model, num_threads)
+        srec = nest.Create("spike_recorder")
+        nest.Connect(neurons, srec)
+        nest.Simulate(200.0)
+        spikes[synapse_model] = testnetwork.sorted_spikes(srec)
+
+    assert len(spikes["static_synapse"]) > 0
+    assert spikes["static_synapse"] == spikes["static_synapse_lbl"]
+
+
+def test_set_weight_and_delay():
+    _build_network("static_synapse", 1)
+    conns = nest.GetConnections()
+    weights = np.arange(len(conns), dtype=float)
+
+    conns.set(weight=weights, delay=2.5)
+
+    assert conns.get("weight") == pytest.approx(weights)
+    assert conns.get("delay") == pytest.approx([2.5] * len(conns))
+
+
+def test_disconnect():
+    neurons = _build_network("static_synapse", 1)
+    num_conns = len(nest.GetConnections())
+
+    removed = nest.GetConnections(source=neurons[:5])
+    num_removed = len(removed)
+    removed.disconnect()
+    remaining = nest.GetConnections()
+
+    assert num_removed > 0
+    assert len(remaining) == num_conns - num_removed
+    assert all(source > neurons[4].global_id for source in remaining.get("source"))
+
+
+def test_weight_recorder():
+    nest.ResetKernel()
+
+    sg = nest.Create("spike_generator", params={"spike_times": [1.0, 2.0]})
+    parrot = nest.Create("parrot_neuron")
+    targets = nest.Create("parrot_neuron", 3)
+    wr = nest.Create("weight_recorder")
+    nest.CopyModel("static_synapse", "static_synapse_rec", {"weight_recorder": wr})
+
+    nest.Connect(sg, parrot)
+    nest.Connect(parrot, targets, syn_spec={"synapse_model": "static_synapse_rec", "weight": [[1.0], [2.0], [3.0]]})
+    nest.Simulate(5.0)
+
+    assert sorted(wr.events["weights"]) == pytest.approx([1.0, 1.0, 2.0, 2.0, 3.0, 3.0])
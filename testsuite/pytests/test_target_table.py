@@ -0,0 +1,159 @@
+# -*- coding: utf-8 -*-
+#
+# test_target_table.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Test that the target table delivers spikes and secondary events to all targets.
+
+The tests compare against results computed without the target table: parrot neurons
+repeat every spike they receive, and rate neurons with identical sources respond
+to the summed weight of their inputs only. The layout of the target table differs
+with the number of threads and with targets added in several connection
+infrastructure updates.
+"""
+
+from collections import Counter
+
+import numpy as np
+import pytest
+import testnetwork
+
+import nest
+
+NUM_SOURCES = 30
+NUM_TARGETS = 30
+NUM_CONNECTIONS = 400
+
+
+def _random_connections(seed):
+    """
+    Return sources, targets and delays of connections drawn with numpy, independent of the number of threads.
+    """
+
+    rng = np.random.default_rng(seed)
+    sources = rng.integers(NUM_SOURCES, size=NUM_CONNECTIONS)
+    targets = rng.integers(NUM_TARGETS, size=NUM_CONNECTIONS)
+    delays = np.round(1.0 + 0.1 * rng.integers(20, size=NUM_CONNECTIONS), 1)
+    return sources, targets, delays
+
+
+@pytest.mark.parametrize("num_threads", [1, 2, 4])
+@pytest.mark.parametrize("compressed_spikes", [True, False])
+@pytest.mark.parametrize("incremental", [True, False])
+def test_target_table_delivers_spikes_to_all_targets(num_threads, compressed_spikes, incremental):
+    """
+    Targets of each source are added in two connection infrastructure updates.
+
+    All source spikes are emitted after the second update.
+    """
+
+    testnetwork.reset_kernel(
+        num_threads, 13, use_compressed_spikes=compressed_spikes, incremental_connection_update=incremental
+    )
+    nest.CopyModel("static_synapse", "static_synapse_b")
+
+    source_spike_times = [[20.0 + k + 0.1 * i for k in range(0, 40, 10)] for i in range(NUM_SOURCES)]
+    generators = nest.Create("spike_generator", NUM_SOURCES, params=[{"spike_times": t} for t in source_spike_times])
+    source_parrots = nest.Create("parrot_neuron", NUM_SOURCES)
+    target_parrots = nest.Create("parrot_neuron", NUM_TARGETS)
+    srec = nest.Create("spike_recorder")
+    nest.Connect(generators, source_parrots, "one_to_one")
+    nest.Connect(target_parrots, srec)
+
+    source_ids = np.array(source_parrots.tolist())
+    target_ids = np.array(target_parrots.tolist())
+    sources, targets, delays = _random_connections(7)
+    synapse_models = np.where(np.arange(NUM_CONNECTIONS) % 3 == 0, "static_synapse_b", "static_synapse")
+    half = NUM_CONNECTIONS // 2
+    for part in [slice(0, half), slice(half, NUM_CONNECTIONS)]:
+        for synapse_model in ["static_synapse", "static_synapse_b"]:
+            selected = np.flatnonzero(synapse_models[part] == synapse_model) + part.start
+            nest.Connect(
+                source_ids[sources[selected]],
+                target_ids[targets[selected]],
+                "one_to_one",
+                {"synapse_model": synapse_model, "delay": delays[selected]},
+            )
+        nest.Simulate(5.0)
+    nest.Simulate(60.0)
+
+    expected_conns = sorted(zip(source_ids[sources], target_ids[targets], delays, synapse_models))
+    conns = testnetwork.sorted_connections(["source", "target", "delay", "synapse_model"], target=target_parrots)
+    assert [(s, t, round(d, 1), m) for s, t, d, m in conns] == expected_conns
+
+    # source parrots spike 1 ms after their generators, each target parrot repeats every spike it receives
+    expected_spikes = Counter()
+    for s, t, d in zip(sources, targets, delays):
+        for spike_time in source_spike_times[s]:
+            expected_spikes[(round(spike_time + 1.0 + d, 1), target_ids[t])] += 1
+    spikes = Counter((round(time, 1), sender) for time, sender in testnetwork.sorted_spikes(srec))
+    assert spikes == expected_spikes
+
+
+@pytest.mark.parametrize("num_threads", [1, 2, 4])
+def test_target_table_delivers_secondary_events_to_all_targets(num_threads):
+    """
+    Rate neurons receive delayed and instantaneous rate connections from identical sources.
+
+    The rate of each target must match the rate of a reference neuron that receives the summed
+    weight of its delayed and instantaneous inputs through a single connection each.
+    """
+
+    testnetwork.reset_kernel(num_threads, 13)
+
+    rate_params = {"tau": 5.0, "sigma": 0.0}
+    sources = nest.Create("lin_rate_ipn", NUM_SOURCES, params={"mu": 1.5, "sigma": 0.0})
+    targets = nest.Create("lin_rate_ipn", NUM_TARGETS, params=rate_params)
+    references = nest.Create("lin_rate_ipn", NUM_TARGETS, params=rate_params)
+    mm = nest.Create("multimeter", params={"record_from": ["rate"], "interval": 1.0})
+    nest.Connect(mm, targets + references)
+
+    source_ids = np.array(sources.tolist())
+    target_ids = np.array(targets.tolist())
+    reference_ids = np.array(references.tolist())
+    conn_sources, conn_targets, _ = _random_connections(9)
+    weight = 0.25
+    delayed = np.arange(NUM_CONNECTIONS) % 2 == 0
+    for synapse_model, selected in [("rate_connection_delayed", delayed), ("rate_connection_instantaneous", ~delayed)]:
+        conn_targets_selected = conn_targets[selected]
+
+        # reference neurons with inputs receive their summed weight from the first source
+        num_inputs = np.bincount(conn_targets_selected, minlength=NUM_TARGETS)
+        with_inputs = np.flatnonzero(num_inputs)
+
+        for pre, post, weights in [
+            (source_ids[conn_sources[selected]], target_ids[conn_targets_selected], np.full(selected.sum(), weight)),
+            (source_ids[np.zeros_like(with_inputs)], reference_ids[with_inputs], weight * num_inputs[with_inputs]),
+        ]:
+            syn_spec = {"synapse_model": synapse_model, "weight": weights}
+            if synapse_model == "rate_connection_delayed":
+                syn_spec["delay"] = np.full(len(pre), 2.0)
+            nest.Connect(pre, post, "one_to_one", syn_spec)
+
+    nest.Simulate(30.0)
+
+    events = mm.events
+    rates = {(time, sender): rate for time, sender, rate in zip(events["times"], events["senders"], events["rate"])}
+    times = sorted({time for time, _ in rates})
+    target_rates = [rates[(time, node_id)] for time in times for node_id in target_ids]
+    reference_rates = [rates[(time, node_id)] for time in times for node_id in reference_ids]
+
+    assert max(target_rates) > 0.0
+    assert target_rates == pytest.approx(reference_rates, rel=1e-12)
@@ -0,0 +1,134 @@
+# -*- coding: utf-8 -*-
+#
+# test_update_stealing.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Test that updating nodes by other threads than their own gives the same results as the static assignment.
+"""
+
+import pytest
+import testnetwork
+
+import nest
+
+# iaf_psc_exp with stochastic threshold and parrot_neuron are always updated by their own thread
+populations = [
+    ("iaf_psc_alpha", 100, {"I_e": 300.0}),
+    ("iaf_psc_exp", 30, {"I_e": 300.0, "delta": 0.5, "rho": 0.01}),
+    ("parrot_neuron", 10, {}),
+    ("iaf_psc_exp", 40, {"I_e": 350.0}),
+    ("iaf_psc_delta", 50, {"I_e": 300.0}),
+]
+
+gsl_populations = [
+    ("iaf_psc_alpha", 100, {"I_e": 300.0}),
+    ("hh_psc_alpha", 20, {"I_e": 300.0}),
+    ("aeif_cond_alpha", 20, {"I_e": 500.0}),
+]
+
+
+def _simulate(populations, num_threads, update_stealing, population_update=False):
+    """
+    Simulate a network of the given populations.
+
+    Returns sorted spikes, membrane potentials and the number of spikes counted during the second
+    simulation phase.
+    """
+
+    testnetwork.reset_kernel(
+        num_threads,
+        17,
+        use_population_update=population_update,
+        use_update_stealing=update_stealing,
+        update_stealing_chunk_size=8,
+    )
+
+    model, n, params = populations[0]
+    neurons = nest.Create(model, n, params=params)
+    for model, n, params in populations[1:]:
+        neurons += nest.Create(model, n, params=params)
+    neurons[::40].frozen = True
+
+    noise = nest.Create("poisson_generator", params={"rate": 5000.0})
+    srec = nest.Create("spike_recorder")
+    mm = nest.Create("multimeter", params={"record_from": ["V_m"], "interval": 0.1})
+
+    nest.Connect(noise, neurons, syn_spec={"weight": 10.0})
+    nest.Connect(
+        neurons,
+        neurons,
+        {"rule": "fixed_indegree", "indegree": 10},
+        {"weight": testnetwork.integer_weights(-2, 2), "delay": testnetwork.grid_delays(1.0, 10)},
+    )
+    nest.Connect(neurons, srec)
+    nest.Connect(mm, neurons[1:100:11])
+
+    nest.Simulate(50.0)
+    nest.Simulate(50.0)
+
+    return testnetwork.sorted_spikes(srec), testnetwork.sorted_potentials(mm), nest.local_spike_counter
+
+
+@pytest.mark.parametrize("num_threads", [1, 2, 4])
+@pytest.mark.parametrize("population_update", [False, True])
+def test_update_stealing_gives_same_results(num_threads, population_update):
+    spikes, vm, spike_count = _simulate(populations, num_threads, False, population_update)
+    spikes_s, vm_s, spike_count_s = _simulate(populations, num_threads, True, population_update)
+
+    assert len(spikes) > 0
+    assert spikes_s == spikes
+    assert vm_s == vm
+    assert spike_count_s == spike_count
+
+
+@pytest.mark.skipif_missing_gsl
+@pytest.mark.parametrize("num_threads", [2, 4])
+def test_update_stealing_gives_same_results_for_gsl_models(num_threads):
+    spikes, vm, _ = _simulate(gsl_populations, num_threads, False)
+    spikes_s, vm_s, _ = _simulate(gsl_populations, num_threads, True)
+
+    assert len(spikes) > 0
+    assert spikes_s == spikes
+    assert vm_s == vm
+
+
+def test_update_time_is_reported_per_thread():
+    _simulate(populations, 4, True)
+
+    # NEST built with -Dwith-threaded-timers=OFF reports a single update time
+    time_update = nest.GetKernelStatus("time_update_per_thread")
+    if isinstance(time_update, (list, tuple)):
+        assert len(time_update) == 4
+    else:
+        assert time_update >= 0.0
+    assert len(nest.GetKernelStatus("stolen_update_chunks")) == 4
+
+
+def test_update_stealing_chunk_size_must_be_positive():
+    nest.ResetKernel()
+
+    with pytest.raises(nest.kernel.NESTError):
+        nest.update_stealing_chunk_size = 0
+
+
+def test_update_stealing_is_off_by_default():
+    nest.ResetKernel()
+
+    assert not nest.use_update_stealing
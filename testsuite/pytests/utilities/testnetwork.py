@@ -0,0 +1,80 @@
+# -*- coding: utf-8 -*-
+#
+# testnetwork.py
+#
+# This file is part of NEST.
+#
+# Copyright (C) 2004 The NEST Initiative
+#
+# NEST is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 2 of the License, or
+# (at your option) any later version.
+#
+# NEST is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+
+"""
+Helpers for tests that compare networks simulated with and without a kernel feature.
+
+Such tests compare sorted connections, spikes and membrane potentials. Spikes may
+be delivered in a different order with the feature, which changes the rounding of
+summed input. With small integer weights, all partial sums are exact and the
+results must be identical.
+"""
+
+import nest
+
+
+def reset_kernel(num_threads, rng_seed, **kernel_params):
+    """
+    Reset the kernel and set the number of threads, the seed and further kernel parameters.
+    """
+
+    nest.ResetKernel()
+    nest.local_num_threads = num_threads
+    nest.rng_seed = rng_seed
+    if kernel_params:
+        nest.SetKernelStatus(kernel_params)
+
+
+def integer_weights(low, high):
+    """
+    Return a parameter drawing integer weights from the closed interval [low, high].
+    """
+
+    return nest.random.uniform_int(high - low + 1) + float(low)
+
+
+def grid_delays(min_delay, num_steps):
+    """
+    Return a parameter drawing delays from num_steps steps of 0.1 ms, starting at min_delay.
+    """
+
+    return nest.random.uniform_int(num_steps) * 0.1 + min_delay
+
+
+def sorted_spikes(spike_recorder):
+    events = spike_recorder.events
+    return sorted(zip(events["times"], events["senders"]))
+
+
+def sorted_potentials(multimeter):
+    events = multimeter.events
+    return sorted(zip(events["times"], events["senders"], events["V_m"]))
+
+
+def sorted_connections(keys, **filters):
+    """
+    Return the given properties of the connections selected by filters as sorted tuples.
+
+    At least two keys must be given.
+    """
+
+    conns = nest.GetConnections(**filters).get(list(keys))
+    return sorted(zip(*(conns[key] for key in keys)))